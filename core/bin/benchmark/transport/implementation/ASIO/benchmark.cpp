@@ -0,0 +1,576 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <algorithm>
+#include <asio/ip/address_v4.hpp>
+#include <asio/ip/tcp.hpp>
+#include <asio/local/stream_protocol.hpp>
+#include <barrier>
+#include <bit>
+#include <chrono>
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+#include <future>
+#include <iterator>
+#include <list>
+#include <map>
+#include <mcs/core/Storages.hpp>
+#include <mcs/core/UniqueStorage.hpp>
+#include <mcs/core/memory/Offset.hpp>
+#include <mcs/core/memory/Size.hpp>
+#include <mcs/core/storage/Parameter.hpp>
+#include <mcs/core/storage/UniqueSegment.hpp>
+#include <mcs/core/storage/implementation/Heap.hpp>
+#include <mcs/core/transport/Address.hpp>
+#include <mcs/core/transport/implementation/ASIO/Client.hpp>
+#include <mcs/core/transport/implementation/ASIO/Provider.hpp>
+#include <mcs/rpc/ScopedRunningIOContext.hpp>
+#include <mcs/rpc/access_policy/Exclusive.hpp>
+#include <mcs/rpc/access_policy/Sequential.hpp>
+#include <mcs/util/TemporaryDirectory.hpp>
+#include <mcs/util/cast.hpp>
+#include <mcs/util/main.hpp>
+#include <mcs/util/read/read.hpp>
+#include <mcs/util/syscall/getpid.hpp>
+#include <mcs/util/type/List.hpp>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Sweeps over all combinations of the given protocols, access
+// policies, methods, sizes, numbers of clients, numbers of callers
+// per client, numbers of provider threads and numbers of client
+// threads. For each combination a provider and the clients run in
+// this process, each caller executes repetitions many synchronous
+// operations and the latency of each operation is measured. The
+// callers of a client share the client concurrently, which requires
+// the access policy sequential. The results are written as JSON to
+// stdout, a summary per combination is written to stderr.
+//
+// EXAMPLE:
+//
+//   benchmark tcp,local exclusive get,put 64,4096,1048576 1,4 1 1,2 1,2 1000
+//   benchmark tcp sequential get 4096 1 1,4,16 1 1,4 1000
+//
+namespace
+{
+  using Clock = std::chrono::steady_clock;
+  using Nanoseconds = std::chrono::nanoseconds;
+
+  struct Configuration
+  {
+    std::string protocol;
+    std::string access_policy;
+    std::string method;
+    std::size_t size;
+    unsigned int clients;
+    unsigned int callers;
+    unsigned int provider_threads;
+    unsigned int client_threads;
+    std::size_t repetitions;
+  };
+
+  struct Measurement
+  {
+    Nanoseconds wall_time;
+    std::vector<Nanoseconds> latencies;
+  };
+
+  auto split (std::string_view list) -> std::vector<std::string>
+  {
+    auto elements {std::vector<std::string>{}};
+
+    while (!list.empty())
+    {
+      auto const comma {list.find (',')};
+      elements.emplace_back (list.substr (0, comma));
+      list.remove_prefix
+        (comma == std::string_view::npos ? list.size() : comma + 1);
+    }
+
+    return elements;
+  }
+
+  template<typename T>
+    auto numbers (std::string_view list) -> std::vector<T>
+  {
+    auto elements {std::vector<T>{}};
+
+    std::ranges::transform
+      ( split (list)
+      , std::back_inserter (elements)
+      , [] (auto const& element)
+        {
+          return mcs::util::read::read<T> (element);
+        }
+      );
+
+    return elements;
+  }
+
+  using Storage = mcs::core::storage::implementation::Heap;
+  using SupportedStorageImplementations = mcs::util::type::List<Storage>;
+
+  // A heap segment with one range of size many bytes per caller.
+  //
+  struct Segment
+  {
+    Segment (std::size_t number_of_callers, std::size_t size);
+
+    [[nodiscard]] auto address
+      ( std::size_t caller
+      ) const -> mcs::core::transport::Address
+      ;
+
+    mcs::core::Storages<SupportedStorageImplementations> storages;
+
+  private:
+    std::size_t _size;
+    mcs::core::UniqueStorage<Storage, Storage> _storage;
+    mcs::core::storage::UniqueSegment<Storage, Storage> _segment;
+  };
+
+  Segment::Segment (std::size_t number_of_callers, std::size_t size)
+    : _size {size}
+    , _storage
+      { mcs::core::make_unique_storage<Storage>
+          ( std::addressof (storages)
+          , Storage::Parameter::Create
+              { mcs::core::storage::MaxSize::Limit
+                  {mcs::core::memory::make_size (number_of_callers * _size)}
+              }
+          )
+      }
+    , _segment
+      { mcs::core::storage::make_unique_segment<Storage>
+          ( std::addressof (storages)
+          , _storage->id()
+          , mcs::core::memory::make_size (number_of_callers * _size)
+          )
+      }
+  {}
+
+  auto Segment::address
+    ( std::size_t caller
+    ) const -> mcs::core::transport::Address
+  {
+    return mcs::core::transport::Address
+      { _storage->id()
+      , mcs::core::storage::make_parameter
+          (Storage::Parameter::Chunk::Description{})
+      , _segment->id()
+      , mcs::core::memory::make_offset (caller * _size)
+      };
+  }
+
+  template< typename Protocol
+          , typename AccessPolicy
+          >
+    auto measure
+      ( Configuration const& configuration
+      , typename Protocol::endpoint endpoint
+      ) -> Measurement
+  {
+    using Client = mcs::core::transport::implementation::ASIO::Client
+      < Protocol
+      , AccessPolicy
+      , SupportedStorageImplementations
+      >;
+
+    if (  std::is_same_v<AccessPolicy, mcs::rpc::access_policy::Exclusive>
+       && configuration.callers != 1
+       )
+    {
+      throw std::invalid_argument
+        {"access policy exclusive requires exactly one caller per client"};
+    }
+
+    auto const size {mcs::core::memory::make_size (configuration.size)};
+    auto const number_of_callers
+      {std::size_t {configuration.clients} * configuration.callers};
+
+    // each caller uses its own range of the provider segment
+    auto provider_segment {Segment {number_of_callers, configuration.size}};
+
+    auto provider_io_context
+      { mcs::rpc::ScopedRunningIOContext
+        { mcs::rpc::ScopedRunningIOContext::NumberOfThreads
+            {configuration.provider_threads}
+        , SIGINT, SIGTERM
+        }
+      };
+    auto const provider
+      { mcs::core::transport::implementation::ASIO::Provider
+          < Protocol
+          , SupportedStorageImplementations
+          >
+        { provider_io_context
+        , endpoint
+        , std::addressof (provider_segment.storages)
+        }
+      };
+
+    auto client_io_context
+      { mcs::rpc::ScopedRunningIOContext
+        { mcs::rpc::ScopedRunningIOContext::NumberOfThreads
+            {configuration.client_threads}
+        , SIGINT, SIGTERM
+        }
+      };
+
+    // all clients are connected before the callers start, each caller
+    // uses its own range of the segment of its client
+    auto client_segments {std::list<Segment>{}};
+    auto clients {std::list<Client>{}};
+
+    for (auto c {0u}; c != configuration.clients; ++c)
+    {
+      auto& client_segment
+        {client_segments.emplace_back (configuration.callers, configuration.size)};
+
+      clients.emplace_back
+        ( client_io_context
+        , provider.connection_information()
+        , std::addressof (client_segment.storages)
+        );
+    }
+
+    auto start {Clock::time_point{}};
+    auto barrier
+      { std::barrier
+        ( mcs::util::cast<std::ptrdiff_t> (number_of_callers)
+        , [&]() noexcept { start = Clock::now(); }
+        )
+      };
+
+    auto callers {std::vector<std::future<std::vector<Nanoseconds>>>{}};
+    auto client_segment {std::cbegin (client_segments)};
+
+    for (auto caller {std::size_t {0}}; auto const& client : clients)
+    {
+      for (auto c {std::size_t {0}}; c != configuration.callers; ++c, ++caller)
+      {
+        callers.emplace_back
+          ( std::async
+            ( std::launch::async
+            , [ &barrier
+              , &configuration
+              , &client
+              , size
+              , local {client_segment->address (c)}
+              , remote {provider_segment.address (caller)}
+              ]
+              {
+                auto latencies {std::vector<Nanoseconds>{}};
+                latencies.reserve (configuration.repetitions);
+
+                barrier.arrive_and_wait();
+
+                for (auto r {std::size_t {0}}; r != configuration.repetitions; ++r)
+                {
+                  auto const begin {Clock::now()};
+
+                  if (configuration.method == "get")
+                  {
+                    client.memory_get (local, remote, size).get();
+                  }
+                  else
+                  {
+                    client.memory_put (remote, local, size).get();
+                  }
+
+                  latencies.emplace_back (Clock::now() - begin);
+                }
+
+                return latencies;
+              }
+            )
+          );
+      }
+
+      ++client_segment;
+    }
+
+    auto measurement {Measurement{}};
+
+    for (auto& caller : callers)
+    {
+      auto const latencies {caller.get()};
+
+      measurement.latencies.insert
+        ( std::end (measurement.latencies)
+        , std::begin (latencies)
+        , std::end (latencies)
+        );
+    }
+
+    measurement.wall_time = Clock::now() - start;
+
+    return measurement;
+  }
+
+  auto to_json
+    ( Configuration const& configuration
+    , Measurement measurement
+    ) -> std::string
+  {
+    auto& latencies {measurement.latencies};
+    std::ranges::sort (latencies);
+
+    auto const ns
+      { [] (Nanoseconds duration)
+        {
+          return mcs::util::cast<std::uint64_t> (duration.count());
+        }
+      };
+    // nearest rank
+    auto const percentile
+      { [&] (double p)
+        {
+          if (latencies.empty())
+          {
+            return std::uint64_t {0};
+          }
+
+          auto const rank
+            { std::min
+              ( latencies.size() - 1
+              , static_cast<std::size_t>
+                  (p / 100.0 * static_cast<double> (latencies.size()))
+              )
+            };
+
+          return ns (latencies[rank]);
+        }
+      };
+
+    // buckets [2^(b-1), 2^b)
+    auto histogram {std::map<int, std::size_t>{}};
+    for (auto latency : latencies)
+    {
+      ++histogram[mcs::util::cast<int> (std::bit_width (ns (latency)))];
+    }
+
+    auto buckets {std::vector<std::string>{}};
+    std::ranges::transform
+      ( histogram
+      , std::back_inserter (buckets)
+      , [] (auto const& bucket)
+        {
+          auto const [width, count] {bucket};
+
+          return fmt::format
+            ( R"({{"lower": {}, "upper": {}, "count": {}}})"
+            , width == 0 ? 0 : std::uint64_t {1} << (width - 1)
+            , std::uint64_t {1} << width
+            , count
+            );
+        }
+      );
+
+    auto const total
+      { std::accumulate
+          (std::begin (latencies), std::end (latencies), Nanoseconds {0})
+      };
+    auto const operations {latencies.size()};
+    auto const seconds
+      {std::chrono::duration<double> (measurement.wall_time).count()};
+
+    return fmt::format
+      ( R"({{"protocol": "{}", "access_policy": "{}", "method": "{}")"
+        R"(, "size": {}, "clients": {}, "callers": {})"
+        R"(, "provider_threads": {}, "client_threads": {}, "repetitions": {})"
+        R"(, "wall_time_ns": {}, "operations_per_second": {})"
+        R"(, "bandwidth_bytes_per_second": {})"
+        R"(, "latency_ns": {{"min": {}, "mean": {}, "p50": {}, "p90": {})"
+        R"(, "p99": {}, "p999": {}, "max": {}}})"
+        R"(, "histogram_ns": [{}]}})"
+      , configuration.protocol
+      , configuration.access_policy
+      , configuration.method
+      , configuration.size
+      , configuration.clients
+      , configuration.callers
+      , configuration.provider_threads
+      , configuration.client_threads
+      , configuration.repetitions
+      , ns (measurement.wall_time)
+      , static_cast<double> (operations) / seconds
+      , static_cast<double> (operations * configuration.size) / seconds
+      , operations ? ns (latencies.front()) : 0
+      , operations ? ns (total) / operations : 0
+      , percentile (50)
+      , percentile (90)
+      , percentile (99)
+      , percentile (99.9)
+      , operations ? ns (latencies.back()) : 0
+      , fmt::join (buckets, ", ")
+      );
+  }
+
+  auto benchmark_main (mcs::util::Args args) -> int
+  {
+    if (args.size() != 10)
+    {
+      throw std::invalid_argument
+        { fmt::format
+          ( "usage: {} protocols access_policies methods sizes_in_bytes"
+            " numbers_of_clients numbers_of_callers_per_client"
+            " numbers_of_provider_threads numbers_of_client_threads"
+            " repetitions"
+            "\n  protocols: comma separated subset of tcp,local"
+            "\n  access_policies: comma separated subset of exclusive,sequential"
+            "\n  methods: comma separated subset of get,put"
+            "\n  numbers_of_callers_per_client: larger than one requires"
+            " sequential"
+            "\n  all other lists: comma separated numbers"
+          , args[0]
+          )
+        };
+    }
+
+    auto const protocols {split (args[1])};
+    auto const access_policies {split (args[2])};
+    auto const methods {split (args[3])};
+    auto const sizes {numbers<std::size_t> (args[4])};
+    auto const numbers_of_clients {numbers<unsigned int> (args[5])};
+    auto const numbers_of_callers {numbers<unsigned int> (args[6])};
+    auto const numbers_of_provider_threads
+      {numbers<unsigned int> (args[7])};
+    auto const numbers_of_client_threads {numbers<unsigned int> (args[8])};
+    auto const repetitions {mcs::util::read::read<std::size_t> (args[9])};
+
+    auto const temporary_directory
+      { mcs::util::TemporaryDirectory
+        { std::filesystem::temp_directory_path()
+        / fmt::format ("mcs-benchmark-{}", mcs::util::syscall::getpid())
+        }
+      };
+    auto number_of_providers {std::size_t {0}};
+
+    auto const run
+      { [&] (Configuration const& configuration) -> Measurement
+        {
+          auto const with_access_policy
+            { [&]<typename Protocol> (typename Protocol::endpoint endpoint)
+              {
+                if (configuration.access_policy == "exclusive")
+                {
+                  return measure<Protocol, mcs::rpc::access_policy::Exclusive>
+                    (configuration, endpoint);
+                }
+                if (configuration.access_policy == "sequential")
+                {
+                  return measure<Protocol, mcs::rpc::access_policy::Sequential>
+                    (configuration, endpoint);
+                }
+
+                throw std::invalid_argument
+                  { fmt::format
+                    ("unknown access policy '{}'", configuration.access_policy)
+                  };
+              }
+            };
+
+          if (configuration.method != "get" && configuration.method != "put")
+          {
+            throw std::invalid_argument
+              {fmt::format ("unknown method '{}'", configuration.method)};
+          }
+
+          if (configuration.protocol == "tcp")
+          {
+            return with_access_policy.template operator()<asio::ip::tcp>
+              ( asio::ip::tcp::endpoint
+                {asio::ip::address_v4::loopback(), 0}
+              );
+          }
+          if (configuration.protocol == "local")
+          {
+            return with_access_policy
+              .template operator()<asio::local::stream_protocol>
+              ( asio::local::stream_protocol::endpoint
+                { ( temporary_directory.path()
+                  / fmt::format ("SOCK-{}", number_of_providers++)
+                  ).native()
+                }
+              );
+          }
+
+          throw std::invalid_argument
+            {fmt::format ("unknown protocol '{}'", configuration.protocol)};
+        }
+      };
+
+    auto results {std::vector<std::string>{}};
+
+    for (auto const& protocol : protocols)
+    for (auto const& access_policy : access_policies)
+    for (auto const& method : methods)
+    for (auto size : sizes)
+    for (auto clients : numbers_of_clients)
+    for (auto callers : numbers_of_callers)
+    for (auto provider_threads : numbers_of_provider_threads)
+    for (auto client_threads : numbers_of_client_threads)
+    {
+      auto const configuration
+        { Configuration
+          { protocol
+          , access_policy
+          , method
+          , size
+          , clients
+          , callers
+          , provider_threads
+          , client_threads
+          , repetitions
+          }
+        };
+
+      auto const measurement {run (configuration)};
+
+      fmt::print
+        ( stderr
+        , "{} {} {}: size {} clients {} callers {} threads {}/{}:"
+          " {} ops in {} us\n"
+        , protocol
+        , access_policy
+        , method
+        , size
+        , clients
+        , callers
+        , provider_threads
+        , client_threads
+        , measurement.latencies.size()
+        , std::chrono::duration_cast<std::chrono::microseconds>
+            (measurement.wall_time).count()
+        );
+
+      results.emplace_back (to_json (configuration, measurement));
+    }
+
+    fmt::print
+      ( R"({{"benchmark": "mcs_core_transport_implementation_ASIO")"
+        R"(, "results": [{}]}})"
+        "\n"
+      , fmt::join (results, ", ")
+      );
+
+    return EXIT_SUCCESS;
+  }
+}
+
+auto main (int argc, char const** argv) noexcept -> int
+{
+  return mcs::util::main (argc, argv, benchmark_main);
+}
@@ -2,6 +2,7 @@
 // License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
 
 #include <csignal>
+#include <cstddef>
 #include <cstdlib>
 #include <fmt/format.h>
 #include <mcs/core/Chunk.hpp>
@@ -16,6 +17,7 @@
 #include <mcs/core/storage/implementation/Heap.hpp>
 #include <mcs/core/transport/Address.hpp>
 #include <mcs/core/transport/implementation/ASIO/Provider.hpp>
+#include <mcs/core/transport/implementation/ASIO/provider/ZeroCopy.hpp>
 #include <mcs/rpc/Concepts.hpp>
 #include <mcs/rpc/ScopedRunningIOContext.hpp>
 #include <mcs/util/ASIO/Connectable.hpp>
@@ -36,11 +38,12 @@ namespace
 {
   auto provider_main (mcs::util::Args args) -> int
   {
-    if (args.size() != 5)
+    if (args.size() != 5 && args.size() != 6)
     {
       throw std::invalid_argument
         { fmt::format
           ( "usage: {} endpoint provider_path number_of_longs number_of_threads"
+            " [zero_copy_threshold_in_bytes]"
           , args[0]
           )
         };
@@ -102,6 +105,17 @@ namespace
       std::iota (std::begin (elements), std::end (elements), 0l);
     }
 
+    auto const zero_copy
+      { args.size() == 6
+      ? mcs::core::transport::implementation::ASIO::provider::ZeroCopy
+        { mcs::core::transport::implementation::ASIO::provider::ZeroCopy::Threshold
+          { mcs::core::memory::make_size
+              (mcs::util::read::read<std::size_t> (args[5]))
+          }
+        }
+      : mcs::core::transport::implementation::ASIO::provider::ZeroCopy{}
+      };
+
     // create a provider
     auto io_context
       { mcs::rpc::ScopedRunningIOContext
@@ -129,6 +143,7 @@ namespace
                 { io_context
                 , provider_endpoint
                 , std::addressof (storages)
+                , zero_copy
                 }
             };
 
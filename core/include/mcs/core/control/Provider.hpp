@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <asio/local/stream_protocol.hpp>
 #include <mcs/core/Storages.hpp>
 #include <mcs/core/control/Commands.hpp>
 #include <mcs/core/control/provider/Handler.hpp>
@@ -10,8 +11,10 @@
 #include <mcs/rpc/Concepts.hpp>
 #include <mcs/rpc/Dispatcher.hpp>
 #include <mcs/rpc/Provider.hpp>
+#include <mcs/util/ASIO/Connectable.hpp>
 #include <mcs/util/not_null.hpp>
 #include <mcs/util/type/List.hpp>
+#include <optional>
 
 namespace mcs::core::control
 {
@@ -26,15 +29,29 @@ namespace mcs::core::control
                    , util::type::List<StorageImplementations...>
                    >
   {
+    // An ip::tcp provider listens on the local::stream_protocol
+    // endpoint same_host in addition, if it is set, see
+    // connection_information.
+    //
     template<typename Executor>
       Provider
         ( Executor&
         , typename Protocol::endpoint
         , util::not_null<Storages<util::type::List<StorageImplementations...>>>
+        , std::optional<asio::local::stream_protocol::endpoint> same_host
+            = std::nullopt
         );
 
     [[nodiscard]] auto local_endpoint() const -> typename Protocol::endpoint;
 
+    // Includes the same host endpoint, if any. Clients on the same
+    // host use it, see util::ASIO::prefer_same_host.
+    //
+    [[nodiscard]] auto connection_information
+      (
+      ) const -> util::ASIO::Connectable<Protocol>
+      ;
+
   private:
     using Dispatcher = typename provider::Commands<StorageImplementations...>
       ::template wrap< rpc::Dispatcher
@@ -18,6 +18,9 @@ namespace mcs::core::control::command::file
   {
     using Response = mcs::core::memory::Size;
 
+    // writes the file in the handler
+    static constexpr auto is_blocking {true};
+
     storage::ID _storage_id;
     storage::Parameter _parameter_file_write;
     storage::segment::ID _segment_id;
@@ -14,10 +14,12 @@ namespace mcs::core::control
         , typename Protocol::endpoint endpoint
         , util::not_null<Storages<util::type::List<StorageImplementations...>>>
             storages
+        , std::optional<asio::local::stream_protocol::endpoint> same_host
         )
           : _provider
             { rpc::make_provider<Protocol, Dispatcher>
               ( endpoint
+              , rpc::provider::Options {.same_host = same_host}
               , executor
               , storages
               )
@@ -35,4 +37,16 @@ namespace mcs::core::control
   {
     return _provider.local_endpoint();
   }
+
+  template< rpc::is_protocol Protocol
+          , storage::is_implementation... StorageImplementations
+          >
+    auto Provider< Protocol
+                 , util::type::List<StorageImplementations...>
+                 >::connection_information
+      (
+      ) const -> util::ASIO::Connectable<Protocol>
+  {
+    return _provider.connection_information();
+  }
 }
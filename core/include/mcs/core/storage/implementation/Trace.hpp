@@ -10,7 +10,10 @@
 #include <mcs/core/storage/trace/Concepts.hpp>
 #include <mcs/core/storage/trace/Events.hpp>
 #include <mcs/util/not_null.hpp>
+#include <mcs/util/trace/Span.hpp>
 #include <memory>
+#include <optional>
+#include <string_view>
 
 namespace mcs::core::storage::implementation
 {
@@ -46,6 +49,11 @@ namespace mcs::core::storage::implementation
   // advantage. However, to temporarily enable or disable tracing the
   // tracer itself must provide a method in its external state.
   //
+  // Independent of the tracer, each operation is recorded as a span
+  // "storage::<operation>" if the calling thread has a traced
+  // util::trace::Context, e.g. when the operation is executed by an
+  // rpc handler for a traced request.
+  //
   template<typename Tracer, is_implementation Storage>
     requires (storage::trace::is_tracer<Tracer, Storage>)
     struct Trace
@@ -130,6 +138,11 @@ namespace mcs::core::storage::implementation
     template<typename Event, typename... Args>
       requires (std::is_constructible_v<Event, Args...>)
       auto trace (Args&&...) const -> void;
+
+    [[nodiscard]] static auto start_span
+      ( std::string_view operation
+      ) -> std::optional<util::trace::Span>
+      ;
   };
 }
 
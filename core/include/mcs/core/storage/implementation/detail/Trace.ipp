@@ -2,6 +2,7 @@
 // License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
 
 #include <mcs/util/execute_and_die_on_exception.hpp>
+#include <mcs/util/trace/Context.hpp>
 #include <utility>
 
 namespace mcs::core::storage::implementation
@@ -60,6 +61,20 @@ namespace mcs::core::storage::implementation
   {
     _tracer.template trace<Event> (std::forward<Args> (args)...);
   }
+
+  template<typename Tracer, is_implementation Storage>
+    requires (storage::trace::is_tracer<Tracer, Storage>)
+    auto Trace<Tracer, Storage>::start_span
+      ( std::string_view operation
+      ) -> std::optional<util::trace::Span>
+  {
+    return util::trace::Span::start
+      ( operation
+      , "storage"
+      , util::trace::Kind::Internal
+      , util::trace::current()
+      );
+  }
 }
 
 namespace mcs::core::storage::implementation
@@ -70,6 +85,8 @@ namespace mcs::core::storage::implementation
       ( Parameter::Size::Max parameter_size_max
       ) const -> MaxSize
   {
+    auto const span {start_span ("storage::size_max")};
+
     trace<storage::trace::event::size::Max<Storage>>
       ( parameter_size_max
       );
@@ -89,6 +106,8 @@ namespace mcs::core::storage::implementation
       ( Parameter::Size::Used parameter_size_used
       ) const -> memory::Size
   {
+    auto const span {start_span ("storage::size_used")};
+
     trace<storage::trace::event::size::Used<Storage>>
       ( parameter_size_used
       );
@@ -109,6 +128,8 @@ namespace mcs::core::storage::implementation
       , memory::Size size
       ) -> segment::ID
   {
+    auto const span {start_span ("storage::segment_create")};
+
     trace<storage::trace::event::segment::Create<Storage>>
       ( parameter_segment_create
       , size
@@ -130,6 +151,8 @@ namespace mcs::core::storage::implementation
       , segment::ID segment_id
       ) -> memory::Size
   {
+    auto const span {start_span ("storage::segment_remove")};
+
     trace<storage::trace::event::segment::Remove<Storage>>
       ( parameter_segment_remove
       , segment_id
@@ -153,6 +176,8 @@ namespace mcs::core::storage::implementation
           , memory::Range memory_range
           ) const -> Chunk::template Description<Access>
   {
+    auto const span {start_span ("storage::chunk_description")};
+
     trace<storage::trace::event::chunk::Description<Storage, Access>>
       ( parameter_chunk_description
       , segment_id
@@ -184,6 +209,8 @@ namespace mcs::core::storage::implementation
       , memory::Range range
       ) const -> memory::Size
   {
+    auto const span {start_span ("storage::file_read")};
+
     trace<storage::trace::event::file::Read<Storage>>
       ( parameter_file_read
       , segment_id
@@ -219,6 +246,8 @@ namespace mcs::core::storage::implementation
       , memory::Range range
       ) const -> memory::Size
   {
+    auto const span {start_span ("storage::file_write")};
+
     trace<storage::trace::event::file::Write<Storage>>
       ( parameter_file_write
       , segment_id
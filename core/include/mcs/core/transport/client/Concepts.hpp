@@ -4,6 +4,8 @@
 #pragma once
 
 #include <concepts>
+#include <exception>
+#include <functional>
 #include <future>
 #include <mcs/core/memory/Size.hpp>
 #include <mcs/core/transport/Address.hpp>
@@ -43,6 +45,46 @@ namespace mcs::core::transport::client
            )
         } -> std::convertible_to<std::future<memory::Size>>;
       };
+
+    using CompletionHandler
+      = std::function<void (std::exception_ptr, memory::Size)>
+      ;
+
+    template<typename Client>
+      concept has_memory_get_with_completion_handler = requires
+        ( Client const& client
+        , Address destination
+        , Address source
+        , memory::Size size
+        , CompletionHandler handler
+        )
+      {
+        { client.memory_get
+           ( destination
+           , source
+           , size
+           , handler
+           )
+        } -> std::convertible_to<void>;
+      };
+
+    template<typename Client>
+      concept has_memory_put_with_completion_handler = requires
+        ( Client const& client
+        , Address destination
+        , Address source
+        , memory::Size size
+        , CompletionHandler handler
+        )
+      {
+        { client.memory_put
+           ( destination
+           , source
+           , size
+           , handler
+           )
+        } -> std::convertible_to<void>;
+      };
   }
 
   template<typename Client>
@@ -50,4 +92,13 @@ namespace mcs::core::transport::client
        detail::has_memory_get<Client>
     && detail::has_memory_put<Client>
     ;
+
+  // Implementations that deliver the transferred size (or the error)
+  // to a completion handler instead of a std::future.
+  //
+  template<typename Client>
+    concept is_asynchronous_implementation = is_implementation<Client>
+    && detail::has_memory_get_with_completion_handler<Client>
+    && detail::has_memory_put_with_completion_handler<Client>
+    ;
 }
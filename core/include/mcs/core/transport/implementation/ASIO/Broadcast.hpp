@@ -0,0 +1,139 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <cstddef>
+#include <future>
+#include <mcs/Error.hpp>
+#include <mcs/core/memory/Size.hpp>
+#include <mcs/core/transport/Address.hpp>
+#include <mcs/util/ASIO/Connectable.hpp>
+#include <mcs/util/not_null.hpp>
+#include <vector>
+
+namespace mcs::core::transport::implementation::ASIO
+{
+  // Pipelined broadcast of a range from one provider into many
+  // providers: The targets form a tree with the source as root, each
+  // node has up to fan out children, a fan out of one forms a
+  // chain. The range is split into fragments and every target pulls
+  // the fragments one after the other from its parent, see
+  // Client::memory_copy. A target pulls a fragment as soon as its
+  // parent has stored it, so the fragments flow down the tree in a
+  // pipeline and the payload never passes through the client.
+  //
+  // The time to broadcast is about the time to transfer the range
+  // once plus the time to transfer depth many fragments.
+  //
+  struct Broadcast
+  {
+    struct FragmentSize
+    {
+      constexpr explicit FragmentSize (memory::Size) noexcept;
+      memory::Size value;
+    };
+    struct FanOut
+    {
+      constexpr explicit FanOut (std::size_t) noexcept;
+      std::size_t value;
+    };
+
+    // \note throws if fragment size or fan out are zero
+    //
+    explicit Broadcast (FragmentSize, FanOut = FanOut {2});
+
+    template<typename Client>
+      struct Target
+    {
+      // connected to the provider of the target
+      util::not_null<Client const> client;
+      util::ASIO::AnyConnectable provider;
+      Address destination;
+    };
+
+    // Copies size bytes from source, that lives in source_provider,
+    // into the destinations of all targets. The future is ready when
+    // all targets have stored all fragments or, in case of an error,
+    // when all started copies have finished.
+    //
+    // \note the clients of the targets must outlive the future
+    //
+    template<typename Client>
+      [[nodiscard]] auto operator()
+        ( util::ASIO::AnyConnectable source_provider
+        , Address source
+        , memory::Size
+        , std::vector<Target<Client>>
+        ) const -> std::future<void>
+      ;
+
+    struct Error
+    {
+      struct FragmentSizeMustBePositive : public mcs::Error
+      {
+      public:
+        MCS_ERROR_COPY_MOVE_DEFAULT (FragmentSizeMustBePositive);
+
+      private:
+        friend Broadcast;
+
+        FragmentSizeMustBePositive() noexcept;
+      };
+
+      struct FanOutMustBePositive : public mcs::Error
+      {
+      public:
+        MCS_ERROR_COPY_MOVE_DEFAULT (FanOutMustBePositive);
+
+      private:
+        friend Broadcast;
+
+        FanOutMustBePositive() noexcept;
+      };
+
+      // A copy into a target has transferred less than the fragment.
+      //
+      struct CouldNotCopyAllData : public mcs::Error
+      {
+        [[nodiscard]] auto target() const noexcept -> std::size_t;
+        [[nodiscard]] auto fragment() const noexcept -> std::size_t;
+        [[nodiscard]] auto wanted() const noexcept -> memory::Size;
+        [[nodiscard]] auto copied() const noexcept -> memory::Size;
+
+        MCS_ERROR_COPY_MOVE_DEFAULT (CouldNotCopyAllData);
+
+      private:
+        friend Broadcast;
+
+        CouldNotCopyAllData
+          ( std::size_t target
+          , std::size_t fragment
+          , memory::Size wanted
+          , memory::Size copied
+          ) noexcept;
+
+        std::size_t _target;
+        std::size_t _fragment;
+        memory::Size _wanted;
+        memory::Size _copied;
+      };
+    };
+
+  private:
+    memory::Size _fragment_size;
+    std::size_t _fan_out;
+
+    // node 0 is the source, node i > 0 is target i - 1
+    //
+    [[nodiscard]] auto parent (std::size_t node) const noexcept -> std::size_t;
+    [[nodiscard]] auto first_child
+      ( std::size_t node
+      ) const noexcept -> std::size_t
+      ;
+
+    template<typename Client> struct Run;
+  };
+}
+
+#include "detail/Broadcast.ipp"
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <concepts>
+#include <exception>
 #include <future>
 #include <mcs/core/Chunk.hpp>
 #include <mcs/core/Storages.hpp>
@@ -11,12 +12,18 @@
 #include <mcs/core/storage/Concepts.hpp>
 #include <mcs/core/transport/Address.hpp>
 #include <mcs/core/transport/implementation/ASIO/Commands.hpp>
+#include <mcs/core/transport/implementation/ASIO/Weight.hpp>
+#include <mcs/core/transport/implementation/ASIO/client/Credits.hpp>
+#include <mcs/core/transport/implementation/ASIO/client/Encoding.hpp>
+#include <mcs/core/transport/implementation/ASIO/client/Lanes.hpp>
 #include <mcs/rpc/Client.hpp>
 #include <mcs/rpc/access_policy/Exclusive.hpp>
 #include <mcs/rpc/access_policy/Sequential.hpp>
+#include <mcs/util/ASIO/Connectable.hpp>
 #include <mcs/util/ASIO/is_protocol.hpp>
 #include <mcs/util/not_null.hpp>
 #include <mcs/util/type/List.hpp>
+#include <optional>
 
 namespace mcs::core::transport::implementation::ASIO
 {
@@ -52,11 +59,24 @@ namespace mcs::core::transport::implementation::ASIO
                                         >
       ;
 
+    // With a weight the client sets the weight of its connection(s)
+    // in the scheduler of the provider, see provider::Scheduler.
+    //
+    // With an encoding the client elides zero runs in large
+    // payloads, see client::Encoding.
+    //
+    // With credits the client limits the puts in flight, see
+    // client::Credits.
+    //
     template<typename Executor>
       explicit Client
         ( Executor&
         , util::ASIO::Connectable<Protocol>
         , util::not_null<Storages<util::type::List<StorageImplementations...>>>
+        , client::Lanes = client::Lanes{}
+        , std::optional<Weight> = std::nullopt
+        , client::Encoding = client::Encoding{}
+        , client::Credits = client::Credits{}
         );
 
     auto memory_get
@@ -73,10 +93,116 @@ namespace mcs::core::transport::implementation::ASIO
       ) const -> std::future<memory::Size>
       ;
 
+    // Variants without std::future: The completion token is used
+    // with the signature
+    //
+    //   void (std::exception_ptr, memory::Size)
+    //
+    // e.g. a callback or asio::use_awaitable, then the call returns
+    // an asio::awaitable<memory::Size> that throws in case of an
+    // error. The completion handler is called via its associated
+    // executor.
+    //
+    // \note only the wait for the response is asynchronous: The
+    // payload is transferred synchronously when the operation is
+    // initiated, e.g. before a callback variant returns or when the
+    // awaitable is awaited. memory_get reads the payload into the
+    // destination, memory_put writes it, a put that is deferred by
+    // the credits is written by the thread that releases them. An
+    // initiating io thread is blocked for the transfer.
+    //
+    template<typename CompletionToken>
+      auto memory_get
+        ( Address destination
+        , Address source
+        , memory::Size
+        , CompletionToken&&
+        ) const
+        ;
+
+    template<typename CompletionToken>
+      auto memory_put
+        ( Address destination
+        , Address source
+        , memory::Size
+        , CompletionToken&&
+        ) const
+        ;
+
+    // Third party transfer: The provider of the client pulls size
+    // bytes from source, that lives in source_provider, into its
+    // local destination. The payload does not pass through the
+    // client.
+    //
+    // \note the source provider is required explicitly because an
+    // Address does not identify the provider that holds it
+    //
+    auto memory_copy
+      ( Address destination
+      , util::ASIO::AnyConnectable source_provider
+      , Address source
+      , memory::Size
+      ) const -> std::future<memory::Size>
+      ;
+
+    template<typename CompletionToken>
+      auto memory_copy
+        ( Address destination
+        , util::ASIO::AnyConnectable source_provider
+        , Address source
+        , memory::Size
+        , CompletionToken&&
+        ) const
+        ;
+
   private:
     util::not_null<Storages<util::type::List<StorageImplementations...>>>
       _storages;
 
+    // the base is the control lane, the bulk lane exists only if the
+    // lanes are separated
+    //
+    client::Lanes _lanes;
+    std::optional<Base> _bulk_lane;
+    client::Encoding _encoding;
+    client::Credits _credits;
+
+    [[nodiscard]] auto lane (memory::Size) const noexcept -> Base const&;
+
+    [[nodiscard]] auto get
+      ( Address destination
+      , Address source
+      , memory::Size
+      ) const -> command::Get
+      ;
+    // \note the Put refers to the memory of the source chunk, the
+    // chunk lives only during the execution of send
+    //
+    template<typename Send>
+      auto put
+        ( Address destination
+        , Address source
+        , memory::Size
+        , Send&&
+        ) const
+        ;
+
+    // Sends the put, the credits for size bytes must have been
+    // acquired, they are released when the put completes.
+    //
+    // \note does not throw: the credits are released exactly once
+    // and the handler is called exactly once, with the error if the
+    // put could not be sent
+    //
+    template<typename Handler>
+      auto start_put
+        ( Address destination
+        , Address source
+        , memory::Size
+        , Handler
+        ) const -> void
+      ;
+
     struct Destination final : public command::Get::Destination
     {
       explicit Destination
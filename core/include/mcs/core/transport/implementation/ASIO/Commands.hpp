@@ -3,8 +3,10 @@
 
 #pragma once
 
+#include <mcs/core/transport/implementation/ASIO/command/Copy.hpp>
 #include <mcs/core/transport/implementation/ASIO/command/Get.hpp>
 #include <mcs/core/transport/implementation/ASIO/command/Put.hpp>
+#include <mcs/core/transport/implementation/ASIO/command/SetWeight.hpp>
 #include <mcs/util/type/List.hpp>
 
 namespace mcs::core::transport::implementation::ASIO
@@ -12,5 +14,7 @@ namespace mcs::core::transport::implementation::ASIO
   using Commands = util::type::List
     < command::Get
     , command::Put
+    , command::SetWeight
+    , command::Copy
     >;
 }
@@ -3,10 +3,14 @@
 
 #pragma once
 
+#include <asio/local/stream_protocol.hpp>
 #include <mcs/core/Storages.hpp>
 #include <mcs/core/storage/Concepts.hpp>
 #include <mcs/core/transport/implementation/ASIO/Commands.hpp>
 #include <mcs/core/transport/implementation/ASIO/provider/Handler.hpp>
+#include <mcs/core/transport/implementation/ASIO/provider/Peers.hpp>
+#include <mcs/core/transport/implementation/ASIO/provider/Scheduler.hpp>
+#include <mcs/core/transport/implementation/ASIO/provider/ZeroCopy.hpp>
 #include <mcs/rpc/Concepts.hpp>
 #include <mcs/rpc/Dispatcher.hpp>
 #include <mcs/rpc/Provider.hpp>
@@ -14,6 +18,7 @@
 #include <mcs/util/ASIO/is_protocol.hpp>
 #include <mcs/util/not_null.hpp>
 #include <mcs/util/type/List.hpp>
+#include <optional>
 
 namespace mcs::core::transport::implementation::ASIO
 {
@@ -28,11 +33,23 @@ namespace mcs::core::transport::implementation::ASIO
                    , util::type::List<StorageImplementations...>
                    >
   {
+    // The zero copy path for Get responses and the scheduler are
+    // disabled by default.
+    //
+    // An ip::tcp provider listens on the local::stream_protocol
+    // endpoint same_host in addition, if it is set. The connection
+    // information includes it and clients on the same host use it,
+    // see util::ASIO::prefer_same_host.
+    //
     template<typename Executor>
       explicit Provider
          ( Executor&
          , typename Protocol::endpoint
          , util::not_null<Storages<util::type::List<StorageImplementations...>>>
+         , provider::ZeroCopy = provider::ZeroCopy{}
+         , provider::Scheduler = provider::Scheduler{}
+         , std::optional<asio::local::stream_protocol::endpoint> same_host
+             = std::nullopt
          );
 
     auto connection_information() const -> util::ASIO::Connectable<Protocol>;
@@ -43,10 +60,14 @@ namespace mcs::core::transport::implementation::ASIO
       , provider::Handler<StorageImplementations...>
       >;
 
+    provider::Peers<StorageImplementations...> _peers;
     rpc::Provider
       < Protocol
       , Dispatcher
       , util::not_null<Storages<util::type::List<StorageImplementations...>>>
+      , provider::ZeroCopy
+      , provider::Scheduler
+      , provider::Peers<StorageImplementations...>
       > _provider;
   };
 
@@ -58,6 +79,10 @@ namespace mcs::core::transport::implementation::ASIO
       ( Executor&
       , typename Protocol::endpoint
       , util::not_null<Storages<util::type::List<StorageImplementations...>>>
+      , provider::ZeroCopy = provider::ZeroCopy{}
+      , provider::Scheduler = provider::Scheduler{}
+      , std::optional<asio::local::stream_protocol::endpoint> same_host
+          = std::nullopt
       )
     ;
 }
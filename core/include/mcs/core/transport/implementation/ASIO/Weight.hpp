@@ -0,0 +1,20 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <cstdint>
+
+namespace mcs::core::transport::implementation::ASIO
+{
+  // Share of a connection in the bandwidth of a provider, relative to
+  // the other connections, see provider::Scheduler.
+  //
+  struct Weight
+  {
+    constexpr explicit Weight (std::uint32_t) noexcept;
+    std::uint32_t value;
+  };
+}
+
+#include "detail/Weight.ipp"
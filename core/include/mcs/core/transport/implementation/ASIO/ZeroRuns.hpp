@@ -0,0 +1,74 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mcs/Error.hpp>
+#include <span>
+#include <vector>
+
+namespace mcs::core::transport::implementation::ASIO
+{
+  // Zero run elision for payloads: The payload is split into
+  // fragments of fragment_size bytes (the last fragment might be
+  // shorter). The bitmap has one bit per fragment that is set if and
+  // only if the fragment contains only zeros. An encoded payload is
+  // the bitmap followed by the fragments that are not zero, the
+  // receiver fills the zero fragments of the destination.
+  //
+  struct ZeroRuns
+  {
+    static constexpr auto fragment_size {std::size_t {4} << 10};
+
+    // Scans the bytes.
+    //
+    explicit ZeroRuns (std::span<std::byte const>);
+
+    // \note throws if the size of the bitmap does not match the size
+    //
+    ZeroRuns (std::size_t size, std::vector<std::uint8_t> bitmap);
+
+    [[nodiscard]] static auto bitmap_size (std::size_t) -> std::size_t;
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t;
+    [[nodiscard]] auto bitmap() const noexcept -> std::vector<std::uint8_t> const&;
+
+    // Calls run (offset, count, is_zero) in order for all maximal
+    // runs of fragments that are either all zero or all not zero.
+    // Stops when run returns less than count. Returns the sum of all
+    // return values of run.
+    //
+    template<typename Run>
+      auto for_each_run (Run&&) const -> std::size_t;
+
+    struct Error
+    {
+      struct BitmapSizeMismatch : public mcs::Error
+      {
+        [[nodiscard]] auto bitmap_size() const noexcept -> std::size_t;
+        [[nodiscard]] auto size() const noexcept -> std::size_t;
+
+        MCS_ERROR_COPY_MOVE_DEFAULT (BitmapSizeMismatch);
+
+      private:
+        friend ZeroRuns;
+
+        BitmapSizeMismatch (std::size_t bitmap_size, std::size_t size) noexcept;
+
+        std::size_t _bitmap_size;
+        std::size_t _size;
+      };
+    };
+
+  private:
+    std::size_t _size;
+    std::vector<std::uint8_t> _bitmap;
+
+    [[nodiscard]] auto number_of_fragments() const -> std::size_t;
+    [[nodiscard]] auto is_zero (std::size_t fragment) const noexcept -> bool;
+  };
+}
+
+#include "detail/ZeroRuns.ipp"
@@ -0,0 +1,97 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <mcs/Error.hpp>
+#include <mcs/core/memory/Size.hpp>
+#include <memory>
+
+namespace mcs::core::transport::implementation::ASIO::client
+{
+  // Optional credit window for memory_put: A put starts only if,
+  // after starting it, at most bytes many bytes and at most
+  // operations many puts are in flight. A put that is larger than the
+  // window starts when no other put is in flight. Waiting puts start
+  // in the order of their calls.
+  //
+  // The backpressure surfaces to the caller: memory_put that returns
+  // a std::future blocks until the put has started, memory_put with
+  // a completion token defers the start, e.g. the awaiting coroutine
+  // is suspended without blocking its thread.
+  //
+  // Copies of credits share their state.
+  //
+  struct Credits
+  {
+    struct Bytes
+    {
+      constexpr explicit Bytes (memory::Size) noexcept;
+      memory::Size value;
+    };
+    struct Operations
+    {
+      constexpr explicit Operations (std::size_t) noexcept;
+      std::size_t value;
+    };
+
+    // Unlimited: All puts start immediately.
+    //
+    Credits() noexcept = default;
+
+    // \note throws if bytes or operations are zero
+    //
+    Credits (Bytes, Operations);
+
+    [[nodiscard]] auto are_limited() const noexcept -> bool;
+
+    // Calls start as soon as the credits for size bytes are
+    // available, either immediately in the calling thread or later
+    // in the thread that releases the credits. Starts of other
+    // callers that become possible are executed, too.
+    //
+    // \pre start does not throw, the credits are held until they are
+    // released exactly once, also if the operation fails to start
+    //
+    auto acquire (memory::Size, std::function<void()> start) const -> void;
+
+    // Blocks until the credits for size bytes are available.
+    //
+    auto acquire (memory::Size) const -> void;
+
+    auto release (memory::Size) const -> void;
+
+    struct Error
+    {
+      struct BytesMustBePositive : public mcs::Error
+      {
+      public:
+        MCS_ERROR_COPY_MOVE_DEFAULT (BytesMustBePositive);
+
+      private:
+        friend Credits;
+
+        BytesMustBePositive() noexcept;
+      };
+
+      struct OperationsMustBePositive : public mcs::Error
+      {
+      public:
+        MCS_ERROR_COPY_MOVE_DEFAULT (OperationsMustBePositive);
+
+      private:
+        friend Credits;
+
+        OperationsMustBePositive() noexcept;
+      };
+    };
+
+  private:
+    struct State;
+    std::shared_ptr<State> _state;
+  };
+}
+
+#include "detail/Credits.ipp"
@@ -0,0 +1,45 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <mcs/core/memory/Size.hpp>
+#include <optional>
+
+namespace mcs::core::transport::implementation::ASIO::client
+{
+  // Optional encoding of the payloads of memory_get and memory_put:
+  // With a threshold the payloads of transfers of at least threshold
+  // bytes elide runs of zeros, see ZeroRuns. The encoding is chosen
+  // per command, the provider decodes directly into the destination
+  // chunk and encodes the responses to encoded requests.
+  //
+  // \note Encoding costs a scan of the payload on the sender side
+  // and bypasses sendfile/splice for Files segments, it pays off
+  // when the link is slow and the data contains large zero regions.
+  //
+  struct Encoding
+  {
+    struct Threshold
+    {
+      constexpr explicit Threshold (memory::Size) noexcept;
+      memory::Size value;
+    };
+
+    // Disabled: All payloads are transferred unencoded.
+    //
+    constexpr Encoding() noexcept = default;
+
+    constexpr explicit Encoding (Threshold) noexcept;
+
+    [[nodiscard]] constexpr auto elides_zero_runs
+      ( memory::Size
+      ) const noexcept -> bool
+      ;
+
+  private:
+    std::optional<Threshold> _threshold;
+  };
+}
+
+#include "detail/Encoding.ipp"
@@ -0,0 +1,43 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <mcs/core/memory/Size.hpp>
+#include <optional>
+
+namespace mcs::core::transport::implementation::ASIO::client
+{
+  // Optional separation of small and large transfers: With a cutoff
+  // the client maintains two connections to the provider, transfers
+  // of less than cutoff bytes use the control lane, all other
+  // transfers use the bulk lane. That way a small transfer does not
+  // wait for the payload of a large transfer that has been issued
+  // before (head-of-line blocking).
+  //
+  // \note The provider serves both connections concurrently only if it
+  // runs more than one thread.
+  //
+  struct Lanes
+  {
+    struct Cutoff
+    {
+      constexpr explicit Cutoff (memory::Size) noexcept;
+      memory::Size value;
+    };
+
+    // Single lane: All transfers share one connection.
+    //
+    constexpr Lanes() noexcept = default;
+
+    constexpr explicit Lanes (Cutoff) noexcept;
+
+    [[nodiscard]] constexpr auto are_separated() const noexcept -> bool;
+    [[nodiscard]] constexpr auto is_bulk (memory::Size) const noexcept -> bool;
+
+  private:
+    std::optional<Cutoff> _cutoff;
+  };
+}
+
+#include "detail/Lanes.ipp"
@@ -0,0 +1,12 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+namespace mcs::core::transport::implementation::ASIO::client
+{
+  constexpr Credits::Bytes::Bytes (memory::Size value_) noexcept
+    : value {value_}
+  {}
+  constexpr Credits::Operations::Operations (std::size_t value_) noexcept
+    : value {value_}
+  {}
+}
@@ -0,0 +1,20 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+namespace mcs::core::transport::implementation::ASIO::client
+{
+  constexpr Encoding::Threshold::Threshold (memory::Size value_) noexcept
+    : value {value_}
+  {}
+
+  constexpr Encoding::Encoding (Threshold threshold) noexcept
+    : _threshold {threshold}
+  {}
+
+  constexpr auto Encoding::elides_zero_runs
+    ( memory::Size size
+    ) const noexcept -> bool
+  {
+    return _threshold && !(size < _threshold->value);
+  }
+}
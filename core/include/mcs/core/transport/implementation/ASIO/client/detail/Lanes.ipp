@@ -0,0 +1,23 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+namespace mcs::core::transport::implementation::ASIO::client
+{
+  constexpr Lanes::Cutoff::Cutoff (memory::Size value_) noexcept
+    : value {value_}
+  {}
+
+  constexpr Lanes::Lanes (Cutoff cutoff) noexcept
+    : _cutoff {cutoff}
+  {}
+
+  constexpr auto Lanes::are_separated() const noexcept -> bool
+  {
+    return _cutoff.has_value();
+  }
+
+  constexpr auto Lanes::is_bulk (memory::Size size) const noexcept -> bool
+  {
+    return _cutoff && !(size < _cutoff->value);
+  }
+}
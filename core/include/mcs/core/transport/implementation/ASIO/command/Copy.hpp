@@ -0,0 +1,40 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <mcs/core/memory/Size.hpp>
+#include <mcs/core/transport/Address.hpp>
+#include <mcs/serialization/declare.hpp>
+#include <mcs/util/ASIO/Connectable.hpp>
+
+namespace mcs::core::transport::implementation::ASIO::command
+{
+  // Third party transfer: The provider that executes the command pulls
+  // size bytes from source, that lives in source_provider, into the
+  // local destination. The payload does not pass through the client.
+  //
+  // The command is blocking, see rpc::command_is_blocking: Connecting
+  // to the source provider and the transfer do not stall the threads
+  // that serve the connections.
+  //
+  struct Copy
+  {
+    using Response = core::memory::Size;
+
+    static constexpr auto is_blocking {true};
+
+    core::transport::Address destination;
+    util::ASIO::AnyConnectable source_provider;
+    core::transport::Address source;
+    core::memory::Size size;
+  };
+}
+
+namespace mcs::serialization
+{
+  template<>
+    MCS_SERIALIZATION_DECLARE_NONINTRUSIVE_IMPLEMENTATION
+      (core::transport::implementation::ASIO::command::Copy)
+    ;
+}
@@ -8,6 +8,7 @@
 #include <mcs/core/transport/Address.hpp>
 #include <mcs/serialization/declare.hpp>
 #include <memory>
+#include <span>
 
 namespace mcs::core::transport::implementation::ASIO::command
 {
@@ -24,6 +25,9 @@ namespace mcs::core::transport::implementation::ASIO::command
     };
     std::unique_ptr<Destination> destination;
 
+    // the payload is encoded, see ZeroRuns
+    bool elide_zero_runs {false};
+
     template<typename Socket>
       auto stream (Socket&) const -> void;
 
@@ -6,7 +6,10 @@
 #include <cstddef>
 #include <mcs/core/memory/Size.hpp>
 #include <mcs/core/transport/Address.hpp>
+#include <mcs/core/transport/implementation/ASIO/ZeroRuns.hpp>
 #include <mcs/serialization/declare.hpp>
+#include <optional>
+#include <span>
 #include <variant>
 
 namespace mcs::core::transport::implementation::ASIO::command
@@ -21,6 +24,9 @@ namespace mcs::core::transport::implementation::ASIO::command
 
     core::transport::Address destination;
     std::variant<Bytes, std::size_t> bytes_or_size;
+
+    // if set, then the payload is encoded, see ZeroRuns
+    std::optional<ZeroRuns> zero_runs {};
   };
 }
 
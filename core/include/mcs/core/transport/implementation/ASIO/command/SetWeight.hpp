@@ -0,0 +1,19 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <cstdint>
+
+namespace mcs::core::transport::implementation::ASIO::command
+{
+  // Sets the weight of the connection in the scheduler of the
+  // provider. Ignored by providers without scheduler.
+  //
+  struct SetWeight
+  {
+    using Response = void;
+
+    std::uint32_t weight;
+  };
+}
@@ -1,10 +1,16 @@
 // Copyright (C) 2023-2025 Fraunhofer ITWM
 // License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
 
+#include <algorithm>
 #include <asio/buffer.hpp>
 #include <asio/read.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <mcs/core/memory/Size.hpp>
+#include <mcs/core/transport/implementation/ASIO/ZeroRuns.hpp>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace mcs::core::transport::implementation::ASIO::command
 {
@@ -13,7 +19,38 @@ namespace mcs::core::transport::implementation::ASIO::command
   {
     auto data {destination->data()};
     auto const bytes_read
-      {memory::make_size (asio::read (socket, asio::mutable_buffer (data)))};
+      { memory::make_size
+        ( [&]
+          {
+            if (!elide_zero_runs)
+            {
+              return asio::read (socket, asio::mutable_buffer (data));
+            }
+
+            auto bitmap
+              { std::vector<std::uint8_t>
+                  (ZeroRuns::bitmap_size (data.size()))
+              };
+            asio::read (socket, asio::buffer (bitmap));
+
+            return ZeroRuns {data.size(), std::move (bitmap)}.for_each_run
+              ( [&] (std::size_t offset, std::size_t count, bool is_zero)
+                {
+                  auto const fragments {data.subspan (offset, count)};
+
+                  if (is_zero)
+                  {
+                    std::ranges::fill (fragments, std::byte {0});
+
+                    return count;
+                  }
+
+                  return asio::read (socket, asio::mutable_buffer (fragments));
+                }
+              );
+          }()
+        )
+      };
 
     if (bytes_read != size)
     {
@@ -0,0 +1,234 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace mcs::core::transport::implementation::ASIO
+{
+  constexpr Broadcast::FragmentSize::FragmentSize (memory::Size value_) noexcept
+    : value {value_}
+  {}
+  constexpr Broadcast::FanOut::FanOut (std::size_t value_) noexcept
+    : value {value_}
+  {}
+
+  template<typename Client>
+    struct Broadcast::Run : public std::enable_shared_from_this<Run<Client>>
+  {
+    Run ( Broadcast broadcast
+        , util::ASIO::AnyConnectable source_provider
+        , Address source
+        , memory::Size size
+        , std::vector<Target<Client>> targets
+        )
+          : _broadcast {broadcast}
+          , _source_provider {source_provider}
+          , _source {source}
+          , _size {size}
+          , _targets {std::move (targets)}
+          , _number_of_fragments {divru (_size, _broadcast._fragment_size)}
+          , _stored (_targets.size() + 1, 0)
+          , _in_flight (_targets.size() + 1, false)
+          , _missing {_targets.size() * _number_of_fragments}
+    {
+      _stored.front() = _number_of_fragments;
+    }
+
+    auto start() -> std::future<void>
+    {
+      auto future {_done.get_future()};
+      auto copies {std::vector<Copy>{}};
+
+      {
+        auto const lock {std::lock_guard {_guard}};
+
+        start_children (0, copies);
+      }
+
+      if (copies.empty())
+      {
+        _done.set_value();
+      }
+
+      for (auto const& copy : copies)
+      {
+        start_copy (copy);
+      }
+
+      return future;
+    }
+
+  private:
+    struct Copy
+    {
+      std::size_t node;
+      std::size_t fragment;
+    };
+
+    Broadcast _broadcast;
+    util::ASIO::AnyConnectable _source_provider;
+    Address _source;
+    memory::Size _size;
+    std::vector<Target<Client>> _targets;
+    std::size_t _number_of_fragments;
+
+    std::mutex _guard;
+    std::vector<std::size_t> _stored;
+    std::vector<bool> _in_flight;
+    std::size_t _running {0};
+    std::size_t _missing;
+    std::exception_ptr _error;
+    std::promise<void> _done;
+
+    // Pre: _guard is locked
+    //
+    auto start (std::size_t node, std::vector<Copy>& copies) -> void
+    {
+      if (  node == 0
+         || node > _targets.size()
+         || _in_flight[node]
+         || _stored[node] == _number_of_fragments
+         || _stored[node] >= _stored[_broadcast.parent (node)]
+         )
+      {
+        return;
+      }
+
+      _in_flight[node] = true;
+      ++_running;
+      copies.emplace_back (Copy {node, _stored[node]});
+    }
+
+    // Pre: _guard is locked
+    //
+    auto start_children (std::size_t node, std::vector<Copy>& copies) -> void
+    {
+      auto const first_child {_broadcast.first_child (node)};
+
+      for ( auto child {first_child}
+          ; child < first_child + _broadcast._fan_out
+          ; ++child
+          )
+      {
+        start (child, copies);
+      }
+    }
+
+    auto start_copy (Copy copy) -> void
+    {
+      auto const begin {copy.fragment * _broadcast._fragment_size};
+      auto const size {std::min (_broadcast._fragment_size, _size - begin)};
+
+      auto const parent {_broadcast.parent (copy.node)};
+      auto const& target {_targets.at (copy.node - 1)};
+
+      auto destination {target.destination};
+      destination.offset += begin;
+      auto source {parent == 0 ? _source : _targets.at (parent - 1).destination};
+      source.offset += begin;
+
+      try
+      {
+        target.client->memory_copy
+          ( destination
+          , parent == 0 ? _source_provider : _targets.at (parent - 1).provider
+          , source
+          , size
+          , [run = this->shared_from_this(), copy, size]
+              ( std::exception_ptr error
+              , memory::Size transferred
+              )
+            {
+              run->completed (copy, size, error, transferred);
+            }
+          );
+      }
+      catch (...)
+      {
+        completed (copy, size, std::current_exception(), memory::make_size (0));
+      }
+    }
+
+    auto completed
+      ( Copy copy
+      , memory::Size expected
+      , std::exception_ptr error
+      , memory::Size transferred
+      ) -> void
+    {
+      auto copies {std::vector<Copy>{}};
+      auto finished {false};
+      auto result {std::exception_ptr{}};
+
+      {
+        auto const lock {std::lock_guard {_guard}};
+
+        _in_flight[copy.node] = false;
+        --_running;
+
+        if (!error && transferred != expected)
+        {
+          error = std::make_exception_ptr
+            ( Error::CouldNotCopyAllData
+              {copy.node - 1, copy.fragment, expected, transferred}
+            );
+        }
+
+        if (error)
+        {
+          if (!_error)
+          {
+            _error = error;
+          }
+        }
+        else
+        {
+          ++_stored[copy.node];
+          --_missing;
+
+          if (!_error)
+          {
+            start (copy.node, copies);
+            start_children (copy.node, copies);
+          }
+        }
+
+        finished = _running == 0 && (_error || _missing == 0);
+        result = _error;
+      }
+
+      for (auto const& next : copies)
+      {
+        start_copy (next);
+      }
+
+      if (finished)
+      {
+        if (result)
+        {
+          _done.set_exception (result);
+        }
+        else
+        {
+          _done.set_value();
+        }
+      }
+    }
+  };
+
+  template<typename Client>
+    auto Broadcast::operator()
+      ( util::ASIO::AnyConnectable source_provider
+      , Address source
+      , memory::Size size
+      , std::vector<Target<Client>> targets
+      ) const -> std::future<void>
+  {
+    return std::make_shared<Run<Client>>
+      (*this, source_provider, source, size, std::move (targets))->start();
+  }
+}
@@ -1,9 +1,121 @@
 // Copyright (C) 2025 Fraunhofer ITWM
 // License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
 
+#include <asio/associated_executor.hpp>
+#include <asio/async_result.hpp>
+#include <asio/dispatch.hpp>
+#include <atomic>
+#include <exception>
+#include <future>
 #include <mcs/rpc/Client.hpp>
 #include <mcs/util/ASIO/Connectable.hpp>
 #include <memory>
+#include <optional>
+#include <utility>
+
+namespace mcs::core::transport::implementation::ASIO
+{
+  namespace detail
+  {
+    // Adapts an asio completion handler with the signature
+    // void (std::exception_ptr, memory::Size) to the rpc completion
+    // handler interface.
+    //
+    template<typename Handler>
+      struct SizeCompletionHandler
+    {
+      Handler handler;
+
+      auto operator() (std::exception_ptr error) -> void
+      {
+        complete (error, memory::make_size (0));
+      }
+      auto operator() (memory::Size size) -> void
+      {
+        complete (nullptr, size);
+      }
+
+    private:
+      auto complete (std::exception_ptr error, memory::Size size) -> void
+      {
+        auto const executor {asio::get_associated_executor (handler)};
+
+        asio::dispatch
+          ( executor
+          , [handler = std::move (handler), error, size]() mutable
+            {
+              std::move (handler) (error, size);
+            }
+          );
+      }
+    };
+
+    template<typename Handler>
+      SizeCompletionHandler (Handler) -> SizeCompletionHandler<Handler>;
+
+    // Releases the credits of a put before the completion is passed
+    // on. Copies share their state: The first call releases the
+    // credits and calls the handler, later calls are ignored, e.g.
+    // when the rpc client reports an error for a call that it has
+    // already reported to the caller.
+    //
+    template<typename Handler>
+      struct ReleaseCredits
+    {
+      ReleaseCredits (client::Credits, memory::Size, Handler);
+
+      template<typename Result>
+        auto operator() (Result) -> void;
+
+    private:
+      struct State
+      {
+        client::Credits credits;
+        memory::Size size;
+        Handler handler;
+        std::atomic_flag completed;
+      };
+      std::shared_ptr<State> _state;
+    };
+
+    template<typename Handler>
+      ReleaseCredits<Handler>::ReleaseCredits
+        ( client::Credits credits
+        , memory::Size size
+        , Handler handler
+        )
+          : _state
+            { std::make_shared<State>
+                (std::move (credits), size, std::move (handler))
+            }
+    {}
+
+    template<typename Handler>
+      template<typename Result>
+        auto ReleaseCredits<Handler>::operator() (Result result) -> void
+    {
+      if (!_state->completed.test_and_set())
+      {
+        _state->credits.release (_state->size);
+        std::move (_state->handler) (std::move (result));
+      }
+    }
+
+    struct SetPromise
+    {
+      std::promise<memory::Size> promise;
+
+      auto operator() (std::exception_ptr error) -> void
+      {
+        promise.set_exception (error);
+      }
+      auto operator() (memory::Size size) -> void
+      {
+        promise.set_value (size);
+      }
+    };
+  }
+}
 
 namespace mcs::core::transport::implementation::ASIO
 {
@@ -20,6 +132,10 @@ namespace mcs::core::transport::implementation::ASIO
         , util::ASIO::Connectable<Protocol> provider_connectable
         , util::not_null<Storages<util::type::List<StorageImplementations...>>>
             storages
+        , client::Lanes lanes
+        , std::optional<Weight> weight
+        , client::Encoding encoding
+        , client::Credits credits
         )
           : Base
             { io_context
@@ -27,7 +143,49 @@ namespace mcs::core::transport::implementation::ASIO
             , std::make_shared<AccessPolicy>()
             }
           , _storages {storages}
-  {}
+          , _lanes {lanes}
+          , _bulk_lane
+            { _lanes.are_separated()
+              ? std::optional<Base>
+                { std::in_place
+                , io_context
+                , provider_connectable
+                , std::make_shared<AccessPolicy>()
+                }
+              : std::nullopt
+            }
+          , _encoding {encoding}
+          , _credits {credits}
+  {
+    if (weight)
+    {
+      Base::operator() (command::SetWeight {weight->value});
+
+      if (_bulk_lane)
+      {
+        (*_bulk_lane) (command::SetWeight {weight->value});
+      }
+    }
+  }
+
+  template< util::ASIO::is_protocol Protocol
+          , is_supported_access_policy AccessPolicy
+          , storage::is_implementation... StorageImplementations
+          >
+    auto Client< Protocol
+               , AccessPolicy
+               , util::type::List<StorageImplementations...>
+               >::lane
+      ( memory::Size size
+      ) const noexcept -> Base const&
+  {
+    if (_bulk_lane && _lanes.is_bulk (size))
+    {
+      return *_bulk_lane;
+    }
+
+    return *this;
+  }
 }
 
 namespace mcs::core::transport::implementation::ASIO
@@ -39,24 +197,23 @@ namespace mcs::core::transport::implementation::ASIO
     auto Client< Protocol
                , AccessPolicy
                , util::type::List<StorageImplementations...>
-               >::memory_get
+               >::get
       ( Address destination
       , Address source
       , memory::Size size
-      ) const -> std::future<memory::Size>
+      ) const -> command::Get
   {
-    return Base::get_future
-      ( command::Get
-          ( source
-          , size
-          , std::unique_ptr<command::Get::Destination>
-              { new Destination
-                { _storages
-                , destination
-                , size
-                }
-              }
-          )
+    return command::Get
+      ( source
+      , size
+      , std::unique_ptr<command::Get::Destination>
+          { new Destination
+            { _storages
+            , destination
+            , size
+            }
+          }
+      , _encoding.elides_zero_runs (size)
       );
   }
 
@@ -64,14 +221,16 @@ namespace mcs::core::transport::implementation::ASIO
           , is_supported_access_policy AccessPolicy
           , storage::is_implementation... StorageImplementations
           >
-    auto Client< Protocol
+    template<typename Send>
+      auto Client< Protocol
                , AccessPolicy
                , util::type::List<StorageImplementations...>
-               >::memory_put
-      ( Address destination
-      , Address source
-      , memory::Size size
-      ) const -> std::future<memory::Size>
+               >::put
+        ( Address destination
+        , Address source
+        , memory::Size size
+        , Send&& send
+        ) const
   {
     auto const chunk
       { make_chunk<chunk::access::Const>
@@ -83,11 +242,234 @@ namespace mcs::core::transport::implementation::ASIO
         )
       };
 
-    return Base::get_future
-      ( command::Put
-        { destination
-        , as<std::byte const> (chunk)
+    auto const bytes {as<std::byte const> (chunk)};
+    auto command {command::Put {destination, bytes}};
+
+    if (_encoding.elides_zero_runs (size))
+    {
+      command.zero_runs.emplace (bytes);
+    }
+
+    return std::forward<Send> (send) (std::move (command));
+  }
+}
+
+namespace mcs::core::transport::implementation::ASIO
+{
+  template< util::ASIO::is_protocol Protocol
+          , is_supported_access_policy AccessPolicy
+          , storage::is_implementation... StorageImplementations
+          >
+    auto Client< Protocol
+               , AccessPolicy
+               , util::type::List<StorageImplementations...>
+               >::memory_get
+      ( Address destination
+      , Address source
+      , memory::Size size
+      ) const -> std::future<memory::Size>
+  {
+    return lane (size).get_future (get (destination, source, size));
+  }
+
+  template< util::ASIO::is_protocol Protocol
+          , is_supported_access_policy AccessPolicy
+          , storage::is_implementation... StorageImplementations
+          >
+    auto Client< Protocol
+               , AccessPolicy
+               , util::type::List<StorageImplementations...>
+               >::memory_put
+      ( Address destination
+      , Address source
+      , memory::Size size
+      ) const -> std::future<memory::Size>
+  {
+    if (!_credits.are_limited())
+    {
+      return put
+        ( destination
+        , source
+        , size
+        , [&] (command::Put command)
+          {
+            return lane (size).get_future (std::move (command));
+          }
+        );
+    }
+
+    _credits.acquire (size);
+
+    auto promise {std::promise<memory::Size>{}};
+    auto future {promise.get_future()};
+
+    start_put
+      (destination, source, size, detail::SetPromise {std::move (promise)});
+
+    return future;
+  }
+
+  template< util::ASIO::is_protocol Protocol
+          , is_supported_access_policy AccessPolicy
+          , storage::is_implementation... StorageImplementations
+          >
+    template<typename Handler>
+      auto Client< Protocol
+               , AccessPolicy
+               , util::type::List<StorageImplementations...>
+               >::start_put
+        ( Address destination
+        , Address source
+        , memory::Size size
+        , Handler handler
+        ) const -> void
+  {
+    auto completion
+      {detail::ReleaseCredits<Handler> {_credits, size, std::move (handler)}};
+
+    try
+    {
+      put
+        ( destination
+        , source
+        , size
+        , [&] (command::Put command)
+          {
+            lane (size) (std::move (command), completion);
+          }
+        );
+    }
+    catch (...)
+    {
+      completion (std::current_exception());
+    }
+  }
+
+  template< util::ASIO::is_protocol Protocol
+          , is_supported_access_policy AccessPolicy
+          , storage::is_implementation... StorageImplementations
+          >
+    auto Client< Protocol
+               , AccessPolicy
+               , util::type::List<StorageImplementations...>
+               >::memory_copy
+      ( Address destination
+      , util::ASIO::AnyConnectable source_provider
+      , Address source
+      , memory::Size size
+      ) const -> std::future<memory::Size>
+  {
+    return lane (size).get_future
+      (command::Copy {destination, source_provider, source, size});
+  }
+}
+
+namespace mcs::core::transport::implementation::ASIO
+{
+  template< util::ASIO::is_protocol Protocol
+          , is_supported_access_policy AccessPolicy
+          , storage::is_implementation... StorageImplementations
+          >
+    template<typename CompletionToken>
+      auto Client< Protocol
+               , AccessPolicy
+               , util::type::List<StorageImplementations...>
+               >::memory_get
+        ( Address destination
+        , Address source
+        , memory::Size size
+        , CompletionToken&& token
+        ) const
+  {
+    return asio::async_initiate
+      < CompletionToken
+      , void (std::exception_ptr, memory::Size)
+      >
+      ( [this, destination, source, size] (auto handler)
+        {
+          lane (size)
+            ( get (destination, source, size)
+            , detail::SizeCompletionHandler {std::move (handler)}
+            );
+        }
+      , token
+      );
+  }
+
+  template< util::ASIO::is_protocol Protocol
+          , is_supported_access_policy AccessPolicy
+          , storage::is_implementation... StorageImplementations
+          >
+    template<typename CompletionToken>
+      auto Client< Protocol
+               , AccessPolicy
+               , util::type::List<StorageImplementations...>
+               >::memory_put
+        ( Address destination
+        , Address source
+        , memory::Size size
+        , CompletionToken&& token
+        ) const
+  {
+    return asio::async_initiate
+      < CompletionToken
+      , void (std::exception_ptr, memory::Size)
+      >
+      ( [this, destination, source, size] (auto handler)
+        {
+          //! \note std::function must be copy-constructible,
+          //! therefore the shared pointer.
+          _credits.acquire
+            ( size
+            , [ this
+              , destination
+              , source
+              , size
+              , handler = std::make_shared<decltype (handler)>
+                  (std::move (handler))
+              ]
+              {
+                start_put
+                  ( destination
+                  , source
+                  , size
+                  , detail::SizeCompletionHandler {std::move (*handler)}
+                  );
+              }
+            );
+        }
+      , token
+      );
+  }
+
+  template< util::ASIO::is_protocol Protocol
+          , is_supported_access_policy AccessPolicy
+          , storage::is_implementation... StorageImplementations
+          >
+    template<typename CompletionToken>
+      auto Client< Protocol
+               , AccessPolicy
+               , util::type::List<StorageImplementations...>
+               >::memory_copy
+        ( Address destination
+        , util::ASIO::AnyConnectable source_provider
+        , Address source
+        , memory::Size size
+        , CompletionToken&& token
+        ) const
+  {
+    return asio::async_initiate
+      < CompletionToken
+      , void (std::exception_ptr, memory::Size)
+      >
+      ( [this, destination, source_provider, source, size] (auto handler)
+        {
+          lane (size)
+            ( command::Copy {destination, source_provider, source, size}
+            , detail::SizeCompletionHandler {std::move (handler)}
+            );
         }
+      , token
       );
   }
 }
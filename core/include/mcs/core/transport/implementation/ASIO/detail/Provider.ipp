@@ -14,15 +14,25 @@ namespace mcs::core::transport::implementation::ASIO
         , typename Protocol::endpoint endpoint
         , util::not_null<Storages<util::type::List<StorageImplementations...>>>
             storages
+        , provider::ZeroCopy zero_copy
+        , provider::Scheduler scheduler
+        , std::optional<asio::local::stream_protocol::endpoint> same_host
         )
           : _provider
             { rpc::make_provider<Protocol, Dispatcher>
               ( endpoint
+              , rpc::provider::Options {.same_host = same_host}
               , executor
               , storages
+              , zero_copy
+              , scheduler
+              , _peers
               )
             }
-  {}
+  {
+    _peers.local_provider
+      (util::ASIO::AnyConnectable {connection_information()});
+  }
 
   template< util::ASIO::is_protocol Protocol
           , storage::is_implementation... StorageImplementations
@@ -33,7 +43,7 @@ namespace mcs::core::transport::implementation::ASIO
       (
       ) const -> util::ASIO::Connectable<Protocol>
   {
-    return util::ASIO::make_connectable (_provider.local_endpoint());
+    return _provider.connection_information();
   }
 }
 
@@ -48,11 +58,14 @@ namespace mcs::core::transport::implementation::ASIO
       , typename Protocol::endpoint endpoint
       , util::not_null<Storages<util::type::List<StorageImplementations...>>>
           storages
+      , provider::ZeroCopy zero_copy
+      , provider::Scheduler scheduler
+      , std::optional<asio::local::stream_protocol::endpoint> same_host
       )
   {
     return Provider< Protocol
                    , util::type::List<StorageImplementations...>
                    >
-      {executor, endpoint, storages};
+      {executor, endpoint, storages, zero_copy, scheduler, same_host};
   }
 }
@@ -0,0 +1,9 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+namespace mcs::core::transport::implementation::ASIO
+{
+  constexpr Weight::Weight (std::uint32_t value_) noexcept
+    : value {value_}
+  {}
+}
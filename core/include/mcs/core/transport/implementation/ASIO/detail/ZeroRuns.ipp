@@ -0,0 +1,41 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <algorithm>
+#include <utility>
+
+namespace mcs::core::transport::implementation::ASIO
+{
+  template<typename Run>
+    auto ZeroRuns::for_each_run (Run&& run) const -> std::size_t
+  {
+    auto done {std::size_t {0}};
+    auto fragment {std::size_t {0}};
+
+    while (fragment < number_of_fragments())
+    {
+      auto const zero {is_zero (fragment)};
+      auto end {fragment + 1};
+
+      while (end < number_of_fragments() && is_zero (end) == zero)
+      {
+        ++end;
+      }
+
+      auto const offset {fragment * fragment_size};
+      auto const count {std::min (_size, end * fragment_size) - offset};
+      auto const transferred {run (offset, count, zero)};
+
+      done += transferred;
+
+      if (transferred < count)
+      {
+        break;
+      }
+
+      fragment = end;
+    }
+
+    return done;
+  }
+}
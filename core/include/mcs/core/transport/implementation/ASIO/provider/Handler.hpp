@@ -6,18 +6,46 @@
 #include <cstdint>
 #include <mcs/Error.hpp>
 #include <mcs/core/Storages.hpp>
+#include <mcs/core/chunk/Access.hpp>
+#include <mcs/core/chunk/Description.hpp>
+#include <mcs/core/memory/Range.hpp>
+#include <mcs/core/memory/Size.hpp>
 #include <mcs/core/storage/Concepts.hpp>
+#include <mcs/core/transport/Address.hpp>
+#include <mcs/core/transport/implementation/ASIO/command/Copy.hpp>
 #include <mcs/core/transport/implementation/ASIO/command/Get.hpp>
 #include <mcs/core/transport/implementation/ASIO/command/Put.hpp>
+#include <mcs/core/transport/implementation/ASIO/command/SetWeight.hpp>
+#include <mcs/core/transport/implementation/ASIO/provider/Peers.hpp>
+#include <mcs/core/transport/implementation/ASIO/provider/Scheduler.hpp>
+#include <mcs/core/transport/implementation/ASIO/provider/ZeroCopy.hpp>
 #include <mcs/util/not_null.hpp>
 
 namespace mcs::core::transport::implementation::ASIO::provider
 {
+  // Payloads from and to segments of storage::implementation::Files
+  // are transferred between the socket and the segment file with
+  // sendfile and splice and do not pass through user space. Payloads
+  // from and to other storages are transferred via the chunk memory.
+  //
+  // Encoded payloads, see ZeroRuns, are transferred via the chunk
+  // memory for all storages.
+  //
+  // All payloads are transferred in the turns assigned by the
+  // scheduler.
+  //
+  // Copy commands are executed by pulling the data from the source
+  // provider via a cached peer connection. Copies from the provider
+  // itself are executed locally.
+  //
   template<storage::is_implementation... StorageImplementations>
     struct Handler
   {
     Handler
       ( util::not_null<Storages<util::type::List<StorageImplementations...>>>
+      , ZeroCopy
+      , Scheduler
+      , Peers<StorageImplementations...>
       );
 
     template<typename Socket>
@@ -32,6 +60,14 @@ namespace mcs::core::transport::implementation::ASIO::provider
         , Socket&
         ) const -> command::Put::Response
       ;
+    auto operator()
+      ( command::SetWeight
+      ) const -> command::SetWeight::Response
+      ;
+    auto operator()
+      ( command::Copy
+      ) const -> command::Copy::Response
+      ;
 
     struct Error
     {
@@ -88,11 +124,49 @@ namespace mcs::core::transport::implementation::ASIO::provider
         Wanted _wanted;
         Read _read;
       };
+
+      struct RangeIsNotInsideOfFile : public mcs::Error
+      {
+        [[nodiscard]] constexpr auto range() const noexcept -> memory::Range;
+        [[nodiscard]] constexpr auto file_size
+          (
+          ) const noexcept -> memory::Size
+          ;
+
+        MCS_ERROR_COPY_MOVE_DEFAULT (RangeIsNotInsideOfFile);
+
+      private:
+        template<storage::is_implementation...> friend struct Handler;
+
+        RangeIsNotInsideOfFile (memory::Range, memory::Size) noexcept;
+
+        memory::Range _range;
+        memory::Size _file_size;
+      };
     };
 
   private:
     util::not_null<Storages<util::type::List<StorageImplementations...>>>
       _storages;
+
+    template<chunk::is_access Access>
+      [[nodiscard]] auto chunk_description
+        ( Address
+        , memory::Size
+        ) const -> chunk::Description<Access, StorageImplementations...>
+      ;
+
+    // The memory path fails in memory::select when the range is not
+    // inside of the file, the file path must fail, too.
+    //
+    template<typename Description>
+      static auto require_inside_of_file (Description const&) -> void;
+
+    // \note one Handler per connection
+    //
+    mutable ZeroCopy _zero_copy;
+    mutable Scheduler::Connection _connection;
+    Peers<StorageImplementations...> _peers;
   };
 }
 
@@ -0,0 +1,116 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <asio/ip/tcp.hpp>
+#include <asio/local/stream_protocol.hpp>
+#include <cstddef>
+#include <list>
+#include <mcs/core/Storages.hpp>
+#include <mcs/core/memory/Size.hpp>
+#include <mcs/core/storage/Concepts.hpp>
+#include <mcs/core/transport/Address.hpp>
+#include <mcs/core/transport/implementation/ASIO/Client.hpp>
+#include <mcs/rpc/ScopedRunningIOContext.hpp>
+#include <mcs/rpc/access_policy/Exclusive.hpp>
+#include <mcs/util/ASIO/Connectable.hpp>
+#include <mcs/util/not_null.hpp>
+#include <mcs/util/type/List.hpp>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <variant>
+
+namespace mcs::core::transport::implementation::ASIO::provider
+{
+  // Cache of connections to other providers, used to execute third
+  // party transfers. A connection is used by one transfer at a time,
+  // a transfer takes an idle connection or creates a new one and puts
+  // the connection back into the cache once the transfer has
+  // succeeded. Connections that have failed are dropped. At most
+  // capacity many connections are kept idle, the least recently used
+  // one is closed first.
+  //
+  // The transfers block the calling thread, see command::Copy, the
+  // responses of the peers are received by a thread of the cache.
+  //
+  // Copies of Peers share the cache.
+  //
+  template<storage::is_implementation... StorageImplementations>
+    struct Peers
+  {
+    struct Capacity
+    {
+      constexpr explicit Capacity (std::size_t) noexcept;
+      std::size_t value;
+    };
+
+    explicit Peers (Capacity = Capacity {16});
+
+    // Transfers size bytes from source in provider into the local
+    // destination.
+    //
+    auto memory_get
+      ( util::not_null<Storages<util::type::List<StorageImplementations...>>>
+      , util::ASIO::AnyConnectable provider
+      , Address destination
+      , Address source
+      , memory::Size
+      ) const -> memory::Size
+      ;
+
+    // The provider that owns the cache. A transfer from it must not
+    // go through a peer connection, see Handler.
+    //
+    auto local_provider (util::ASIO::AnyConnectable) const -> void;
+    [[nodiscard]] auto is_local_provider
+      ( util::ASIO::AnyConnectable const&
+      ) const -> bool
+      ;
+
+  private:
+    template<util::ASIO::is_protocol Protocol>
+      using PeerClient = Client
+        < Protocol
+        , rpc::access_policy::Exclusive
+        , util::type::List<StorageImplementations...>
+        >;
+    using AnyPeerClient = std::variant
+      < PeerClient<asio::ip::tcp>
+      , PeerClient<asio::local::stream_protocol>
+      >;
+
+    struct Idle
+    {
+      util::ASIO::AnyConnectable provider;
+      std::unique_ptr<AnyPeerClient> client;
+    };
+
+    struct State
+    {
+      explicit State (Capacity);
+
+      std::size_t const capacity;
+      // \note before the clients: they are destroyed first
+      rpc::ScopedRunningIOContext io_context;
+      std::mutex guard;
+      std::optional<util::ASIO::AnyConnectable> local_provider;
+      // most recently used first
+      std::list<Idle> idle;
+    };
+    std::shared_ptr<State> _state;
+
+    [[nodiscard]] auto take
+      ( util::ASIO::AnyConnectable const&
+      ) const -> std::unique_ptr<AnyPeerClient>
+      ;
+    auto put_back
+      ( util::ASIO::AnyConnectable
+      , std::unique_ptr<AnyPeerClient>
+      ) const -> void
+      ;
+  };
+}
+
+#include "detail/Peers.ipp"
@@ -0,0 +1,146 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mcs/Error.hpp>
+#include <mcs/core/memory/Size.hpp>
+#include <mcs/core/transport/implementation/ASIO/Weight.hpp>
+#include <memory>
+
+namespace mcs::core::transport::implementation::ASIO::provider
+{
+  // Optional weighted fair sharing of the bandwidth of the provider:
+  // The payloads of Get and Put are transferred in slices and before
+  // each slice the connection waits for its turn. Waiting connections
+  // take turns in round robin order, per turn a connection transfers
+  // at most weight * quantum bytes. At most concurrency slices are in
+  // flight at the same time, across all connections of all providers
+  // that share the scheduler.
+  //
+  // The weight of a connection is 1 unless the client sets it, see
+  // command::SetWeight.
+  //
+  // Copies of a scheduler share their state.
+  //
+  // \note Waiting for the turn blocks the thread that executes the
+  // handler. A provider with a single thread has at most one waiting
+  // connection, for it the scheduler only slices the transfers.
+  //
+  struct Scheduler
+  {
+    struct Quantum
+    {
+      constexpr explicit Quantum (memory::Size) noexcept;
+      memory::Size value;
+    };
+    struct Concurrency
+    {
+      constexpr explicit Concurrency (std::size_t) noexcept;
+      std::size_t value;
+    };
+
+    // Disabled: All payloads are transferred in one go.
+    //
+    Scheduler() noexcept = default;
+
+    // \note throws if quantum or concurrency are zero
+    //
+    explicit Scheduler (Quantum, Concurrency = Concurrency {1});
+
+  private:
+    struct State;
+
+  public:
+    struct Connection
+    {
+      // \note throws if the weight is zero
+      //
+      auto weight (Weight) -> void;
+
+      // Calls transfer (offset, count) until size bytes have been
+      // transferred or until transfer returns less than count.
+      // Returns the number of bytes transferred.
+      //
+      template<typename Transfer>
+        auto transfer (std::size_t size, Transfer&&) -> std::size_t;
+
+      Connection (Connection const&) = delete;
+      Connection (Connection&&) noexcept = default;
+      auto operator= (Connection const&) -> Connection& = delete;
+      auto operator= (Connection&&) noexcept -> Connection& = default;
+      ~Connection() noexcept = default;
+
+    private:
+      friend struct Scheduler;
+
+      using ID = std::uint64_t;
+
+      Connection (std::shared_ptr<State>, ID) noexcept;
+
+      std::shared_ptr<State> _state;
+      ID _id;
+      Weight _weight {1};
+
+      struct Turn
+      {
+        explicit Turn (Connection const&);
+        [[nodiscard]] auto budget() const noexcept -> std::size_t;
+
+        Turn (Turn const&) = delete;
+        Turn (Turn&&) = delete;
+        auto operator= (Turn const&) -> Turn& = delete;
+        auto operator= (Turn&&) -> Turn& = delete;
+        ~Turn() noexcept;
+
+      private:
+        Connection const& _connection;
+      };
+    };
+
+    [[nodiscard]] auto connect() -> Connection;
+
+    struct Error
+    {
+      struct QuantumMustBePositive : public mcs::Error
+      {
+      public:
+        MCS_ERROR_COPY_MOVE_DEFAULT (QuantumMustBePositive);
+
+      private:
+        friend Scheduler;
+
+        QuantumMustBePositive() noexcept;
+      };
+
+      struct ConcurrencyMustBePositive : public mcs::Error
+      {
+      public:
+        MCS_ERROR_COPY_MOVE_DEFAULT (ConcurrencyMustBePositive);
+
+      private:
+        friend Scheduler;
+
+        ConcurrencyMustBePositive() noexcept;
+      };
+
+      struct WeightMustBePositive : public mcs::Error
+      {
+      public:
+        MCS_ERROR_COPY_MOVE_DEFAULT (WeightMustBePositive);
+
+      private:
+        friend Connection;
+
+        WeightMustBePositive() noexcept;
+      };
+    };
+
+  private:
+    std::shared_ptr<State> _state;
+  };
+}
+
+#include "detail/Scheduler.ipp"
@@ -0,0 +1,75 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <cstddef>
+#include <mcs/core/memory/Size.hpp>
+#include <optional>
+#include <span>
+
+namespace mcs::core::transport::implementation::ASIO::provider
+{
+  // Optional zero copy path for the payload of Get responses: Payloads
+  // of at least threshold bytes are sent with MSG_ZEROCOPY, the
+  // kernel then transmits directly from the storage memory instead of
+  // copying it into socket buffers first.
+  //
+  // write returns only after the kernel has reported, via the error
+  // queue of the socket, that it has released all pages. That keeps
+  // the chunk alive for as long as the kernel references its memory.
+  //
+  // write blocks the io thread that executes the Get, just like the
+  // copying asio::write does: It waits in poll until the socket is
+  // writable and until the kernel has sent the notifications. A peer
+  // that stops reading therefore parks the thread and stalls all other
+  // connections that are served by the same io_context. More threads
+  // or rpc::PerCoreIOContexts limit the number of stalled connections.
+  //
+  // Falls back to the copying asio::write automatically: for payloads
+  // below the threshold, for sockets other than ip::tcp, for sockets
+  // that do not support SO_ZEROCOPY and, per send, if the kernel can
+  // not pin more pages.
+  //
+  // \note Zero copy pays off for large payloads only: Pinning pages
+  // and waiting for the notification is more expensive than copying a
+  // few kilobytes. For loopback connections the kernel copies anyway.
+  //
+  struct ZeroCopy
+  {
+    struct Threshold
+    {
+      constexpr explicit Threshold (memory::Size) noexcept;
+      memory::Size value;
+    };
+
+    // Disabled: All payloads are copied.
+    //
+    constexpr ZeroCopy() noexcept = default;
+
+    constexpr explicit ZeroCopy (Threshold) noexcept;
+
+    template<typename Socket>
+      [[nodiscard]] auto write
+        ( Socket&
+        , std::span<std::byte const>
+        ) -> std::size_t
+      ;
+
+  private:
+    std::optional<Threshold> _threshold;
+
+    enum class Support
+    {
+      Unknown,
+      Enabled,
+      Unavailable,
+    };
+    Support _support {Support::Unknown};
+
+    [[nodiscard]] auto is_enabled (int) -> bool;
+    [[nodiscard]] auto send (int, std::span<std::byte const>) -> std::size_t;
+  };
+}
+
+#include "detail/ZeroCopy.ipp"
@@ -1,20 +1,46 @@
 // Copyright (C) 2025 Fraunhofer ITWM
 // License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
 
+#include <algorithm>
 #include <asio/buffer.hpp>
 #include <asio/read.hpp>
 #include <asio/write.hpp>
+#include <cstddef>
+#include <cstring>
 #include <fmt/format.h>
 #include <functional>
 #include <mcs/core/Chunk.hpp>
+#include <mcs/core/memory/Offset.hpp>
 #include <mcs/core/memory/Range.hpp>
 #include <mcs/core/memory/Size.hpp>
+#include <mcs/core/storage/implementation/Files.hpp>
+#include <mcs/core/transport/implementation/ASIO/ZeroRuns.hpp>
 #include <mcs/util/ASIO/Connectable.hpp>
 #include <mcs/util/ASIO/connected_socket.hpp>
+#include <mcs/util/Copy.hpp>
+#include <mcs/util/cast.hpp>
 #include <memory>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <variant>
+
+namespace mcs::core::transport::implementation::ASIO::provider::detail
+{
+  template<typename Description>
+    concept is_files_chunk_description
+      =  std::is_same_v
+           < Description
+           , storage::implementation::Files::Chunk::Description
+               <chunk::access::Const>
+           >
+      || std::is_same_v
+           < Description
+           , storage::implementation::Files::Chunk::Description
+               <chunk::access::Mutable>
+           >
+      ;
+}
 
 namespace mcs::core::transport::implementation::ASIO::provider
 {
@@ -22,10 +48,42 @@ namespace mcs::core::transport::implementation::ASIO::provider
     Handler<StorageImplementations...>::Handler
       ( util::not_null<Storages<util::type::List<StorageImplementations...>>>
           storages
+      , ZeroCopy zero_copy
+      , Scheduler scheduler
+      , Peers<StorageImplementations...> peers
       )
         : _storages {storages}
+        , _zero_copy {zero_copy}
+        , _connection {scheduler.connect()}
+        , _peers {peers}
   {}
 
+  template<storage::is_implementation... StorageImplementations>
+    template<chunk::is_access Access>
+      auto Handler<StorageImplementations...>::chunk_description
+        ( Address address
+        , memory::Size size
+        ) const -> chunk::Description<Access, StorageImplementations...>
+  {
+    return _storages->visit
+      ( _storages->read_access()
+      , address.storage_id
+      , [&]<storage::is_implementation StorageImplementation>
+          ( StorageImplementation const& implementation
+          ) -> chunk::Description<Access, StorageImplementations...>
+        {
+          using Parameter = StorageImplementation::Parameter;
+
+          return implementation.template chunk_description<Access>
+            ( address.storage_parameter_chunk_description
+              .template as<typename Parameter::Chunk::Description>()
+            , address.segment_id
+            , memory::make_range (address.offset, size)
+            );
+        }
+      );
+  }
+
   template<storage::is_implementation... StorageImplementations>
     template<typename Socket>
       auto Handler<StorageImplementations...>::operator()
@@ -33,27 +91,98 @@ namespace mcs::core::transport::implementation::ASIO::provider
         , Socket& socket
         ) const -> command::Get::Response
   {
-    auto const chunk
-      { make_chunk<chunk::access::Const>
-        ( _storages
-        , get.source.storage_id
-        , get.source.storage_parameter_chunk_description
-        , get.source.segment_id
-        , memory::make_range (get.source.offset, get.size)
+    auto const bytes_written
+      { std::visit
+        ( [&]<typename Description>
+            ( Description const& description
+            ) -> std::size_t
+          {
+            if (get.elide_zero_runs)
+            {
+              // the encoding needs to scan the bytes, all storages
+              // use the chunk memory
+              auto const chunk
+                { Chunk<chunk::access::Const, StorageImplementations...>
+                    {description}
+                };
+              auto const data {chunk.data()};
+              auto const zero_runs {ZeroRuns {data}};
+
+              asio::write (socket, asio::buffer (zero_runs.bitmap()));
+
+              return zero_runs.for_each_run
+                ( [&] (std::size_t offset, std::size_t count, bool is_zero)
+                  {
+                    if (is_zero)
+                    {
+                      return count;
+                    }
+
+                    return _connection.transfer
+                      ( count
+                      , [&] (std::size_t slice, std::size_t slice_count)
+                        {
+                          return _zero_copy.write
+                            (socket, data.subspan (offset + slice, slice_count));
+                        }
+                      );
+                  }
+                );
+            }
+
+            if constexpr (detail::is_files_chunk_description<Description>)
+            {
+              require_inside_of_file (description);
+
+              return _connection.transfer
+                ( size_cast<std::size_t> (size (description.range))
+                , [&] (std::size_t offset, std::size_t count)
+                  {
+                    return util::Copy{}
+                      ( util::copy::FileReadLocation
+                        { description.path
+                        , make_off_t (begin (description.range))
+                        + util::cast<off_t> (offset)
+                        }
+                      , util::copy::SocketWriteLocation
+                          {socket.native_handle()}
+                      , count
+                      );
+                  }
+                );
+            }
+            else
+            {
+              auto const chunk
+                { Chunk<chunk::access::Const, StorageImplementations...>
+                    {description}
+                };
+              auto const data {chunk.data()};
+
+              return _connection.transfer
+                ( data.size()
+                , [&] (std::size_t offset, std::size_t count)
+                  {
+                    return _zero_copy.write
+                      (socket, data.subspan (offset, count));
+                  }
+                );
+            }
+          }
+        , chunk_description<chunk::access::Const> (get.source, get.size)
         )
       };
-    auto const data {chunk.data()};
-    auto const bytes_written {asio::write (socket, asio::buffer (data))};
 
-    if (bytes_written != data.size())
+    if (memory::make_size (bytes_written) != get.size)
     {
       throw typename Error::CouldNotWriteAllData
-        { typename Error::CouldNotWriteAllData::Wanted {data.size()}
+        { typename Error::CouldNotWriteAllData::Wanted
+            {size_cast<std::size_t> (get.size)}
         , typename Error::CouldNotWriteAllData::Written {bytes_written}
         };
     }
 
-    return memory::make_size (data.size());
+    return get.size;
   }
 
   template<storage::is_implementation... StorageImplementations>
@@ -64,19 +193,90 @@ namespace mcs::core::transport::implementation::ASIO::provider
         ) const -> command::Put::Response
   {
     auto const size {std::get<std::size_t> (put.bytes_or_size)};
-    auto const chunk
-      { make_chunk<chunk::access::Mutable>
-        ( _storages
-        , put.destination.storage_id
-        , put.destination.storage_parameter_chunk_description
-        , put.destination.segment_id
-        , memory::make_range (put.destination.offset, memory::make_size (size))
+    auto const bytes_read
+      { std::visit
+        ( [&]<typename Description>
+            ( Description const& description
+            ) -> std::size_t
+          {
+            if (put.zero_runs)
+            {
+              auto const chunk
+                { Chunk<chunk::access::Mutable, StorageImplementations...>
+                    {description}
+                };
+              auto const sink {as<std::byte> (chunk)};
+
+              return put.zero_runs->for_each_run
+                ( [&] (std::size_t offset, std::size_t count, bool is_zero)
+                  {
+                    auto const fragments {sink.subspan (offset, count)};
+
+                    if (is_zero)
+                    {
+                      std::ranges::fill (fragments, std::byte {0});
+
+                      return count;
+                    }
+
+                    return _connection.transfer
+                      ( count
+                      , [&] (std::size_t slice, std::size_t slice_count)
+                        {
+                          return asio::read
+                            ( socket
+                            , asio::buffer
+                                (fragments.data() + slice, slice_count)
+                            );
+                        }
+                      );
+                  }
+                );
+            }
+
+            if constexpr (detail::is_files_chunk_description<Description>)
+            {
+              require_inside_of_file (description);
+
+              return _connection.transfer
+                ( size
+                , [&] (std::size_t offset, std::size_t count)
+                  {
+                    return util::Copy{}
+                      ( util::copy::SocketReadLocation
+                          {socket.native_handle()}
+                      , util::copy::FileWriteLocation
+                        { description.path
+                        , make_off_t (begin (description.range))
+                        + util::cast<off_t> (offset)
+                        }
+                      , count
+                      );
+                  }
+                );
+            }
+            else
+            {
+              auto const chunk
+                { Chunk<chunk::access::Mutable, StorageImplementations...>
+                    {description}
+                };
+              auto const sink {as<std::byte> (chunk)};
+
+              return _connection.transfer
+                ( size
+                , [&] (std::size_t offset, std::size_t count)
+                  {
+                    return asio::read
+                      (socket, asio::buffer (sink.data() + offset, count));
+                  }
+                );
+            }
+          }
+        , chunk_description<chunk::access::Mutable>
+            (put.destination, memory::make_size (size))
         )
       };
-    auto const sink {as<std::byte> (chunk)};
-
-    auto const bytes_read
-      {asio::read (socket, asio::buffer (sink.data(), size))};
 
     if (bytes_read != size)
     {
@@ -89,6 +289,64 @@ namespace mcs::core::transport::implementation::ASIO::provider
     return memory::make_size (size);
   }
 
+  template<storage::is_implementation... StorageImplementations>
+    auto Handler<StorageImplementations...>::operator()
+      ( command::SetWeight set_weight
+      ) const -> command::SetWeight::Response
+  {
+    _connection.weight (Weight {set_weight.weight});
+  }
+
+  template<storage::is_implementation... StorageImplementations>
+    auto Handler<StorageImplementations...>::operator()
+      ( command::Copy copy
+      ) const -> command::Copy::Response
+  {
+    if (!_peers.is_local_provider (copy.source_provider))
+    {
+      return _peers.memory_get
+        ( _storages
+        , copy.source_provider
+        , copy.destination
+        , copy.source
+        , copy.size
+        );
+    }
+
+    auto const source
+      { Chunk<chunk::access::Const, StorageImplementations...>
+          {chunk_description<chunk::access::Const> (copy.source, copy.size)}
+      };
+    auto const destination
+      { Chunk<chunk::access::Mutable, StorageImplementations...>
+          { chunk_description<chunk::access::Mutable>
+              (copy.destination, copy.size)
+          }
+      };
+    auto const bytes {source.data()};
+
+    // \note source and destination might overlap
+    std::memmove
+      (as<std::byte> (destination).data(), bytes.data(), bytes.size());
+
+    return copy.size;
+  }
+
+  template<storage::is_implementation... StorageImplementations>
+    template<typename Description>
+      auto Handler<StorageImplementations...>::require_inside_of_file
+        ( Description const& description
+        ) -> void
+  {
+    if ( memory::make_offset (0) + description.file_size
+       < end (description.range)
+       )
+    {
+      throw typename Error::RangeIsNotInsideOfFile
+        {description.range, description.file_size};
+    }
+  }
+
   template<storage::is_implementation... StorageImplementations>
     Handler<StorageImplementations...>::Error::CouldNotWriteAllData::CouldNotWriteAllData
       ( Wanted wanted
@@ -185,4 +443,40 @@ namespace mcs::core::transport::implementation::ASIO::provider
   {
     return _read;
   }
+
+  template<storage::is_implementation... StorageImplementations>
+    Handler<StorageImplementations...>::Error::RangeIsNotInsideOfFile::RangeIsNotInsideOfFile
+      ( memory::Range range
+      , memory::Size file_size
+      ) noexcept
+        : mcs::Error
+          { fmt::format
+            ( "mcs::core::transport::implementation::ASIO::provider::Handler::RangeIsNotInsideOfFile:"
+              " range: {}, file size: {}"
+            , range
+            , file_size
+            )
+          }
+        , _range {range}
+        , _file_size {file_size}
+  {}
+  template<storage::is_implementation... StorageImplementations>
+    Handler<StorageImplementations...>::Error::RangeIsNotInsideOfFile::~RangeIsNotInsideOfFile
+      (
+      ) = default
+    ;
+  template<storage::is_implementation... StorageImplementations>
+    constexpr auto Handler<StorageImplementations...>::Error::RangeIsNotInsideOfFile::range
+      (
+      ) const noexcept -> memory::Range
+  {
+    return _range;
+  }
+  template<storage::is_implementation... StorageImplementations>
+    constexpr auto Handler<StorageImplementations...>::Error::RangeIsNotInsideOfFile::file_size
+      (
+      ) const noexcept -> memory::Size
+  {
+    return _file_size;
+  }
 }
@@ -0,0 +1,161 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <mcs/util/cast.hpp>
+#include <utility>
+
+namespace mcs::core::transport::implementation::ASIO::provider
+{
+  template<storage::is_implementation... StorageImplementations>
+    constexpr Peers<StorageImplementations...>::Capacity::Capacity
+      ( std::size_t value_
+      ) noexcept
+        : value {value_}
+  {}
+
+  template<storage::is_implementation... StorageImplementations>
+    Peers<StorageImplementations...>::State::State (Capacity capacity_)
+      : capacity {capacity_.value}
+      , io_context {rpc::ScopedRunningIOContext::NumberOfThreads {1u}}
+  {}
+
+  template<storage::is_implementation... StorageImplementations>
+    Peers<StorageImplementations...>::Peers (Capacity capacity)
+      : _state {std::make_shared<State> (capacity)}
+  {}
+
+  template<storage::is_implementation... StorageImplementations>
+    auto Peers<StorageImplementations...>::local_provider
+      ( util::ASIO::AnyConnectable provider
+      ) const -> void
+  {
+    auto const lock {std::lock_guard {_state->guard}};
+
+    _state->local_provider = std::move (provider);
+  }
+
+  template<storage::is_implementation... StorageImplementations>
+    auto Peers<StorageImplementations...>::is_local_provider
+      ( util::ASIO::AnyConnectable const& provider
+      ) const -> bool
+  {
+    auto const local_provider
+      { [&]
+        {
+          auto const lock {std::lock_guard {_state->guard}};
+
+          return _state->local_provider;
+        }()
+      };
+
+    return local_provider
+      && (  provider == *local_provider
+         ||    util::ASIO::prefer_same_host (provider)
+            == util::ASIO::prefer_same_host (*local_provider)
+         );
+  }
+
+  template<storage::is_implementation... StorageImplementations>
+    auto Peers<StorageImplementations...>::take
+      ( util::ASIO::AnyConnectable const& provider
+      ) const -> std::unique_ptr<AnyPeerClient>
+  {
+    auto const lock {std::lock_guard {_state->guard}};
+
+    auto idle
+      { std::ranges::find_if
+          ( _state->idle
+          , [&] (auto const& candidate)
+            {
+              return candidate.provider == provider;
+            }
+          )
+      };
+
+    if (idle == std::end (_state->idle))
+    {
+      return nullptr;
+    }
+
+    auto client {std::move (idle->client)};
+    _state->idle.erase (idle);
+
+    return client;
+  }
+
+  template<storage::is_implementation... StorageImplementations>
+    auto Peers<StorageImplementations...>::put_back
+      ( util::ASIO::AnyConnectable provider
+      , std::unique_ptr<AnyPeerClient> client
+      ) const -> void
+  {
+    // \note evicted connections are closed outside of the lock
+    auto evicted {std::list<Idle>{}};
+
+    auto const lock {std::lock_guard {_state->guard}};
+
+    _state->idle.emplace_front (std::move (provider), std::move (client));
+
+    if (_state->idle.size() > _state->capacity)
+    {
+      evicted.splice
+        ( std::end (evicted)
+        , _state->idle
+        , std::next
+            ( std::begin (_state->idle)
+            , util::cast<std::ptrdiff_t> (_state->capacity)
+            )
+        , std::end (_state->idle)
+        );
+    }
+  }
+
+  template<storage::is_implementation... StorageImplementations>
+    auto Peers<StorageImplementations...>::memory_get
+      ( util::not_null<Storages<util::type::List<StorageImplementations...>>>
+          storages
+      , util::ASIO::AnyConnectable provider
+      , Address destination
+      , Address source
+      , memory::Size size
+      ) const -> memory::Size
+  {
+    auto client {take (provider)};
+
+    if (!client)
+    {
+      client = util::ASIO::run
+        ( provider
+        , [&]<util::ASIO::is_protocol Protocol>
+            ( util::ASIO::Connectable<Protocol> connectable
+            )
+          {
+            return std::make_unique<AnyPeerClient>
+              ( std::in_place_type<PeerClient<Protocol>>
+              , _state->io_context
+              , connectable
+              , storages
+              );
+          }
+        );
+    }
+
+    // \note a client that has failed is not put back
+    auto const transferred
+      { std::visit
+        ( [&] (auto const& peer_client)
+          {
+            return peer_client.memory_get (destination, source, size).get();
+          }
+        , *client
+        )
+      };
+
+    put_back (std::move (provider), std::move (client));
+
+    return transferred;
+  }
+}
@@ -0,0 +1,45 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <algorithm>
+#include <utility>
+
+namespace mcs::core::transport::implementation::ASIO::provider
+{
+  constexpr Scheduler::Quantum::Quantum (memory::Size value_) noexcept
+    : value {value_}
+  {}
+  constexpr Scheduler::Concurrency::Concurrency (std::size_t value_) noexcept
+    : value {value_}
+  {}
+
+  template<typename Transfer>
+    auto Scheduler::Connection::transfer
+      ( std::size_t size
+      , Transfer&& transfer
+      ) -> std::size_t
+  {
+    if (!_state)
+    {
+      return std::forward<Transfer> (transfer) (std::size_t {0}, size);
+    }
+
+    auto transferred {std::size_t {0}};
+
+    while (transferred < size)
+    {
+      auto const turn {Turn {*this}};
+      auto const count {std::min (size - transferred, turn.budget())};
+      auto const bytes {transfer (transferred, count)};
+
+      transferred += bytes;
+
+      if (bytes < count)
+      {
+        break;
+      }
+    }
+
+    return transferred;
+  }
+}
@@ -0,0 +1,38 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <asio/buffer.hpp>
+#include <asio/ip/tcp.hpp>
+#include <asio/write.hpp>
+#include <type_traits>
+
+namespace mcs::core::transport::implementation::ASIO::provider
+{
+  constexpr ZeroCopy::Threshold::Threshold (memory::Size value_) noexcept
+    : value {value_}
+  {}
+
+  constexpr ZeroCopy::ZeroCopy (Threshold threshold) noexcept
+    : _threshold {threshold}
+  {}
+
+  template<typename Socket>
+    auto ZeroCopy::write
+      ( Socket& socket
+      , std::span<std::byte const> data
+      ) -> std::size_t
+  {
+    if constexpr (std::is_same_v<typename Socket::protocol_type, asio::ip::tcp>)
+    {
+      if (  _threshold
+         && !(memory::make_size (data.size()) < _threshold->value)
+         && is_enabled (socket.native_handle())
+         )
+      {
+        return send (socket.native_handle(), data);
+      }
+    }
+
+    return asio::write (socket, asio::buffer (data));
+  }
+}
@@ -0,0 +1,100 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <fmt/format.h>
+#include <mcs/core/transport/implementation/ASIO/Broadcast.hpp>
+
+namespace mcs::core::transport::implementation::ASIO
+{
+  Broadcast::Broadcast (FragmentSize fragment_size, FanOut fan_out)
+    : _fragment_size {fragment_size.value}
+    , _fan_out {fan_out.value}
+  {
+    if (_fragment_size == memory::make_size (0))
+    {
+      throw Error::FragmentSizeMustBePositive{};
+    }
+
+    if (_fan_out == 0)
+    {
+      throw Error::FanOutMustBePositive{};
+    }
+  }
+
+  auto Broadcast::parent (std::size_t node) const noexcept -> std::size_t
+  {
+    return (node - 1) / _fan_out;
+  }
+
+  auto Broadcast::first_child (std::size_t node) const noexcept -> std::size_t
+  {
+    return node * _fan_out + 1;
+  }
+}
+
+namespace mcs::core::transport::implementation::ASIO
+{
+  Broadcast::Error::FragmentSizeMustBePositive::FragmentSizeMustBePositive
+    (
+    ) noexcept
+      : mcs::Error {"Fragment size of the broadcast must be positive."}
+  {}
+  Broadcast::Error::FragmentSizeMustBePositive::~FragmentSizeMustBePositive
+    (
+    ) = default;
+
+  Broadcast::Error::FanOutMustBePositive::FanOutMustBePositive
+    (
+    ) noexcept
+      : mcs::Error {"Fan out of the broadcast must be positive."}
+  {}
+  Broadcast::Error::FanOutMustBePositive::~FanOutMustBePositive() = default;
+
+  Broadcast::Error::CouldNotCopyAllData::CouldNotCopyAllData
+    ( std::size_t target
+    , std::size_t fragment
+    , memory::Size wanted
+    , memory::Size copied
+    ) noexcept
+      : mcs::Error
+        { fmt::format
+          ( "mcs::core::transport::implementation::ASIO::Broadcast::CouldNotCopyAllData:"
+            " target: {}, fragment: {}, wanted: {}, copied: {}"
+          , target
+          , fragment
+          , wanted
+          , copied
+          )
+        }
+      , _target {target}
+      , _fragment {fragment}
+      , _wanted {wanted}
+      , _copied {copied}
+  {}
+  Broadcast::Error::CouldNotCopyAllData::~CouldNotCopyAllData() = default;
+
+  auto Broadcast::Error::CouldNotCopyAllData::target
+    (
+    ) const noexcept -> std::size_t
+  {
+    return _target;
+  }
+  auto Broadcast::Error::CouldNotCopyAllData::fragment
+    (
+    ) const noexcept -> std::size_t
+  {
+    return _fragment;
+  }
+  auto Broadcast::Error::CouldNotCopyAllData::wanted
+    (
+    ) const noexcept -> memory::Size
+  {
+    return _wanted;
+  }
+  auto Broadcast::Error::CouldNotCopyAllData::copied
+    (
+    ) const noexcept -> memory::Size
+  {
+    return _copied;
+  }
+}
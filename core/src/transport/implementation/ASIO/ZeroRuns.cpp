@@ -0,0 +1,137 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fmt/format.h>
+#include <mcs/core/transport/implementation/ASIO/ZeroRuns.hpp>
+#include <mcs/util/divru.hpp>
+#include <utility>
+
+namespace mcs::core::transport::implementation::ASIO
+{
+  namespace
+  {
+    // Or-reduction of blocks of 64 bytes: One branch per block
+    // instead of one per byte. Stops at the first block that is not
+    // zero.
+    //
+    auto is_all_zero (std::span<std::byte const> bytes) noexcept -> bool
+    {
+      using Word = std::uint64_t;
+      auto constexpr words_per_block {std::size_t {8}};
+      auto constexpr block_size {words_per_block * sizeof (Word)};
+
+      auto position {std::size_t {0}};
+
+      for (; position + block_size <= bytes.size(); position += block_size)
+      {
+        auto block {std::array<Word, words_per_block>{}};
+        std::memcpy (block.data(), bytes.data() + position, block_size);
+
+        auto any {Word {0}};
+
+        for (auto word : block)
+        {
+          any |= word;
+        }
+
+        if (any != 0)
+        {
+          return false;
+        }
+      }
+
+      return std::ranges::all_of
+        ( bytes.subspan (position)
+        , [] (auto byte) noexcept { return byte == std::byte {0}; }
+        );
+    }
+  }
+
+  ZeroRuns::ZeroRuns (std::span<std::byte const> bytes)
+    : _size {bytes.size()}
+    , _bitmap (bitmap_size (_size), std::uint8_t {0})
+  {
+    for (auto fragment {std::size_t {0}}; fragment < number_of_fragments(); ++fragment)
+    {
+      auto const offset {fragment * fragment_size};
+
+      if (is_all_zero
+           (bytes.subspan (offset, std::min (fragment_size, _size - offset)))
+         )
+      {
+        _bitmap[fragment / 8] |= static_cast<std::uint8_t> (1u << (fragment % 8));
+      }
+    }
+  }
+
+  ZeroRuns::ZeroRuns (std::size_t size, std::vector<std::uint8_t> bitmap)
+    : _size {size}
+    , _bitmap {std::move (bitmap)}
+  {
+    if (_bitmap.size() != bitmap_size (_size))
+    {
+      throw Error::BitmapSizeMismatch {_bitmap.size(), _size};
+    }
+  }
+
+  auto ZeroRuns::bitmap_size (std::size_t size) -> std::size_t
+  {
+    return util::divru (util::divru (size, fragment_size), std::size_t {8});
+  }
+
+  auto ZeroRuns::size() const noexcept -> std::size_t
+  {
+    return _size;
+  }
+
+  auto ZeroRuns::bitmap() const noexcept -> std::vector<std::uint8_t> const&
+  {
+    return _bitmap;
+  }
+
+  auto ZeroRuns::number_of_fragments() const -> std::size_t
+  {
+    return util::divru (_size, fragment_size);
+  }
+
+  auto ZeroRuns::is_zero (std::size_t fragment) const noexcept -> bool
+  {
+    return ((_bitmap[fragment / 8] >> (fragment % 8)) & 1u) != 0u;
+  }
+}
+
+namespace mcs::core::transport::implementation::ASIO
+{
+  ZeroRuns::Error::BitmapSizeMismatch::BitmapSizeMismatch
+    ( std::size_t bitmap_size
+    , std::size_t size
+    ) noexcept
+      : mcs::Error
+        { fmt::format
+          ( "mcs::core::transport::implementation::ASIO::ZeroRuns::BitmapSizeMismatch:"
+            " bitmap of size {} does not match payload of size {}"
+          , bitmap_size
+          , size
+          )
+        }
+      , _bitmap_size {bitmap_size}
+      , _size {size}
+  {}
+  ZeroRuns::Error::BitmapSizeMismatch::~BitmapSizeMismatch() = default;
+
+  auto ZeroRuns::Error::BitmapSizeMismatch::bitmap_size
+    (
+    ) const noexcept -> std::size_t
+  {
+    return _bitmap_size;
+  }
+  auto ZeroRuns::Error::BitmapSizeMismatch::size
+    (
+    ) const noexcept -> std::size_t
+  {
+    return _size;
+  }
+}
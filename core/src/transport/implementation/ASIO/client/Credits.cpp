@@ -0,0 +1,167 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <deque>
+#include <functional>
+#include <future>
+#include <mcs/core/transport/implementation/ASIO/client/Credits.hpp>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace mcs::core::transport::implementation::ASIO::client
+{
+  struct Credits::State
+  {
+    State (Bytes, Operations) noexcept;
+
+    struct Waiting
+    {
+      memory::Size size;
+      std::function<void()> start;
+    };
+
+    // Return the starts that can be executed now, in order.
+    //
+    [[nodiscard]] auto acquire (Waiting) -> std::vector<Waiting>;
+    [[nodiscard]] auto release (memory::Size) -> std::vector<Waiting>;
+
+  private:
+    memory::Size const _bytes;
+    std::size_t const _operations;
+
+    std::mutex _guard;
+    memory::Size _bytes_in_flight {memory::make_size (0)};
+    std::size_t _operations_in_flight {0};
+    std::deque<Waiting> _waiting;
+
+    // Pre: _guard is locked
+    //
+    [[nodiscard]] auto take_startable() -> std::vector<Waiting>;
+  };
+
+  Credits::State::State (Bytes bytes, Operations operations) noexcept
+    : _bytes {bytes.value}
+    , _operations {operations.value}
+  {}
+
+  auto Credits::State::acquire (Waiting waiting) -> std::vector<Waiting>
+  {
+    auto const lock {std::lock_guard {_guard}};
+
+    _waiting.emplace_back (std::move (waiting));
+
+    return take_startable();
+  }
+
+  auto Credits::State::release (memory::Size size) -> std::vector<Waiting>
+  {
+    auto const lock {std::lock_guard {_guard}};
+
+    _bytes_in_flight -= size;
+    --_operations_in_flight;
+
+    return take_startable();
+  }
+
+  auto Credits::State::take_startable() -> std::vector<Waiting>
+  {
+    auto startable {std::vector<Waiting>{}};
+
+    while (  !_waiting.empty()
+          && _operations_in_flight < _operations
+          && (  _operations_in_flight == 0
+             || !(_bytes < _bytes_in_flight + _waiting.front().size)
+             )
+          )
+    {
+      _bytes_in_flight += _waiting.front().size;
+      ++_operations_in_flight;
+
+      startable.emplace_back (std::move (_waiting.front()));
+      _waiting.pop_front();
+    }
+
+    return startable;
+  }
+}
+
+namespace mcs::core::transport::implementation::ASIO::client
+{
+  Credits::Credits (Bytes bytes, Operations operations)
+    : _state {std::make_shared<State> (bytes, operations)}
+  {
+    if (bytes.value == memory::make_size (0))
+    {
+      throw Error::BytesMustBePositive{};
+    }
+
+    if (operations.value == 0)
+    {
+      throw Error::OperationsMustBePositive{};
+    }
+  }
+
+  auto Credits::are_limited() const noexcept -> bool
+  {
+    return !!_state;
+  }
+
+  auto Credits::acquire
+    ( memory::Size size
+    , std::function<void()> start
+    ) const -> void
+  {
+    if (!_state)
+    {
+      return start();
+    }
+
+    for (auto& waiting : _state->acquire ({size, std::move (start)}))
+    {
+      waiting.start();
+    }
+  }
+
+  auto Credits::acquire (memory::Size size) const -> void
+  {
+    auto started {std::promise<void>{}};
+
+    acquire (size, [&] { started.set_value(); });
+
+    started.get_future().wait();
+  }
+
+  auto Credits::release (memory::Size size) const -> void
+  {
+    if (!_state)
+    {
+      return;
+    }
+
+    for (auto& waiting : _state->release (size))
+    {
+      waiting.start();
+    }
+  }
+}
+
+namespace mcs::core::transport::implementation::ASIO::client
+{
+  Credits::Error::BytesMustBePositive::BytesMustBePositive
+    (
+    ) noexcept
+      : mcs::Error {"Bytes of the credits must be positive."}
+  {}
+  Credits::Error::BytesMustBePositive::~BytesMustBePositive() = default;
+
+  Credits::Error::OperationsMustBePositive::OperationsMustBePositive
+    (
+    ) noexcept
+      : mcs::Error {"Operations of the credits must be positive."}
+  {}
+  Credits::Error::OperationsMustBePositive::~OperationsMustBePositive
+    (
+    ) = default;
+}
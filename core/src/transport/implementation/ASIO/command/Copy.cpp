@@ -0,0 +1,38 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <mcs/core/transport/implementation/ASIO/command/Copy.hpp>
+#include <mcs/serialization/define.hpp>
+
+namespace mcs::serialization
+{
+  MCS_SERIALIZATION_DEFINE_NONINTRUSIVE_IMPLEMENTATION_OUTPUT
+    ( oa
+    , copy
+    , core::transport::implementation::ASIO::command::Copy
+    )
+  {
+    MCS_SERIALIZATION_SAVE_FIELD (oa, copy, destination);
+    MCS_SERIALIZATION_SAVE_FIELD (oa, copy, source_provider);
+    MCS_SERIALIZATION_SAVE_FIELD (oa, copy, source);
+    MCS_SERIALIZATION_SAVE_FIELD (oa, copy, size);
+
+    return oa;
+  }
+
+  MCS_SERIALIZATION_DEFINE_NONINTRUSIVE_IMPLEMENTATION_INPUT
+    ( ia
+    , core::transport::implementation::ASIO::command::Copy
+    )
+  {
+    namespace ASIO = core::transport::implementation::ASIO;
+    using Copy = ASIO::command::Copy;
+
+    MCS_SERIALIZATION_LOAD_FIELD (ia, destination, Copy);
+    MCS_SERIALIZATION_LOAD_FIELD (ia, source_provider, Copy);
+    MCS_SERIALIZATION_LOAD_FIELD (ia, source, Copy);
+    MCS_SERIALIZATION_LOAD_FIELD (ia, size, Copy);
+
+    return Copy {destination, source_provider, source, size};
+  }
+}
@@ -35,6 +35,7 @@ namespace mcs::serialization
   {
     MCS_SERIALIZATION_SAVE_FIELD (oa, get, source);
     MCS_SERIALIZATION_SAVE_FIELD (oa, get, size);
+    MCS_SERIALIZATION_SAVE_FIELD (oa, get, elide_zero_runs);
 
     return oa;
   }
@@ -49,7 +50,8 @@ namespace mcs::serialization
 
     MCS_SERIALIZATION_LOAD_FIELD (ia, source, Get);
     MCS_SERIALIZATION_LOAD_FIELD (ia, size, Get);
+    MCS_SERIALIZATION_LOAD_FIELD (ia, elide_zero_runs, Get);
 
-    return Get {source, size, nullptr};
+    return Get {source, size, nullptr, elide_zero_runs};
   }
 }
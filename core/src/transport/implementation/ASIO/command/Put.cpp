@@ -1,8 +1,14 @@
 // Copyright (C) 2023-2025 Fraunhofer ITWM
 // License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
 
+#include <cstddef>
+#include <cstdint>
 #include <mcs/core/transport/implementation/ASIO/command/Put.hpp>
+#include <mcs/serialization/STD/vector.hpp>
 #include <mcs/serialization/define.hpp>
+#include <span>
+#include <tuple>
+#include <vector>
 
 namespace mcs::core::transport::implementation::ASIO::command
 {
@@ -42,7 +48,29 @@ namespace mcs::serialization
     // save the number of bytes in the archive and stream the bytes
     // through the channel
     save (oa, bytes.size());
-    oa.stream (std::span {bytes.data(), bytes.size()});
+    save (oa, put.zero_runs.has_value());
+
+    if (!put.zero_runs)
+    {
+      oa.stream (std::span {bytes.data(), bytes.size()});
+
+      return oa;
+    }
+
+    // encoded: the bitmap is part of the archive, only the fragments
+    // that are not zero are streamed
+    save (oa, put.zero_runs->bitmap());
+    std::ignore = put.zero_runs->for_each_run
+      ( [&] (std::size_t offset, std::size_t count, bool is_zero)
+        {
+          if (!is_zero)
+          {
+            oa.stream (bytes.subspan (offset, count));
+          }
+
+          return count;
+        }
+      );
 
     return oa;
   }
@@ -63,7 +91,13 @@ namespace mcs::serialization
     // prepare a local buffer with the appropriate size to store all
     // the bytes from the channel.
     auto size {load<std::size_t> (ia)};
+    auto put {Put {destination, size}};
+
+    if (load<bool> (ia))
+    {
+      put.zero_runs.emplace (size, load<std::vector<std::uint8_t>> (ia));
+    }
 
-    return Put {destination, size};
+    return put;
   }
 }
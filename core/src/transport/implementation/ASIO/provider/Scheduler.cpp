@@ -0,0 +1,166 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <condition_variable>
+#include <deque>
+#include <mcs/core/transport/implementation/ASIO/provider/Scheduler.hpp>
+#include <mutex>
+#include <utility>
+
+namespace mcs::core::transport::implementation::ASIO::provider
+{
+  struct Scheduler::State
+  {
+    State (Quantum, Concurrency) noexcept;
+
+    [[nodiscard]] auto connect() -> Connection::ID;
+
+    auto acquire (Connection::ID) -> void;
+    auto release() noexcept -> void;
+
+    std::size_t const quantum;
+
+  private:
+    std::size_t const _concurrency;
+
+    std::mutex _guard;
+    std::condition_variable _turn_changed;
+    Connection::ID _next_id {0};
+    std::size_t _in_flight {0};
+    std::deque<Connection::ID> _waiting;
+  };
+
+  Scheduler::State::State
+    ( Quantum quantum_
+    , Concurrency concurrency
+    ) noexcept
+      : quantum {size_cast<std::size_t> (quantum_.value)}
+      , _concurrency {concurrency.value}
+  {}
+
+  auto Scheduler::State::connect() -> Connection::ID
+  {
+    auto const lock {std::lock_guard {_guard}};
+
+    return _next_id++;
+  }
+
+  auto Scheduler::State::acquire (Connection::ID id) -> void
+  {
+    auto lock {std::unique_lock {_guard}};
+
+    _waiting.push_back (id);
+
+    _turn_changed.wait
+      ( lock
+      , [&]
+        {
+          return _in_flight < _concurrency && _waiting.front() == id;
+        }
+      );
+
+    _waiting.pop_front();
+    ++_in_flight;
+
+    // the next waiting connection might use another free slot
+    _turn_changed.notify_all();
+  }
+
+  auto Scheduler::State::release() noexcept -> void
+  {
+    {
+      auto const lock {std::lock_guard {_guard}};
+
+      --_in_flight;
+    }
+
+    _turn_changed.notify_all();
+  }
+}
+
+namespace mcs::core::transport::implementation::ASIO::provider
+{
+  Scheduler::Scheduler (Quantum quantum, Concurrency concurrency)
+    : _state {std::make_shared<State> (quantum, concurrency)}
+  {
+    if (quantum.value == memory::make_size (0))
+    {
+      throw Error::QuantumMustBePositive{};
+    }
+
+    if (concurrency.value == 0)
+    {
+      throw Error::ConcurrencyMustBePositive{};
+    }
+  }
+
+  auto Scheduler::connect() -> Connection
+  {
+    if (!_state)
+    {
+      return Connection {nullptr, Connection::ID {0}};
+    }
+
+    return Connection {_state, _state->connect()};
+  }
+
+  Scheduler::Connection::Connection
+    ( std::shared_ptr<State> state
+    , ID id
+    ) noexcept
+      : _state {std::move (state)}
+      , _id {id}
+  {}
+
+  auto Scheduler::Connection::weight (Weight weight) -> void
+  {
+    if (weight.value == 0)
+    {
+      throw Error::WeightMustBePositive{};
+    }
+
+    _weight = weight;
+  }
+
+  Scheduler::Connection::Turn::Turn (Connection const& connection)
+    : _connection {connection}
+  {
+    _connection._state->acquire (_connection._id);
+  }
+
+  Scheduler::Connection::Turn::~Turn() noexcept
+  {
+    _connection._state->release();
+  }
+
+  auto Scheduler::Connection::Turn::budget() const noexcept -> std::size_t
+  {
+    return _connection._weight.value * _connection._state->quantum;
+  }
+}
+
+namespace mcs::core::transport::implementation::ASIO::provider
+{
+  Scheduler::Error::QuantumMustBePositive::QuantumMustBePositive
+    (
+    ) noexcept
+      : mcs::Error {"Quantum of the scheduler must be positive."}
+  {}
+  Scheduler::Error::QuantumMustBePositive::~QuantumMustBePositive() = default;
+
+  Scheduler::Error::ConcurrencyMustBePositive::ConcurrencyMustBePositive
+    (
+    ) noexcept
+      : mcs::Error {"Concurrency of the scheduler must be positive."}
+  {}
+  Scheduler::Error::ConcurrencyMustBePositive::~ConcurrencyMustBePositive
+    (
+    ) = default;
+
+  Scheduler::Error::WeightMustBePositive::WeightMustBePositive
+    (
+    ) noexcept
+      : mcs::Error {"Weight of a connection must be positive."}
+  {}
+  Scheduler::Error::WeightMustBePositive::~WeightMustBePositive() = default;
+}
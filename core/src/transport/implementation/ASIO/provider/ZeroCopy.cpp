@@ -0,0 +1,151 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <linux/errqueue.h>
+#include <mcs/core/transport/implementation/ASIO/provider/ZeroCopy.hpp>
+#include <mcs/util/cast.hpp>
+#include <mcs/util/syscall/poll.hpp>
+#include <mcs/util/syscall/recvmsg.hpp>
+#include <mcs/util/syscall/send_zerocopy_with_fallback_to_copy.hpp>
+#include <mcs/util/syscall/setsockopt.hpp>
+#include <netinet/in.h>
+#include <tuple>
+
+namespace mcs::core::transport::implementation::ASIO::provider
+{
+  namespace
+  {
+    auto wait_for (int fd, short events) -> short
+    {
+      auto pfd {pollfd {fd, events, 0}};
+
+      std::ignore = util::syscall::poll (&pfd, 1, -1);
+
+      return pfd.revents;
+    }
+
+    // Reads one notification from the error queue. Returns the number
+    // of MSG_ZEROCOPY sends that are reported to be completed. The
+    // kernel merges consecutive completions into a single range.
+    //
+    auto reap_notifications (int fd) -> std::size_t
+    {
+      alignas (cmsghdr) auto control
+        {std::array<char, CMSG_SPACE (sizeof (sock_extended_err))>{}};
+      auto message {msghdr{}};
+      message.msg_control = control.data();
+      message.msg_controllen = control.size();
+
+      std::ignore = util::syscall::recvmsg (fd, &message, MSG_ERRQUEUE);
+
+      auto completed {std::size_t {0}};
+
+      for ( auto cmsg {CMSG_FIRSTHDR (&message)}
+          ; cmsg != nullptr
+          ; cmsg = CMSG_NXTHDR (&message, cmsg)
+          )
+      {
+        if (  (cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_RECVERR)
+           || (cmsg->cmsg_level == SOL_IPV6 && cmsg->cmsg_type == IPV6_RECVERR)
+           )
+        {
+          auto error {sock_extended_err{}};
+          std::memcpy (&error, CMSG_DATA (cmsg), sizeof (error));
+
+          if (error.ee_errno == 0 && error.ee_origin == SO_EE_ORIGIN_ZEROCOPY)
+          {
+            // [ee_info, ee_data] is the range of completed sends
+            //
+            completed += error.ee_data - error.ee_info + 1u;
+          }
+        }
+      }
+
+      return completed;
+    }
+  }
+
+  auto ZeroCopy::is_enabled (int fd) -> bool
+  {
+    if (_support == Support::Unknown)
+    {
+      try
+      {
+        auto const one {int {1}};
+
+        util::syscall::setsockopt
+          (fd, SOL_SOCKET, SO_ZEROCOPY, &one, sizeof (one));
+
+        _support = Support::Enabled;
+      }
+      catch (...)
+      {
+        // e.g. kernels before 4.14
+        //
+        _support = Support::Unavailable;
+      }
+    }
+
+    return _support == Support::Enabled;
+  }
+
+  auto ZeroCopy::send
+    ( int fd
+    , std::span<std::byte const> data
+    ) -> std::size_t
+  {
+    auto sent {std::size_t {0}};
+    auto outstanding {std::size_t {0}};
+
+    // \note the socket is in non-blocking mode as soon as asio has
+    // used it asynchronously, so wait for it to become writable
+    // before each send, and collect the notifications on the way to
+    // not let the error queue grow
+    //
+    while (sent < data.size())
+    {
+      auto const events {wait_for (fd, POLLOUT)};
+
+      if (events & POLLERR)
+      {
+        outstanding -= std::min (outstanding, reap_notifications (fd));
+
+        if (!(events & POLLOUT))
+        {
+          continue;
+        }
+      }
+
+      auto const result
+        { util::syscall::send_zerocopy_with_fallback_to_copy
+            ( fd
+            , data.subspan (sent).data()
+            , data.size() - sent
+            , MSG_NOSIGNAL
+            )
+        };
+
+      sent += util::cast<std::size_t> (result.bytes);
+
+      if (result.is_zerocopy)
+      {
+        ++outstanding;
+      }
+    }
+
+    // The kernel might still reference the pages: Wait until it has
+    // released all of them. POLLERR is always reported.
+    //
+    while (outstanding > 0)
+    {
+      std::ignore = wait_for (fd, 0);
+
+      outstanding -= std::min (outstanding, reap_notifications (fd));
+    }
+
+    return sent;
+  }
+}
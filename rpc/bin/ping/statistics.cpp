@@ -0,0 +1,70 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include "Dispatcher.hpp"
+#include <csignal>
+#include <cstdlib>
+#include <filesystem>
+#include <fmt/format.h>
+#include <mcs/rpc/Concepts.hpp>
+#include <mcs/rpc/ScopedRunningIOContext.hpp>
+#include <mcs/rpc/Statistics.hpp>
+#include <mcs/rpc/access_policy/Exclusive.hpp>
+#include <mcs/util/ASIO/Connectable.hpp>
+#include <mcs/util/main.hpp>
+#include <mcs/util/read/read.hpp>
+#include <memory>
+#include <stdexcept>
+
+namespace
+{
+  auto statistics_main (mcs::util::Args args) -> int
+  {
+    if (args.size() != 2)
+    {
+      throw std::invalid_argument
+        { fmt::format ("usage: {} ping_service_path", args[0])
+        };
+    }
+
+    auto const ping_service_path {std::filesystem::path (args[1])};
+
+    return mcs::util::ASIO::run
+      ( mcs::util::read::from_file<mcs::util::ASIO::AnyConnectable>
+          (ping_service_path / "SERVER")
+      , [&]<mcs::util::ASIO::is_protocol Protocol>
+          (mcs::util::ASIO::Connectable<Protocol> connectable)
+        {
+          auto io_context
+            { mcs::rpc::ScopedRunningIOContext
+              { mcs::rpc::ScopedRunningIOContext::NumberOfThreads {1u}
+              , SIGINT, SIGTERM
+              }
+            };
+
+          using Client = typename mcs::rpc::ping::Dispatcher
+            ::template StatisticsClientType
+              < Protocol
+              , mcs::rpc::access_policy::Exclusive
+              >;
+
+          auto const client
+            { Client
+              { io_context
+              , connectable
+              , std::make_shared<mcs::rpc::access_policy::Exclusive>()
+              }
+            };
+
+          fmt::print ("{}", client (mcs::rpc::GetStatistics{}));
+
+          return EXIT_SUCCESS;
+        }
+     );
+  }
+}
+
+auto main (int argc, char const** argv) noexcept -> int
+{
+  return mcs::util::main (argc, argv, statistics_main);
+}
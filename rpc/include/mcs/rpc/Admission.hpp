@@ -0,0 +1,81 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <mcs/Error.hpp>
+
+namespace mcs::rpc
+{
+  // Limits the number of requests a provider executes at the same
+  // time. A connection with max requests per connection many requests
+  // in flight is not read until one of them has been answered. A
+  // request that would exceed max requests waits until a request of
+  // any connection has been answered, its connection is not read in
+  // the meantime. The provider holds at most one request per
+  // connection that waits for admission.
+  //
+  // The default does not limit.
+  //
+  // \note handlers that wait for later requests of the same
+  // connection or of other connections can deadlock with limits
+  //
+  struct Admission
+  {
+    struct MaxRequestsPerConnection
+    {
+      constexpr explicit MaxRequestsPerConnection (std::size_t) noexcept;
+      std::size_t value;
+    };
+    struct MaxRequests
+    {
+      constexpr explicit MaxRequests (std::size_t) noexcept;
+      std::size_t value;
+    };
+
+    Admission() noexcept = default;
+
+    // \note throws if one of the limits is zero
+    //
+    Admission (MaxRequestsPerConnection, MaxRequests);
+
+    [[nodiscard]] auto max_requests_per_connection
+      (
+      ) const noexcept -> std::size_t;
+    [[nodiscard]] auto max_requests() const noexcept -> std::size_t;
+
+    struct Error
+    {
+      struct MaxRequestsPerConnectionMustBePositive : public mcs::Error
+      {
+      public:
+        MCS_ERROR_COPY_MOVE_DEFAULT (MaxRequestsPerConnectionMustBePositive);
+
+      private:
+        friend Admission;
+
+        MaxRequestsPerConnectionMustBePositive() noexcept;
+      };
+
+      struct MaxRequestsMustBePositive : public mcs::Error
+      {
+      public:
+        MCS_ERROR_COPY_MOVE_DEFAULT (MaxRequestsMustBePositive);
+
+      private:
+        friend Admission;
+
+        MaxRequestsMustBePositive() noexcept;
+      };
+    };
+
+  private:
+    std::size_t _max_requests_per_connection
+      {std::numeric_limits<std::size_t>::max()};
+    std::size_t _max_requests {std::numeric_limits<std::size_t>::max()};
+  };
+}
+
+#include "detail/Admission.ipp"
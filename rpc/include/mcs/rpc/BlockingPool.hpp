@@ -0,0 +1,54 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <cstddef>
+#include <mcs/Error.hpp>
+
+namespace mcs::rpc
+{
+  // The threads that execute the blocking commands of a provider, see
+  // command_is_blocking. The provider starts the pool only if the
+  // dispatcher has blocking commands. The pool is shared by all
+  // connections, at most number of threads many blocking commands
+  // are executed at the same time, more are queued.
+  //
+  // The default uses 4 threads.
+  //
+  struct BlockingPool
+  {
+    struct NumberOfThreads
+    {
+      constexpr explicit NumberOfThreads (std::size_t) noexcept;
+      std::size_t value;
+    };
+
+    BlockingPool() noexcept = default;
+
+    // \note throws if number of threads is zero
+    //
+    explicit BlockingPool (NumberOfThreads);
+
+    [[nodiscard]] auto number_of_threads() const noexcept -> std::size_t;
+
+    struct Error
+    {
+      struct NumberOfThreadsMustBePositive : public mcs::Error
+      {
+      public:
+        MCS_ERROR_COPY_MOVE_DEFAULT (NumberOfThreadsMustBePositive);
+
+      private:
+        friend BlockingPool;
+
+        NumberOfThreadsMustBePositive() noexcept;
+      };
+    };
+
+  private:
+    std::size_t _number_of_threads {4};
+  };
+}
+
+#include "detail/BlockingPool.ipp"
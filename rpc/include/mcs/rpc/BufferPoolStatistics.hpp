@@ -0,0 +1,26 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <cstddef>
+
+namespace mcs::rpc
+{
+  // Counts the buffers for incoming messages. Every buffer is either
+  // reused, allocated or oversized. Oversized buffers are larger than
+  // the largest size class and are never pooled.
+  //
+  struct BufferPoolStatistics
+  {
+    std::size_t reused {0};
+    std::size_t allocated {0};
+    std::size_t oversized {0};
+    // returned into the pool
+    std::size_t returned {0};
+    // deleted on return because the pool was full
+    std::size_t dropped {0};
+    // currently held by the pool
+    std::size_t pooled_bytes {0};
+  };
+}
@@ -6,6 +6,7 @@
 #include <cstdint>
 #include <functional>
 #include <future>
+#include <mcs/rpc/BufferPoolStatistics.hpp>
 #include <mcs/rpc/Concepts.hpp>
 #include <mcs/rpc/access_policy/Concurrent.hpp>
 #include <mcs/rpc/access_policy/Exclusive.hpp>
@@ -51,9 +52,10 @@ namespace mcs::rpc
   // client may reach the server side.
   //
   // Costs:
-  // - some locks per remote call.
+  // - some locks per remote call, the completions are stored and
+  //   taken without lock.
   // - Space: O(number_of_parallel_operations)
-  // - Time: O(log (number_of_parallel_operations)) per remote call
+  // - Time: O(1) per remote call
   //
   // The asynchronous calls are never blocking, the synchronous
   // calls are always blocking. The order in which the calls arrive
@@ -62,6 +64,12 @@ namespace mcs::rpc
   // available before the result of an early asynchronous call has
   // been retrieved.
   //
+  // The calls are queued in the order of their call ids and are
+  // written by one thread at a time: Calls that are queued while
+  // another thread writes are sent by that thread, gathered into a
+  // single write. If a write fails, then all pending calls complete
+  // with the error.
+  //
   static_assert (is_access_policy<access_policy::Concurrent>);
 
   template< is_protocol Protocol
@@ -122,6 +130,41 @@ namespace mcs::rpc
         ( Command&&
         ) const -> typename Command::Response;
 
+    // deliver the response to a completion handler, no future is
+    // involved: The handler is called exactly once, by the thread
+    // that receives the response, either with the response or with
+    // the exception that prevented the response
+    //
+    // Allocations per call:
+    // - none for the completion if the handler is at most
+    //   detail::Completion::InPlaceSize bytes and nothrow movable,
+    //   one otherwise. The calls that return a future or a response
+    //   allocate the shared state of the std::promise instead.
+    // - none for the completion storage of the access policy.
+    // - one for the queued call if the access policy is Concurrent.
+    // - none for the response buffer in the steady state, see
+    //   buffer_pool_statistics.
+    // - the frames of the receive coroutine, they are recycled by
+    //   asio per thread.
+    //
+    template<is_command Command, typename Handler>
+      requires ( is_one_of_the_commands<Command, Commands...>
+              && is_completion_handler_for_command<Handler, Command>
+               )
+      auto operator()
+        ( std::reference_wrapper<Command const>
+        , Handler
+        ) const -> void;
+
+    template<is_command Command, typename Handler>
+      requires ( is_one_of_the_commands<Command, Commands...>
+              && is_completion_handler_for_command<Handler, Command>
+               )
+      auto operator()
+        ( Command&&
+        , Handler
+        ) const -> void;
+
     // Produces a new client that adds an Observer to the access policy.
     //
     template<is_access_policy_observer Observer, typename... ObserverArgs>
@@ -131,6 +174,14 @@ namespace mcs::rpc
         ) const noexcept (std::is_nothrow_constructible_v<Observer, ObserverArgs...>)
       ;
 
+    // The buffers for responses are pooled per connection, the
+    // statistics are shared by all clients that share the connection.
+    //
+    [[nodiscard]] auto buffer_pool_statistics
+      (
+      ) const noexcept -> BufferPoolStatistics
+      ;
+
     // Construction, use make_client
     //
     template<typename Executor>
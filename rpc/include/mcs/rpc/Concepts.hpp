@@ -40,6 +40,18 @@ namespace mcs::rpc
           {command.stream (socket)} -> std::convertible_to<void>;
         };
 
+  // Blocking commands are executed by the provider on a separate
+  // pool of threads, see BlockingPool, and do not stall the threads
+  // that serve the connections, e.g. if their handler does blocking
+  // system calls. A command declares itself blocking by
+  //
+  //   static constexpr auto is_blocking {true};
+  //
+  // \note the handler of a blocking command can not use the socket
+  //
+  template<typename Command>
+    concept command_is_blocking = requires { requires Command::is_blocking; };
+
   template<typename Command, typename... Commands>
     concept is_one_of_the_commands =
       (std::is_same_v<Command, Commands> || ...)
@@ -71,6 +83,22 @@ namespace mcs::rpc
       || handler::provides_awaitable_response<Handler, Command, Args...>
       ;
 
+  // A completion handler receives either the response of the
+  // command or the exception that prevented the response.
+  //
+  template<typename Handler, typename Command>
+    concept is_completion_handler_for_command = is_command<Command>
+    && std::move_constructible<Handler>
+    && std::invocable<Handler&, std::exception_ptr>
+    && (  ( std::is_same_v<typename Command::Response, void>
+         && std::invocable<Handler&>
+          )
+       || ( !std::is_same_v<typename Command::Response, void>
+         && std::invocable<Handler&, typename Command::Response>
+          )
+       )
+    ;
+
   template<typename Handler, typename... Commands>
     concept is_handler_for_commands =
       ( (  is_handler_for_command<Handler, Commands>
@@ -3,15 +3,24 @@
 
 #pragma once
 
+#include <array>
 #include <asio/awaitable.hpp>
+#include <asio/thread_pool.hpp>
+#include <cstddef>
 #include <cstdint>
 #include <mcs/rpc/Client.hpp>
 #include <mcs/rpc/Concepts.hpp>
+#include <mcs/rpc/MultiConnectionClient.hpp>
+#include <mcs/rpc/Statistics.hpp>
 #include <mcs/rpc/detail/Buffer.hpp>
 #include <mcs/rpc/detail/CallID.hpp>
 #include <mcs/rpc/detail/CommandIndex.hpp>
 #include <mcs/rpc/detail/ResultHolder.hpp>
 #include <mcs/rpc/detail/ResultOrError.hpp>
+#include <mcs/rpc/detail/StatisticsCounters.hpp>
+#include <mcs/util/trace/Context.hpp>
+#include <memory>
+#include <optional>
 #include <tuple>
 #include <type_traits>
 
@@ -26,12 +35,38 @@ namespace mcs::rpc
     template<is_protocol Protocol, is_access_policy AccessPolicy>
       using ClientType = Client<Protocol, AccessPolicy, Commands...>;
 
+    template< is_protocol Protocol
+            , is_access_policy AccessPolicy
+            , multi_connection::is_distribution Distribution
+            >
+      using MultiConnectionClientType = MultiConnectionClient
+        < Protocol
+        , AccessPolicy
+        , Distribution
+        , Commands...
+        >;
+
+    // Clients that can call GetStatistics in addition to all
+    // Commands.
+    //
+    template<is_protocol Protocol, is_access_policy AccessPolicy>
+      using StatisticsClientType
+        = Client<Protocol, AccessPolicy, Commands..., GetStatistics>;
+
     struct Header
     {
       detail::CallID call_id;
       detail::CommandIndex index;
+      // The trace context of the caller, not traced unless the caller
+      // has been traced, see util::trace. Synchronous handlers are
+      // invoked with the context of their span as util::trace::current.
+      //
+      util::trace::Context trace;
     };
 
+    // The Commands followed by the built-in GetStatistics. Clients
+    // that do not know about GetStatistics still send a prefix.
+    //
     static constexpr auto handshake_data();
 
     template<typename Command>
@@ -40,45 +75,111 @@ namespace mcs::rpc
       constexpr static auto value {(std::is_same_v<Command, Commands> || ...)};
     };
 
+    static constexpr auto has_blocking_commands
+      {(command_is_blocking<Commands> || ...)};
+
+    using BlockingExecutor = asio::thread_pool::executor_type;
+    using Clock = detail::StatisticsCounters::Clock;
+
+    // Blocking commands are executed inline. Nothing is counted and
+    // GetStatistics is answered with empty statistics.
+    //
     template<typename... HandlerArgs>
       requires (std::is_constructible_v<Handler, HandlerArgs...>)
       explicit Dispatcher (HandlerArgs&&...);
 
+    // Blocking commands are executed by the blocking executor, if
+    // any, the dispatch resumes on its own executor. The commands are
+    // counted into the statistics of the connection, if any.
+    //
+    template<typename... HandlerArgs>
+      requires (std::is_constructible_v<Handler, HandlerArgs...>)
+      explicit Dispatcher
+        ( std::optional<BlockingExecutor>
+        , std::shared_ptr<detail::StatisticsCounters::Connection>
+        , HandlerArgs&&...
+        );
+
+    // The queueing latency of the command starts at the time it has
+    // been received.
+    //
     template<is_protocol Protocol>
       auto dispatch
         ( std::tuple<Header, detail::Buffer>
+        , Clock::time_point received
         , typename Protocol::socket&
         ) -> asio::awaitable<detail::ResultHolder>
       ;
 
   private:
-    template<is_protocol Protocol, std::size_t>
-      auto handle_by_index
+    template<is_protocol Protocol>
+      using Handle = auto (Dispatcher::*)
         ( std::tuple<Header, detail::Buffer>
+        , Clock::time_point
         , typename Protocol::socket&
         ) -> asio::awaitable<detail::ResultHolder>
       ;
-    template<is_protocol Protocol, std::size_t, typename, typename...>
-      auto handle_by_index
+
+    template<is_protocol Protocol, is_command Command>
+      requires (is_one_of_the_commands<Command, Commands...>)
+      auto handle
         ( std::tuple<Header, detail::Buffer>
+        , Clock::time_point
         , typename Protocol::socket&
         ) -> asio::awaitable<detail::ResultHolder>
       ;
 
-    template<is_protocol Protocol, is_command Command>
-      requires (is_one_of_the_commands<Command, Commands...>)
-      auto handle
+    template<is_protocol Protocol>
+      auto handle_statistics
         ( std::tuple<Header, detail::Buffer>
+        , Clock::time_point
         , typename Protocol::socket&
         ) -> asio::awaitable<detail::ResultHolder>
       ;
 
+    template<typename Response>
+      auto handled
+        ( std::size_t index
+        , Clock::time_point received
+        , Clock::time_point started
+        , detail::ResultOrError<Response> const&
+        ) const noexcept -> void
+      ;
+
+    template<typename Response>
+      [[nodiscard]] auto result_holder
+        ( std::size_t index
+        , detail::CallID
+        , detail::ResultOrError<Response>
+        ) const -> detail::ResultHolder
+      ;
+
     template<is_protocol Protocol, is_command Command>
       requires (is_one_of_the_commands<Command, Commands...>)
-      [[nodiscard]] auto invoke (Command, typename Protocol::socket&)
-        -> asio::awaitable<detail::ResultOrError<typename Command::Response>>
+      [[nodiscard]] auto invoke
+        ( Command
+        , util::trace::Context
+        , typename Protocol::socket&
+        ) -> asio::awaitable<detail::ResultOrError<typename Command::Response>>
+      ;
+
+    // \note optional: asio requires a default constructible result
+    // for co_spawn with use_awaitable
+    //
+    template<is_protocol Protocol, is_command Command>
+      requires (is_one_of_the_commands<Command, Commands...>)
+      [[nodiscard]] auto invoke_blocking
+        ( Command
+        , Clock::time_point received
+        , util::trace::Context
+        , typename Protocol::socket&
+        ) -> asio::awaitable
+           < std::optional<detail::ResultOrError<typename Command::Response>>
+           >
       ;
 
+    std::optional<BlockingExecutor> _blocking_executor;
+    std::shared_ptr<detail::StatisticsCounters::Connection> _statistics;
     Handler _handler;
   };
 }
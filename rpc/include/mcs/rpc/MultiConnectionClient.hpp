@@ -0,0 +1,215 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <mcs/rpc/Client.hpp>
+#include <mcs/rpc/Concepts.hpp>
+#include <mcs/rpc/multi_connection/Concepts.hpp>
+#include <mcs/rpc/multi_connection/LeastOutstanding.hpp>
+#include <mcs/rpc/multi_connection/NumberOfConnections.hpp>
+#include <mcs/rpc/multi_connection/RoundRobin.hpp>
+#include <mcs/util/ASIO/Connectable.hpp>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace mcs::rpc
+{
+  // Number of connections many clients to the same provider that are
+  // used like a single client. Each call is sent via the connection
+  // that is selected by the Distribution, see
+  // multi_connection::RoundRobin and
+  // multi_connection::LeastOutstanding. The provider serves the
+  // connections independently, e.g. with different threads.
+  //
+  // Each connection has its own access policy. With the Exclusive
+  // access policy the application must ensure that there are no
+  // concurrent calls at all.
+  //
+  // Costs: One allocation for the shared state of the future per call
+  // that returns a future or a response. The calls with a completion
+  // handler store the handler together with the selected connection,
+  // see Client.
+  //
+  // The copies of a multi connection client share the connections.
+  //
+  template< is_protocol Protocol
+          , is_access_policy AccessPolicy
+          , multi_connection::is_distribution Distribution
+          , is_command... Commands
+          >
+    struct MultiConnectionClient
+  {
+    template<is_command Command>
+      requires (is_one_of_the_commands<Command, Commands...>)
+        auto get_future
+          ( std::reference_wrapper<Command const>
+          ) const -> std::future<typename Command::Response>;
+
+    template<is_command Command>
+      requires (is_one_of_the_commands<Command, Commands...>)
+        auto operator()
+          ( std::reference_wrapper<Command const>
+          ) const -> typename Command::Response;
+
+    template<is_command Command, typename... CommandArgs>
+      requires ( std::is_constructible_v<Command, CommandArgs...>
+              && is_one_of_the_commands<Command, Commands...>
+               )
+      auto async_call
+        ( CommandArgs&&...
+        ) const -> std::future<typename Command::Response>;
+
+    template<is_command Command, typename... CommandArgs>
+      requires ( std::is_constructible_v<Command, CommandArgs...>
+              && is_one_of_the_commands<Command, Commands...>
+               )
+      auto call
+        ( CommandArgs&&...
+        ) const -> typename Command::Response;
+
+    template<is_command Command>
+      requires (is_one_of_the_commands<Command, Commands...>)
+      auto get_future
+        ( Command&&
+        ) const -> std::future<typename Command::Response>;
+
+    template<is_command Command>
+      requires (is_one_of_the_commands<Command, Commands...>)
+      auto operator()
+        ( Command&&
+        ) const -> typename Command::Response;
+
+    template<is_command Command, typename Handler>
+      requires ( is_one_of_the_commands<Command, Commands...>
+              && is_completion_handler_for_command<Handler, Command>
+               )
+      auto operator()
+        ( std::reference_wrapper<Command const>
+        , Handler
+        ) const -> void;
+
+    template<is_command Command, typename Handler>
+      requires ( is_one_of_the_commands<Command, Commands...>
+              && is_completion_handler_for_command<Handler, Command>
+               )
+      auto operator()
+        ( Command&&
+        , Handler
+        ) const -> void;
+
+    [[nodiscard]] auto number_of_connections() const noexcept -> std::size_t;
+
+    // A snapshot of the number of outstanding calls per connection.
+    //
+    [[nodiscard]] auto outstanding_calls
+      (
+      ) const -> std::vector<std::size_t>
+      ;
+
+    // Construction, use make_multi_connection_client
+    //
+    template<typename Executor, typename... DistributionArgs>
+      requires (std::is_constructible_v<Distribution, DistributionArgs...>)
+      explicit MultiConnectionClient
+        ( Executor&
+        , typename Protocol::endpoint
+        , multi_connection::NumberOfConnections
+        , DistributionArgs&&...
+        );
+
+    template<typename Executor, typename... DistributionArgs>
+      requires (std::is_constructible_v<Distribution, DistributionArgs...>)
+      explicit MultiConnectionClient
+        ( Executor&
+        , util::ASIO::Connectable<Protocol>
+        , multi_connection::NumberOfConnections
+        , DistributionArgs&&...
+        );
+
+  private:
+    using Connection = Client<Protocol, AccessPolicy, Commands...>;
+
+    struct State
+    {
+      template<typename... DistributionArgs>
+        explicit State
+          ( std::vector<Connection>
+          , DistributionArgs&&...
+          );
+
+      std::vector<Connection> connections;
+      std::vector<std::atomic<std::size_t>> outstanding_calls;
+      Distribution distribution;
+    };
+
+    std::shared_ptr<State> _state;
+
+    // Counts the call as outstanding at the selected connection until
+    // it is destroyed. It lives in the completion handler, so the
+    // call is outstanding until the handler has been called or the
+    // call has failed.
+    //
+    struct Outstanding
+    {
+      Outstanding (std::shared_ptr<State>, std::size_t connection) noexcept;
+
+      Outstanding (Outstanding const&) = delete;
+      Outstanding (Outstanding&&) noexcept;
+      auto operator= (Outstanding const&) -> Outstanding& = delete;
+      auto operator= (Outstanding&&) -> Outstanding& = delete;
+      ~Outstanding();
+
+      std::shared_ptr<State> state;
+      std::size_t connection;
+    };
+
+    template<typename Handler> struct CountingHandler;
+
+    [[nodiscard]] auto select() const -> Outstanding;
+
+    template<typename Executor, typename Endpoint>
+      [[nodiscard]] static auto connect
+        ( Executor&
+        , Endpoint
+        , multi_connection::NumberOfConnections
+        ) -> std::vector<Connection>;
+  };
+
+  template< is_protocol Protocol
+          , typename Dispatcher
+          , is_access_policy AccessPolicy
+          , multi_connection::is_distribution Distribution
+          , typename Executor
+          >
+    requires ( std::is_default_constructible_v<AccessPolicy>
+            && std::is_default_constructible_v<Distribution>
+             )
+    auto make_multi_connection_client
+      ( Executor&
+      , typename Protocol::endpoint
+      , multi_connection::NumberOfConnections
+      );
+
+  template< is_protocol Protocol
+          , typename Dispatcher
+          , is_access_policy AccessPolicy
+          , multi_connection::is_distribution Distribution
+          , typename Executor
+          >
+    requires ( std::is_default_constructible_v<AccessPolicy>
+            && std::is_default_constructible_v<Distribution>
+             )
+    auto make_multi_connection_client
+      ( Executor&
+      , util::ASIO::Connectable<Protocol>
+      , multi_connection::NumberOfConnections
+      );
+}
+
+#include "detail/MultiConnectionClient.ipp"
@@ -0,0 +1,101 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <asio/executor_work_guard.hpp>
+#include <asio/io_context.hpp>
+#include <atomic>
+#include <cstddef>
+#include <mcs/Error.hpp>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace mcs::rpc
+{
+  // A number of io_contexts, each one is run by a single thread of
+  // its own. A provider that is constructed with PerCoreIOContexts
+  // hands each accepted connection to the next io_context in round
+  // robin order and the connection stays there for its whole
+  // life. The connections do not migrate between threads and do not
+  // share the queue of an executor, the memory that asio recycles
+  // per thread, e.g. the coroutine frames, stays with the thread.
+  //
+  // If pinned, then the thread of the i-th io_context is bound to the
+  // (i modulo n)-th of the n cores the process is allowed to run on.
+  //
+  // Upon destruction the io_contexts are stopped and the threads are
+  // joined.
+  //
+  // EXAMPLE:
+  //   auto io_contexts
+  //     { PerCoreIOContexts
+  //         { PerCoreIOContexts::NumberOfContexts
+  //             {std::thread::hardware_concurrency()}
+  //         , PerCoreIOContexts::Pinning::ToCores
+  //         }
+  //     };
+  //
+  struct [[nodiscard]] PerCoreIOContexts
+  {
+    struct NumberOfContexts
+    {
+      constexpr explicit NumberOfContexts (std::size_t) noexcept;
+      std::size_t value;
+    };
+
+    enum class Pinning
+    {
+      None,
+      ToCores,
+    };
+
+    // \note throws if number of contexts is zero
+    //
+    explicit PerCoreIOContexts (NumberOfContexts, Pinning);
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t;
+    [[nodiscard]] auto operator[] (std::size_t) noexcept -> asio::io_context&;
+
+    // The io_context for the next connection, round robin.
+    //
+    [[nodiscard]] auto next() noexcept -> asio::io_context&;
+
+    ~PerCoreIOContexts();
+    PerCoreIOContexts (PerCoreIOContexts const&) = delete;
+    PerCoreIOContexts (PerCoreIOContexts&&) = delete;
+    auto operator= (PerCoreIOContexts const&) -> PerCoreIOContexts& = delete;
+    auto operator= (PerCoreIOContexts&&) -> PerCoreIOContexts& = delete;
+
+    struct Error
+    {
+      struct NumberOfContextsMustBePositive : public mcs::Error
+      {
+      public:
+        MCS_ERROR_COPY_MOVE_DEFAULT (NumberOfContextsMustBePositive);
+
+      private:
+        friend PerCoreIOContexts;
+
+        NumberOfContextsMustBePositive() noexcept;
+      };
+    };
+
+  private:
+    struct Context
+    {
+      asio::io_context io_context {1};
+      asio::executor_work_guard<asio::io_context::executor_type> work
+        {asio::make_work_guard (io_context)};
+    };
+
+    std::vector<std::unique_ptr<Context>> _contexts;
+    std::vector<std::thread> _threads;
+    std::atomic<std::size_t> _next {0};
+
+    auto stop_and_join() noexcept -> void;
+  };
+}
+
+#include "detail/PerCoreIOContexts.ipp"
@@ -4,8 +4,24 @@
 #pragma once
 
 #include <asio/awaitable.hpp>
+#include <asio/local/stream_protocol.hpp>
+#include <asio/thread_pool.hpp>
+#include <mcs/Error.hpp>
+#include <mcs/rpc/Admission.hpp>
+#include <mcs/rpc/BlockingPool.hpp>
+#include <mcs/rpc/BufferPoolStatistics.hpp>
 #include <mcs/rpc/Concepts.hpp>
+#include <mcs/rpc/PerCoreIOContexts.hpp>
+#include <mcs/rpc/ResponseBatching.hpp>
+#include <mcs/rpc/Statistics.hpp>
+#include <mcs/rpc/detail/BufferPool.hpp>
+#include <mcs/rpc/detail/InFlightLimit.hpp>
+#include <mcs/rpc/detail/StatisticsCounters.hpp>
+#include <mcs/rpc/provider/Options.hpp>
+#include <mcs/util/ASIO/Connectable.hpp>
 #include <mcs/util/ASIO/ListeningAcceptor.hpp>
+#include <memory>
+#include <optional>
 #include <type_traits>
 
 namespace mcs::rpc
@@ -18,23 +34,109 @@ namespace mcs::rpc
 
     auto local_endpoint() const;
 
+    using Options = provider::Options;
+
+    template<typename Executor>
+      explicit Provider
+        ( typename Protocol::endpoint
+        , Executor&
+        , HandlerArgs...
+        );
+
+    // \note throws Error::SameHostRequiresTCP if options.same_host is
+    // set and Protocol is not ip::tcp
+    //
     template<typename Executor>
       explicit Provider
         ( typename Protocol::endpoint
+        , Options
         , Executor&
         , HandlerArgs...
         );
 
+    [[nodiscard]] auto same_host_endpoint
+      (
+      ) const -> std::optional<asio::local::stream_protocol::endpoint>
+      ;
+
+    // The connectable for the local endpoint that includes the same
+    // host endpoint, if any.
+    //
+    [[nodiscard]] auto connection_information
+      (
+      ) const -> util::ASIO::Connectable<Protocol>
+      ;
+
+    // The buffers for incoming commands are pooled per connection,
+    // the statistics sum up all connections.
+    //
+    [[nodiscard]] auto buffer_pool_statistics
+      (
+      ) const noexcept -> BufferPoolStatistics
+      ;
+
+    // The same statistics that are returned to GetStatistics, see
+    // Dispatcher::StatisticsClientType.
+    //
+    [[nodiscard]] auto statistics() const -> Statistics;
+
+    struct Error
+    {
+      struct SameHostRequiresTCP : public mcs::Error
+      {
+      public:
+        MCS_ERROR_COPY_MOVE_DEFAULT (SameHostRequiresTCP);
+
+      private:
+        template<is_protocol, typename, typename...> friend struct Provider;
+
+        SameHostRequiresTCP() noexcept;
+      };
+    };
+
   private:
+    std::shared_ptr<detail::BufferPool::Counters> _buffer_pool_counters
+      {std::make_shared<detail::BufferPool::Counters>()};
+    std::shared_ptr<detail::StatisticsCounters> _statistics_counters
+      { std::make_shared<detail::StatisticsCounters>
+          (Dispatcher::handshake_data())
+      };
+    // shared with the connections, they might outlive the provider
+    std::shared_ptr<asio::thread_pool> _blocking_pool;
+    // shared with the connections, not set if not limited
+    std::shared_ptr<detail::InFlightLimit> _in_flight;
     util::ASIO::ListeningAcceptor<Protocol> _acceptor;
+    std::optional
+      < util::ASIO::ListeningAcceptor<asio::local::stream_protocol>
+      > _same_host_acceptor;
+
+    // shared by the acceptors and their connections
+    //
+    struct Connections
+    {
+      // if set, then the connections are distributed over the per
+      // core io_contexts, otherwise they stay on the executor
+      PerCoreIOContexts* per_core_io_contexts;
+      ResponseBatching response_batching;
+      Admission admission;
+      std::shared_ptr<detail::InFlightLimit> in_flight;
+      std::shared_ptr<detail::BufferPool::Counters> buffer_pool_counters;
+      std::shared_ptr<detail::StatisticsCounters> statistics_counters;
+      std::shared_ptr<asio::thread_pool> blocking_pool;
+    };
 
-    auto accept_clients
-      ( HandlerArgs...
-      ) -> asio::awaitable<void>;
-    auto dispatch
-      ( typename Protocol::socket
-      , HandlerArgs...
-      ) -> asio::awaitable<void>;
+    template<is_protocol AcceptorProtocol>
+      auto accept_clients
+        ( util::ASIO::ListeningAcceptor<AcceptorProtocol>&
+        , Connections
+        , HandlerArgs...
+        ) -> asio::awaitable<void>;
+    template<is_protocol SocketProtocol>
+      auto dispatch
+        ( typename SocketProtocol::socket
+        , Connections
+        , HandlerArgs...
+        ) -> asio::awaitable<void>;
   };
 
   template< is_protocol Protocol
@@ -49,6 +151,20 @@ namespace mcs::rpc
         , HandlerArgs...
         ) -> Provider<Protocol, Dispatcher, HandlerArgs...>
     ;
+
+  template< is_protocol Protocol
+          , typename Dispatcher
+          , typename Executor
+          , typename... HandlerArgs
+          >
+    requires (std::is_constructible_v<typename Dispatcher::HandlerType, HandlerArgs...>)
+      auto make_provider
+        ( typename Protocol::endpoint
+        , provider::Options
+        , Executor&
+        , HandlerArgs...
+        ) -> Provider<Protocol, Dispatcher, HandlerArgs...>
+    ;
 }
 
 #include "detail/Provider.ipp"
@@ -0,0 +1,65 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <mcs/Error.hpp>
+
+namespace mcs::rpc
+{
+  // Responses of one connection that become ready while another
+  // response is written are gathered into a single write of at most
+  // max responses many responses. If max latency is not zero, then a
+  // write that would not fill a batch waits at most max latency for
+  // more responses.
+  //
+  // The default writes without waiting and gathers at most 64
+  // responses.
+  //
+  struct ResponseBatching
+  {
+    struct MaxResponses
+    {
+      constexpr explicit MaxResponses (std::size_t) noexcept;
+      std::size_t value;
+    };
+    struct MaxLatency
+    {
+      constexpr explicit MaxLatency (std::chrono::microseconds) noexcept;
+      std::chrono::microseconds value;
+    };
+
+    ResponseBatching() noexcept = default;
+
+    // \note throws if max responses is zero
+    //
+    ResponseBatching (MaxResponses, MaxLatency);
+
+    [[nodiscard]] auto max_responses() const noexcept -> std::size_t;
+    [[nodiscard]] auto max_latency
+      (
+      ) const noexcept -> std::chrono::microseconds;
+
+    struct Error
+    {
+      struct MaxResponsesMustBePositive : public mcs::Error
+      {
+      public:
+        MCS_ERROR_COPY_MOVE_DEFAULT (MaxResponsesMustBePositive);
+
+      private:
+        friend ResponseBatching;
+
+        MaxResponsesMustBePositive() noexcept;
+      };
+    };
+
+  private:
+    std::size_t _max_responses {64};
+    std::chrono::microseconds _max_latency {0};
+  };
+}
+
+#include "detail/ResponseBatching.ipp"
@@ -0,0 +1,107 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mcs/serialization/declare.hpp>
+#include <mcs/util/FMT/declare.hpp>
+#include <string>
+#include <vector>
+
+namespace mcs::rpc
+{
+  // Latencies in powers of two microseconds: Bucket 0 counts the
+  // latencies below 1us, bucket i > 0 counts the latencies in
+  // [2^(i-1)us, 2^i us). The last bucket counts all longer latencies,
+  // too.
+  //
+  struct LatencyHistogram
+  {
+    static constexpr auto NumberOfBuckets {std::size_t {32}};
+
+    [[nodiscard]] static constexpr auto bucket
+      ( std::chrono::nanoseconds
+      ) noexcept -> std::size_t
+      ;
+
+    // Returns: The number of latencies in all buckets.
+    //
+    [[nodiscard]] constexpr auto count() const noexcept -> std::uint64_t;
+
+    std::array<std::uint64_t, NumberOfBuckets> counts {};
+  };
+
+  // The counters of a single command, over all connections.
+  //
+  // The queueing latency is the time from the arrival of the request
+  // until the start of its handler, it includes the waits for
+  // admission and for a thread of the blocking pool. The handling
+  // latency is the time spent in the handler.
+  //
+  struct CommandStatistics
+  {
+    std::string command;
+    std::uint64_t calls {0};
+    // calls that have been answered with an error
+    std::uint64_t errors {0};
+    std::uint64_t bytes_in {0};
+    std::uint64_t bytes_out {0};
+    LatencyHistogram queueing;
+    LatencyHistogram handling;
+  };
+
+  // The counters of a single open connection.
+  //
+  struct ConnectionStatistics
+  {
+    std::string peer;
+    std::uint64_t requests {0};
+    std::uint64_t bytes_in {0};
+    std::uint64_t bytes_out {0};
+  };
+
+  // A snapshot of the counters of a provider. The counters of the
+  // commands are in the order of the commands of the dispatcher.
+  //
+  struct Statistics
+  {
+    std::vector<CommandStatistics> commands;
+    std::vector<ConnectionStatistics> connections;
+  };
+
+  // Built-in command that is provided by every provider and answered
+  // with the current statistics of the provider. Use
+  // Dispatcher::StatisticsClientType to call it.
+  //
+  struct GetStatistics
+  {
+    using Response = Statistics;
+  };
+}
+
+namespace fmt
+{
+  template<> MCS_UTIL_FMT_DECLARE (mcs::rpc::LatencyHistogram);
+  template<> MCS_UTIL_FMT_DECLARE (mcs::rpc::CommandStatistics);
+  template<> MCS_UTIL_FMT_DECLARE (mcs::rpc::ConnectionStatistics);
+  template<> MCS_UTIL_FMT_DECLARE (mcs::rpc::Statistics);
+}
+
+namespace mcs::serialization
+{
+  template<>
+    MCS_SERIALIZATION_DECLARE_NONINTRUSIVE_IMPLEMENTATION
+      (rpc::CommandStatistics);
+  template<>
+    MCS_SERIALIZATION_DECLARE_NONINTRUSIVE_IMPLEMENTATION
+      (rpc::ConnectionStatistics);
+  template<>
+    MCS_SERIALIZATION_DECLARE_NONINTRUSIVE_IMPLEMENTATION
+      (rpc::Statistics);
+}
+
+#include "detail/Statistics.ipp"
@@ -6,7 +6,7 @@
 #include <exception>
 #include <mcs/rpc/detail/CallID.hpp>
 #include <mcs/rpc/detail/Completion.hpp>
-#include <memory>
+#include <optional>
 
 namespace mcs::rpc::access_policy
 {
@@ -22,6 +22,6 @@ namespace mcs::rpc::access_policy
 
     [[nodiscard]] auto completion() -> detail::Completion;
 
-    std::unique_ptr<detail::Completion> _completion {nullptr};
+    std::optional<detail::Completion> _completion;
   };
 }
@@ -23,7 +23,7 @@ namespace mcs::rpc::access_policy
         ) noexcept (std::is_nothrow_constructible_v<Observer, ObserverArgs...>)
       ;
 
-    [[nodiscard]] auto start_call (detail::Completion) noexcept -> detail::CallID;
+    [[nodiscard]] auto start_call (detail::Completion) -> detail::CallID;
     [[nodiscard]] auto completion (detail::CallID) -> detail::Completion;
 
     auto error (std::exception_ptr) noexcept -> void;
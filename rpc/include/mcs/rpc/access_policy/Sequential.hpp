@@ -6,7 +6,8 @@
 #include <exception>
 #include <mcs/rpc/detail/CallID.hpp>
 #include <mcs/rpc/detail/Completion.hpp>
-#include <memory>
+#include <mutex>
+#include <optional>
 
 namespace mcs::rpc::access_policy
 {
@@ -19,11 +20,11 @@ namespace mcs::rpc::access_policy
 
   private:
     std::mutex _guard_send;
-    std::unique_ptr<std::lock_guard<decltype (_guard_send)>> _lock_send;
+    std::unique_lock<decltype (_guard_send)> _lock_send;
     detail::CallID _call_id{};
 
     [[nodiscard]] auto completion() -> detail::Completion;
 
-    std::unique_ptr<detail::Completion> _completion {nullptr};
+    std::optional<detail::Completion> _completion;
   };
 }
@@ -20,7 +20,7 @@ namespace mcs::rpc::access_policy
   template<is_access_policy AccessPolicy, is_access_policy_observer Observer>
     auto ObservedSimple<AccessPolicy, Observer>::start_call
       ( detail::Completion completion
-      ) noexcept -> detail::CallID
+      ) -> detail::CallID
   {
     auto call_id {_policy->start_call (std::move (completion))};
     _observer.call_started();
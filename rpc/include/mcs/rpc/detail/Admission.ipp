@@ -0,0 +1,16 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+namespace mcs::rpc
+{
+  constexpr Admission::MaxRequestsPerConnection::MaxRequestsPerConnection
+    ( std::size_t value_
+    ) noexcept
+      : value {value_}
+  {}
+  constexpr Admission::MaxRequests::MaxRequests
+    ( std::size_t value_
+    ) noexcept
+      : value {value_}
+  {}
+}
@@ -0,0 +1,11 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+namespace mcs::rpc
+{
+  constexpr BlockingPool::NumberOfThreads::NumberOfThreads
+    ( std::size_t value_
+    ) noexcept
+      : value {value_}
+  {}
+}
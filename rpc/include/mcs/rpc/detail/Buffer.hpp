@@ -6,14 +6,34 @@
 #include <asio/buffer.hpp>
 #include <cstddef>
 #include <cstdint>
-#include <mcs/util/buffer/Bytes.hpp>
+#include <mcs/util/Buffer.hpp>
+#include <memory>
 
 namespace mcs::rpc::detail
 {
+  struct BufferPool;
+
+  // Returns the memory into the pool it was taken from. Deletes the
+  // memory if there is no pool.
+  //
+  struct ReturnToPool
+  {
+    std::shared_ptr<BufferPool> pool;
+    std::size_t size_class {0};
+
+    auto operator() (std::byte*) const noexcept -> void;
+  };
+
   //! \todo isn't that a serialization::Buffer?
-  struct Buffer : public util::buffer::Bytes
+  struct Buffer : public util::Buffer<std::byte[], ReturnToPool>
   {
-    using util::buffer::Bytes::Bytes;
+    constexpr Buffer() noexcept = default;
+
+    // Not pooled.
+    //
+    explicit Buffer (std::size_t);
+
+    Buffer (std::size_t, Memory);
 
     template<typename T>
       [[nodiscard]] auto load() -> T;
@@ -0,0 +1,69 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <mcs/rpc/BufferPoolStatistics.hpp>
+#include <mcs/rpc/detail/Buffer.hpp>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace mcs::rpc::detail
+{
+  // Hands out buffers for incoming messages. The memory is taken
+  // from a free list per size class, the size classes are the powers
+  // of two from 64 bytes to 1 MiB. A buffer returns its memory into
+  // the pool when it is destroyed, the pool holds at most
+  // MaximumPooledBytes many bytes and deletes memory beyond that.
+  //
+  // Thread safe. Must be created by std::make_shared, the buffers
+  // keep the pool alive.
+  //
+  struct BufferPool : public std::enable_shared_from_this<BufferPool>
+  {
+    static constexpr auto SmallestSizeClass {std::size_t {64}};
+    static constexpr auto NumberOfSizeClasses {std::size_t {15}};
+    static constexpr auto MaximumPooledBytes {std::size_t {4} << 20u};
+
+    // Can be shared by many pools to count for all of them.
+    //
+    struct Counters
+    {
+      std::atomic<std::size_t> reused {0};
+      std::atomic<std::size_t> allocated {0};
+      std::atomic<std::size_t> oversized {0};
+      std::atomic<std::size_t> returned {0};
+      std::atomic<std::size_t> dropped {0};
+      std::atomic<std::size_t> pooled_bytes {0};
+
+      [[nodiscard]] auto statistics() const noexcept -> BufferPoolStatistics;
+    };
+
+    BufferPool();
+    explicit BufferPool (std::shared_ptr<Counters>) noexcept;
+
+    // A buffer of exactly the given size.
+    //
+    [[nodiscard]] auto acquire (std::size_t) -> Buffer;
+
+    [[nodiscard]] auto statistics() const noexcept -> BufferPoolStatistics;
+
+  private:
+    friend struct ReturnToPool;
+
+    auto release (std::size_t size_class, std::byte*) noexcept -> void;
+
+    std::shared_ptr<Counters> _counters;
+
+    std::mutex _guard;
+    std::array
+      < std::vector<std::unique_ptr<std::byte[]>>
+      , NumberOfSizeClasses
+      > _free;
+    std::size_t _pooled_bytes {0};
+  };
+}
@@ -1,11 +1,13 @@
 // Copyright (C) 2022-2025 Fraunhofer ITWM
 // License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
 
+#include <mcs/rpc/detail/Completion.hpp>
 #include <mcs/rpc/detail/command_holder/NonOwning.hpp>
 #include <mcs/rpc/detail/command_holder/Owning.hpp>
 #include <mcs/rpc/detail/observe.hpp>
 #include <mcs/rpc/detail/remote_call.hpp>
 #include <type_traits>
+#include <utility>
 
 namespace mcs::rpc
 {
@@ -19,6 +21,17 @@ namespace mcs::rpc
         : _state {state}
   {}
 
+  template< is_protocol Protocol
+          , is_access_policy AccessPolicy
+          , is_command... Commands
+          >
+    auto Client<Protocol, AccessPolicy, Commands...>::buffer_pool_statistics
+      (
+      ) const noexcept -> BufferPoolStatistics
+  {
+    return _state.buffer_pool->statistics();
+  }
+
   template< is_protocol Protocol
           , is_access_policy AccessPolicy
           , is_command... Commands
@@ -190,6 +203,57 @@ namespace mcs::rpc
   }
 }
 
+// deliver the response to a completion handler
+//
+namespace mcs::rpc
+{
+  template< is_protocol Protocol
+          , is_access_policy AccessPolicy
+          , is_command... Commands
+          >
+    template<is_command Command, typename Handler>
+      requires ( is_one_of_the_commands<Command, Commands...>
+              && is_completion_handler_for_command<Handler, Command>
+               )
+        auto Client<Protocol, AccessPolicy, Commands...>::operator()
+          ( std::reference_wrapper<Command const> command_ref
+          , Handler handler
+          ) const -> void
+  {
+    return detail::remote_call<Protocol, AccessPolicy, Command>
+      ( _state
+      , detail::command_holder::NonOwning<Command> {command_ref}
+      , detail::Completion
+          { std::in_place_type<typename Command::Response>
+          , std::move (handler)
+          }
+      );
+  }
+  template< is_protocol Protocol
+          , is_access_policy AccessPolicy
+          , is_command... Commands
+          >
+    template<is_command Command, typename Handler>
+      requires ( is_one_of_the_commands<Command, Commands...>
+              && is_completion_handler_for_command<Handler, Command>
+               )
+        auto Client<Protocol, AccessPolicy, Commands...>::operator()
+          ( Command&& command
+          , Handler handler
+          ) const -> void
+  {
+    return detail::remote_call<Protocol, AccessPolicy, Command>
+      ( _state
+      , detail::command_holder::Owning<Command>
+          {std::forward<Command> (command)}
+      , detail::Completion
+          { std::in_place_type<typename Command::Response>
+          , std::move (handler)
+          }
+      );
+  }
+}
+
 namespace mcs::rpc
 {
   template< is_protocol Protocol
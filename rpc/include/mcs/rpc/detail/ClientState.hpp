@@ -4,6 +4,8 @@
 #pragma once
 
 #include <mcs/rpc/Concepts.hpp>
+#include <mcs/rpc/detail/BufferPool.hpp>
+#include <mcs/rpc/detail/SendQueue.hpp>
 #include <mcs/util/ASIO/Connectable.hpp>
 #include <memory>
 
@@ -18,6 +20,16 @@ namespace mcs::rpc::detail
     explicit ClientState
       ( std::shared_ptr<typename Protocol::socket>
       , std::shared_ptr<AccessPolicy>
+      );
+
+    // All states that share a socket must share the send queue and
+    // the buffer pool.
+    //
+    explicit ClientState
+      ( std::shared_ptr<typename Protocol::socket>
+      , std::shared_ptr<AccessPolicy>
+      , std::shared_ptr<SendQueue>
+      , std::shared_ptr<BufferPool>
       ) noexcept;
 
     template<typename Executor>
@@ -36,6 +48,8 @@ namespace mcs::rpc::detail
 
     std::shared_ptr<typename Protocol::socket> socket;
     std::shared_ptr<AccessPolicy> access_policy;
+    std::shared_ptr<SendQueue> send_queue;
+    std::shared_ptr<BufferPool> buffer_pool;
   };
 }
 
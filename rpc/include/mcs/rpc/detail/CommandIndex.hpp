@@ -4,6 +4,7 @@
 #pragma once
 
 #include <compare>
+#include <cstddef>
 #include <cstdint>
 #include <fmt/format.h>
 
@@ -18,6 +19,8 @@ namespace mcs::rpc::detail
 
     constexpr auto operator<=> (CommandIndex const&) const noexcept = default;
 
+    [[nodiscard]] constexpr auto value() const noexcept -> std::size_t;
+
   private:
     template<typename, typename, typename> friend struct fmt::formatter;
 
@@ -3,29 +3,69 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <exception>
-#include <functional>
 #include <future>
 #include <mcs/rpc/detail/Buffer.hpp>
+#include <utility>
 
 namespace mcs::rpc::detail
 {
+  namespace completion
+  {
+    // The type erased operations on a stored handler.
+    //
+    struct Operations
+    {
+      auto (*complete) (void*, std::exception_ptr, Buffer) -> void;
+      // move constructs at the second location and destroys the first
+      auto (*relocate) (void*, void*) noexcept -> void;
+      auto (*destroy) (void*) noexcept -> void;
+    };
+  }
+
+  // Move-only, type erased completion. Handlers that are small
+  // enough and that can be moved without throwing are stored in
+  // place, constructing and calling such a completion does not
+  // allocate. Other handlers are stored on the heap.
+  //
   struct Completion
   {
     template<typename T>
-      constexpr explicit Completion (std::promise<T>);
+      explicit Completion (std::promise<T>);
+
+    // The handler is called exactly once, either with the value of
+    // type T (without argument if T is void) or with the
+    // std::exception_ptr that describes why there is no value.
+    //
+    template<typename T, typename Handler>
+      explicit Completion (std::in_place_type_t<T>, Handler);
 
+    // Calls before() and then the completion, e.g. to observe the
+    // end of a call.
+    //
+    template<typename Before>
+      explicit Completion (Completion, Before);
+
+    // \note throws if the completion has been moved from
+    //
     auto operator() (std::exception_ptr) -> void;
     auto operator() (Buffer) -> void;
 
     Completion (Completion const&) = delete;
-    Completion (Completion&&) noexcept = default;
+    Completion (Completion&&) noexcept;
     auto operator= (Completion const&) -> Completion& = delete;
-    auto operator= (Completion&&) noexcept -> Completion& = default;
-    ~Completion() noexcept = default;
+    auto operator= (Completion&&) noexcept -> Completion&;
+    ~Completion() noexcept;
+
+    static constexpr auto InPlaceSize {std::size_t {8 * sizeof (void*)}};
 
   private:
-    std::function<void (std::exception_ptr, Buffer)> _complete;
+    completion::Operations const* _operations {nullptr};
+    alignas (std::max_align_t) std::array<std::byte, InPlaceSize> _storage;
+
+    auto reset() noexcept -> void;
   };
 }
 
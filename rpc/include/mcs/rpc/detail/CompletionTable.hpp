@@ -0,0 +1,90 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mcs/rpc/detail/CallID.hpp>
+#include <mcs/rpc/detail/Completion.hpp>
+#include <memory>
+#include <optional>
+
+namespace mcs::rpc::detail
+{
+  // Outstanding completions indexed by call id. The completions are
+  // stored in power-of-two slot rings, the slot of a call id is
+  // (call_id & mask). If the slot of a new call is occupied, then a
+  // ring of twice the size is added and used for all calls from then
+  // on. Older rings keep their outstanding completions until they
+  // are taken and are never refilled.
+  //
+  // insert requires the call ids to be increasing and must not be
+  // called concurrently, e.g. the caller holds the send lock. take
+  // and error are lock-free and can be called concurrently with each
+  // other and with insert.
+  //
+  struct CompletionTable
+  {
+    struct InitialCapacity
+    {
+      constexpr explicit InitialCapacity (std::size_t) noexcept;
+      std::size_t value;
+    };
+
+    // \note the capacity is rounded up to a power of two
+    //
+    explicit CompletionTable (InitialCapacity = InitialCapacity {64});
+
+    // \note throws if a new ring can not be allocated, the table is
+    // unchanged then
+    //
+    auto insert (CallID, Completion) -> void;
+
+    // \note throws if there is no completion for the call id
+    //
+    [[nodiscard]] auto take (CallID) -> Completion;
+
+    // Calls all outstanding completions with the error.
+    //
+    auto error (std::exception_ptr) noexcept -> void;
+
+    // The sum of the sizes of all rings.
+    //
+    [[nodiscard]] auto capacity() const noexcept -> std::size_t;
+
+    CompletionTable (CompletionTable const&) = delete;
+    CompletionTable (CompletionTable&&) = delete;
+    auto operator= (CompletionTable const&) -> CompletionTable& = delete;
+    auto operator= (CompletionTable&&) -> CompletionTable& = delete;
+    ~CompletionTable() noexcept = default;
+
+  private:
+    struct Slot
+    {
+      // 0: empty, Taking: in transition, otherwise: call id + 1
+      std::atomic<std::uint64_t> tag {0};
+      std::optional<Completion> completion;
+    };
+    struct Ring
+    {
+      Ring (std::size_t first_call_id, std::size_t size);
+
+      std::size_t const first_call_id;
+      std::size_t const mask;
+      std::unique_ptr<Slot[]> const slots;
+    };
+
+    // each ring doubles the size, 64 rings exceed the call id space
+    std::array<std::unique_ptr<Ring>, 64> _rings;
+    std::atomic<std::size_t> _number_of_rings {0};
+    std::size_t _initial_capacity;
+
+    [[nodiscard]] auto take (Slot&, std::uint64_t tag) -> std::optional<Completion>;
+  };
+}
+
+#include "detail/CompletionTable.ipp"
@@ -1,14 +1,21 @@
 // Copyright (C) 2022-2025 Fraunhofer ITWM
 // License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
 
+#include <asio/co_spawn.hpp>
+#include <asio/use_awaitable.hpp>
 #include <cstdint>
 #include <exception>
 #include <functional>
+#include <mcs/rpc/detail/command_name.hpp>
 #include <mcs/rpc/detail/make_handshake_data.hpp>
 #include <mcs/rpc/error/internal/UnknownCommand.hpp>
 #include <mcs/util/ASIO/Connectable.hpp>
 #include <mcs/util/FMT/STD/exception.hpp>
+#include <mcs/util/trace/Span.hpp>
+#include <optional>
+#include <tuple>
 #include <utility>
+#include <variant>
 
 namespace mcs::rpc
 {
@@ -19,9 +26,26 @@ namespace mcs::rpc
       Dispatcher<Handler, Commands...>::Dispatcher
         ( HandlerArgs&&... handler_args
         )
-          : _handler {std::forward<HandlerArgs> (handler_args)...}
+          : Dispatcher
+            { std::nullopt
+            , nullptr
+            , std::forward<HandlerArgs> (handler_args)...
+            }
   {}
 
+  template<typename Handler, is_command... Commands>
+    requires (is_handler_for_commands<Handler, Commands...>)
+    template<typename... HandlerArgs>
+      requires (std::is_constructible_v<Handler, HandlerArgs...>)
+      Dispatcher<Handler, Commands...>::Dispatcher
+        ( std::optional<BlockingExecutor> blocking_executor
+        , std::shared_ptr<detail::StatisticsCounters::Connection> statistics
+        , HandlerArgs&&... handler_args
+        )
+          : _blocking_executor {blocking_executor}
+          , _statistics {std::move (statistics)}
+          , _handler {std::forward<HandlerArgs> (handler_args)...}
+  {}
 
   template<typename Handler, is_command... Commands>
     requires (is_handler_for_commands<Handler, Commands...>)
@@ -29,7 +53,7 @@ namespace mcs::rpc
       (
       )
   {
-    return detail::make_handshake_data<Commands...>();
+    return detail::make_handshake_data<Commands..., GetStatistics>();
   }
 
   template<typename Handler, is_command... Commands>
@@ -37,68 +61,203 @@ namespace mcs::rpc
     template<is_protocol Protocol>
       auto Dispatcher<Handler, Commands...>::dispatch
         ( std::tuple<Header, detail::Buffer> command
+        , Clock::time_point received
         , typename Protocol::socket& socket
         ) -> asio::awaitable<detail::ResultHolder>
   {
-    return handle_by_index<Protocol, 0, Commands...>
-      (std::move (command), socket);
+    // The jump table: The handle for the command with index i is at
+    // position i. The command indices are assigned by command_index
+    // in the order of Commands, GetStatistics comes last.
+    //
+    static constexpr auto handle_by_index
+      { std::array<Handle<Protocol>, sizeof... (Commands) + 1>
+        { &Dispatcher::template handle<Protocol, Commands>...
+        , &Dispatcher::template handle_statistics<Protocol>
+        }
+      };
+
+    auto const index {std::get<Header> (command).index.value()};
+
+    if (index >= handle_by_index.size())
+    {
+      throw error::internal::UnknownCommand{};
+    }
+
+    return (this->*handle_by_index[index])
+      (std::move (command), received, socket);
   }
 
   template<typename Handler, is_command... Commands>
     requires (is_handler_for_commands<Handler, Commands...>)
-    template<is_protocol Protocol, std::size_t I>
-      auto Dispatcher<Handler, Commands...>::handle_by_index
-        ( std::tuple<Header, detail::Buffer>
-        , typename Protocol::socket&
+    template<is_protocol Protocol, is_command Command>
+      requires (is_one_of_the_commands<Command, Commands...>)
+      auto Dispatcher<Handler, Commands...>::handle
+        ( std::tuple<Header, detail::Buffer> command
+        , Clock::time_point received
+        , typename Protocol::socket& socket
         ) -> asio::awaitable<detail::ResultHolder>
   {
-    throw error::internal::UnknownCommand{};
+    static constexpr auto index
+      {detail::command_index<Command, Commands...>().value()};
+
+    auto const& header {std::get<Header> (command)};
+    auto& buffer {std::get<detail::Buffer> (command)};
+
+    if (_statistics)
+    {
+      _statistics->received (index, buffer.size());
+    }
+
+    auto command_value {buffer.template load<Command>()};
+
+    // the span covers the wait for a thread of the blocking pool
+    auto span
+      { util::trace::Span::start
+          ( detail::command_name<Command>()
+          , "rpc.provider"
+          , util::trace::Kind::Server
+          , header.trace
+          )
+      };
+    auto const trace {span ? span->context() : header.trace};
+
+    if constexpr (command_is_blocking<Command>)
+    {
+      using Socket = typename Protocol::socket&;
+
+      static_assert
+        (  !handler::provides_response<Handler, Command, Socket>
+        && !handler::provides_awaitable_response<Handler, Command, Socket>
+        , "The handler of a blocking command can not use the socket."
+        );
+
+      if (_blocking_executor)
+      {
+        auto result_or_error
+          { co_await asio::co_spawn
+              ( *_blocking_executor
+              , invoke_blocking<Protocol>
+                  (std::move (command_value), received, trace, socket)
+              , asio::use_awaitable
+              )
+          };
+
+        co_return result_holder
+          (index, header.call_id, std::move (result_or_error.value()));
+      }
+    }
+
+    auto const started {Clock::now()};
+    auto result_or_error
+      {co_await invoke<Protocol> (std::move (command_value), trace, socket)};
+
+    handled (index, received, started, result_or_error);
+
+    co_return result_holder
+      (index, header.call_id, std::move (result_or_error));
   }
 
   template<typename Handler, is_command... Commands>
     requires (is_handler_for_commands<Handler, Commands...>)
-    template< is_protocol Protocol
-            , std::size_t I
-            , typename Command
-            , typename... Tail
-            >
-      auto Dispatcher<Handler, Commands...>::handle_by_index
+    template<is_protocol Protocol>
+      auto Dispatcher<Handler, Commands...>::handle_statistics
         ( std::tuple<Header, detail::Buffer> command
-        , typename Protocol::socket& socket
+        , Clock::time_point received
+        , typename Protocol::socket&
         ) -> asio::awaitable<detail::ResultHolder>
   {
-    auto& header {std::get<Header> (command)};
+    static constexpr auto index {sizeof... (Commands)};
 
-    if (header.index == detail::CommandIndex{})
+    auto const& header {std::get<Header> (command)};
+    auto& buffer {std::get<detail::Buffer> (command)};
+
+    if (_statistics)
     {
-      return handle<Protocol, Command> (std::move (command), socket);
+      _statistics->received (index, buffer.size());
     }
-    else
-    {
-      --header.index;
 
-      return handle_by_index<Protocol, I + 1, Tail...>
-        (std::move (command), socket);
+    std::ignore = buffer.template load<GetStatistics>();
+
+    auto const started {Clock::now()};
+    auto result_or_error
+      { detail::make_result
+        ( _statistics
+          ? _statistics->counters().statistics()
+          : Statistics{}
+        )
+      };
+
+    handled (index, received, started, result_or_error);
+
+    co_return result_holder
+      (index, header.call_id, std::move (result_or_error));
+  }
+
+  template<typename Handler, is_command... Commands>
+    requires (is_handler_for_commands<Handler, Commands...>)
+    template<typename Response>
+      auto Dispatcher<Handler, Commands...>::handled
+        ( std::size_t index
+        , Clock::time_point received
+        , Clock::time_point started
+        , detail::ResultOrError<Response> const& result_or_error
+        ) const noexcept -> void
+  {
+    if (_statistics)
+    {
+      _statistics->handled
+        ( index
+        , received
+        , started
+        , std::holds_alternative<detail::Error> (result_or_error)
+        );
     }
   }
 
+  template<typename Handler, is_command... Commands>
+    requires (is_handler_for_commands<Handler, Commands...>)
+    template<typename Response>
+      auto Dispatcher<Handler, Commands...>::result_holder
+        ( std::size_t index
+        , detail::CallID call_id
+        , detail::ResultOrError<Response> result_or_error
+        ) const -> detail::ResultHolder
+  {
+    auto holder {detail::ResultHolder {call_id, std::move (result_or_error)}};
+
+    holder.statistics = _statistics;
+    holder.command = index;
+
+    return holder;
+  }
+
   template<typename Handler, is_command... Commands>
     requires (is_handler_for_commands<Handler, Commands...>)
     template<is_protocol Protocol, is_command Command>
       requires (is_one_of_the_commands<Command, Commands...>)
-      auto Dispatcher<Handler, Commands...>::handle
-        ( std::tuple<Header, detail::Buffer> command
+      auto Dispatcher<Handler, Commands...>::invoke_blocking
+        ( Command command
+        , Clock::time_point received
+        , util::trace::Context trace
         , typename Protocol::socket& socket
-        ) -> asio::awaitable<detail::ResultHolder>
+        ) -> asio::awaitable
+             < std::optional<detail::ResultOrError<typename Command::Response>>
+             >
   {
-    auto const& header {std::get<Header> (command)};
-    auto& buffer {std::get<detail::Buffer> (command)};
-
+    // started on the blocking executor: the wait for a thread of the
+    // pool is part of the queueing latency
+    auto const started {Clock::now()};
     auto result_or_error
-      {co_await invoke<Protocol> (buffer.template load<Command>(), socket)};
+      {co_await invoke<Protocol> (std::move (command), trace, socket)};
+
+    handled
+      ( detail::command_index<Command, Commands...>().value()
+      , received
+      , started
+      , result_or_error
+      );
 
-    co_return detail::ResultHolder
-      {header.call_id, std::move (result_or_error)};
+    co_return result_or_error;
   }
 
   template<typename Handler, is_command... Commands>
@@ -107,14 +266,20 @@ namespace mcs::rpc
       requires (is_one_of_the_commands<Command, Commands...>)
       auto Dispatcher<Handler, Commands...>::invoke
         ( Command command
+        , util::trace::Context trace
         , typename Protocol::socket& socket
         ) -> asio::awaitable<detail::ResultOrError<typename Command::Response>>
   try
   {
     using Socket = typename Protocol::socket&;
 
+    // \note the context is set for synchronous handlers only: it
+    // belongs to the thread and must not be held across a co_await
+    //
     if constexpr (handler::provides_response<Handler, Command, Socket>)
     {
+      auto const scoped_context {util::trace::ScopedContext {trace}};
+
       if constexpr (std::is_same_v<typename Command::Response, void>)
       {
         std::invoke (_handler, std::move (command), socket);
@@ -147,6 +312,8 @@ namespace mcs::rpc
 
     if constexpr (handler::provides_response<Handler, Command>)
     {
+      auto const scoped_context {util::trace::ScopedContext {trace}};
+
       if constexpr (std::is_same_v<typename Command::Response, void>)
       {
         std::invoke (_handler, std::move (command));
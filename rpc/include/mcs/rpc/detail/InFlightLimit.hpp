@@ -0,0 +1,58 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+namespace mcs::rpc::detail
+{
+  // Counts the requests in flight. An acquire while the limit is
+  // reached completes when a release hands over its slot, the longest
+  // waiting acquire first. The completion handlers are called on
+  // their associated executor.
+  //
+  // \note can be called from any thread
+  //
+  struct InFlightLimit
+  {
+    explicit InFlightLimit (std::size_t limit) noexcept;
+
+    // Acquires without waiting, if possible.
+    //
+    [[nodiscard]] auto try_acquire() -> bool;
+
+    template<typename CompletionToken>
+      auto async_acquire (CompletionToken&&);
+
+    auto release() noexcept -> void;
+
+  private:
+    struct Waiter
+    {
+      Waiter() = default;
+      Waiter (Waiter const&) = delete;
+      Waiter (Waiter&&) = delete;
+      auto operator= (Waiter const&) -> Waiter& = delete;
+      auto operator= (Waiter&&) -> Waiter& = delete;
+      virtual ~Waiter() = default;
+
+      virtual auto resume() -> void = 0;
+    };
+    template<typename Handler> struct WaiterFor;
+
+    std::mutex _guard;
+    std::size_t const _limit;
+    std::size_t _in_flight {0};
+    std::deque<std::unique_ptr<Waiter>> _waiters;
+
+    // requires _guard to be locked
+    //
+    [[nodiscard]] auto acquire_locked() noexcept -> bool;
+  };
+}
+
+#include "detail/InFlightLimit.ipp"
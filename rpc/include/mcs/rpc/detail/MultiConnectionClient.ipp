@@ -0,0 +1,472 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <exception>
+#include <span>
+#include <utility>
+
+namespace mcs::rpc::multi_connection::detail
+{
+  template<typename Response>
+    struct SetPromise
+  {
+    std::promise<Response> promise;
+
+    auto operator() (Response response) -> void
+    {
+      promise.set_value (std::move (response));
+    }
+    auto operator() (std::exception_ptr error) -> void
+    {
+      promise.set_exception (error);
+    }
+  };
+
+  template<>
+    struct SetPromise<void>
+  {
+    std::promise<void> promise;
+
+    auto operator()() -> void
+    {
+      promise.set_value();
+    }
+    auto operator() (std::exception_ptr error) -> void
+    {
+      promise.set_exception (error);
+    }
+  };
+}
+
+namespace mcs::rpc
+{
+  template< is_protocol Protocol
+          , is_access_policy AccessPolicy
+          , multi_connection::is_distribution Distribution
+          , is_command... Commands
+          >
+    template<typename Handler>
+      struct MultiConnectionClient<Protocol, AccessPolicy, Distribution, Commands...>
+        ::CountingHandler
+  {
+    Handler handler;
+    Outstanding outstanding;
+
+    template<typename... Args>
+      auto operator() (Args&&... args) -> void
+    {
+      handler (std::forward<Args> (args)...);
+    }
+  };
+
+  template< is_protocol Protocol
+          , is_access_policy AccessPolicy
+          , multi_connection::is_distribution Distribution
+          , is_command... Commands
+          >
+    MultiConnectionClient<Protocol, AccessPolicy, Distribution, Commands...>
+      ::Outstanding::Outstanding
+        ( std::shared_ptr<State> state_
+        , std::size_t connection_
+        ) noexcept
+          : state {std::move (state_)}
+          , connection {connection_}
+  {
+    state->outstanding_calls[connection].fetch_add
+      (1, std::memory_order_relaxed);
+  }
+
+  template< is_protocol Protocol
+          , is_access_policy AccessPolicy
+          , multi_connection::is_distribution Distribution
+          , is_command... Commands
+          >
+    MultiConnectionClient<Protocol, AccessPolicy, Distribution, Commands...>
+      ::Outstanding::Outstanding
+        ( Outstanding&& other
+        ) noexcept
+          : state {std::move (other.state)}
+          , connection {other.connection}
+  {}
+
+  template< is_protocol Protocol
+          , is_access_policy AccessPolicy
+          , multi_connection::is_distribution Distribution
+          , is_command... Commands
+          >
+    MultiConnectionClient<Protocol, AccessPolicy, Distribution, Commands...>
+      ::Outstanding::~Outstanding()
+  {
+    if (state)
+    {
+      state->outstanding_calls[connection].fetch_sub
+        (1, std::memory_order_relaxed);
+    }
+  }
+
+  template< is_protocol Protocol
+          , is_access_policy AccessPolicy
+          , multi_connection::is_distribution Distribution
+          , is_command... Commands
+          >
+    template<typename... DistributionArgs>
+      MultiConnectionClient<Protocol, AccessPolicy, Distribution, Commands...>
+        ::State::State
+          ( std::vector<Connection> connections_
+          , DistributionArgs&&... distribution_args
+          )
+            : connections {std::move (connections_)}
+            , outstanding_calls (connections.size())
+            , distribution {std::forward<DistributionArgs> (distribution_args)...}
+  {}
+
+  template< is_protocol Protocol
+          , is_access_policy AccessPolicy
+          , multi_connection::is_distribution Distribution
+          , is_command... Commands
+          >
+    template<typename Executor, typename Endpoint>
+      auto MultiConnectionClient<Protocol, AccessPolicy, Distribution, Commands...>
+        ::connect
+          ( Executor& executor
+          , Endpoint endpoint
+          , multi_connection::NumberOfConnections number_of_connections
+          ) -> std::vector<Connection>
+  {
+    auto connections {std::vector<Connection>{}};
+    connections.reserve (number_of_connections.value);
+
+    for (auto i {std::size_t {0}}; i < number_of_connections.value; ++i)
+    {
+      connections.emplace_back
+        (executor, endpoint, std::make_shared<AccessPolicy>());
+    }
+
+    return connections;
+  }
+
+  template< is_protocol Protocol
+          , is_access_policy AccessPolicy
+          , multi_connection::is_distribution Distribution
+          , is_command... Commands
+          >
+    template<typename Executor, typename... DistributionArgs>
+      requires (std::is_constructible_v<Distribution, DistributionArgs...>)
+      MultiConnectionClient<Protocol, AccessPolicy, Distribution, Commands...>
+        ::MultiConnectionClient
+          ( Executor& executor
+          , typename Protocol::endpoint endpoint
+          , multi_connection::NumberOfConnections number_of_connections
+          , DistributionArgs&&... distribution_args
+          )
+            : _state
+              { std::make_shared<State>
+                  ( connect (executor, endpoint, number_of_connections)
+                  , std::forward<DistributionArgs> (distribution_args)...
+                  )
+              }
+  {}
+
+  template< is_protocol Protocol
+          , is_access_policy AccessPolicy
+          , multi_connection::is_distribution Distribution
+          , is_command... Commands
+          >
+    template<typename Executor, typename... DistributionArgs>
+      requires (std::is_constructible_v<Distribution, DistributionArgs...>)
+      MultiConnectionClient<Protocol, AccessPolicy, Distribution, Commands...>
+        ::MultiConnectionClient
+          ( Executor& executor
+          , util::ASIO::Connectable<Protocol> connectable
+          , multi_connection::NumberOfConnections number_of_connections
+          , DistributionArgs&&... distribution_args
+          )
+            : _state
+              { std::make_shared<State>
+                  ( connect (executor, connectable, number_of_connections)
+                  , std::forward<DistributionArgs> (distribution_args)...
+                  )
+              }
+  {}
+
+  template< is_protocol Protocol
+          , is_access_policy AccessPolicy
+          , multi_connection::is_distribution Distribution
+          , is_command... Commands
+          >
+    auto MultiConnectionClient<Protocol, AccessPolicy, Distribution, Commands...>
+      ::number_of_connections
+        (
+        ) const noexcept -> std::size_t
+  {
+    return _state->connections.size();
+  }
+
+  template< is_protocol Protocol
+          , is_access_policy AccessPolicy
+          , multi_connection::is_distribution Distribution
+          , is_command... Commands
+          >
+    auto MultiConnectionClient<Protocol, AccessPolicy, Distribution, Commands...>
+      ::outstanding_calls
+        (
+        ) const -> std::vector<std::size_t>
+  {
+    auto outstanding_calls {std::vector<std::size_t>{}};
+    outstanding_calls.reserve (_state->outstanding_calls.size());
+
+    for (auto const& outstanding : _state->outstanding_calls)
+    {
+      outstanding_calls.emplace_back
+        (outstanding.load (std::memory_order_relaxed));
+    }
+
+    return outstanding_calls;
+  }
+
+  template< is_protocol Protocol
+          , is_access_policy AccessPolicy
+          , multi_connection::is_distribution Distribution
+          , is_command... Commands
+          >
+    auto MultiConnectionClient<Protocol, AccessPolicy, Distribution, Commands...>
+      ::select
+        (
+        ) const -> Outstanding
+  {
+    auto const connection
+      { _state->distribution.select
+          ( std::span<std::atomic<std::size_t> const>
+              {_state->outstanding_calls}
+          )
+      };
+
+    return Outstanding {_state, connection};
+  }
+}
+
+// deliver the command by reference
+//
+namespace mcs::rpc
+{
+  template< is_protocol Protocol
+          , is_access_policy AccessPolicy
+          , multi_connection::is_distribution Distribution
+          , is_command... Commands
+          >
+    template<is_command Command>
+      requires (is_one_of_the_commands<Command, Commands...>)
+        auto MultiConnectionClient<Protocol, AccessPolicy, Distribution, Commands...>
+          ::get_future
+            ( std::reference_wrapper<Command const> command_ref
+            ) const -> std::future<typename Command::Response>
+  {
+    auto promise {std::promise<typename Command::Response>{}};
+    auto future {promise.get_future()};
+
+    (*this)
+      ( command_ref
+      , multi_connection::detail::SetPromise<typename Command::Response>
+          {std::move (promise)}
+      );
+
+    return future;
+  }
+  template< is_protocol Protocol
+          , is_access_policy AccessPolicy
+          , multi_connection::is_distribution Distribution
+          , is_command... Commands
+          >
+    template<is_command Command>
+      requires (is_one_of_the_commands<Command, Commands...>)
+        auto MultiConnectionClient<Protocol, AccessPolicy, Distribution, Commands...>
+          ::operator()
+            ( std::reference_wrapper<Command const> command_ref
+            ) const -> typename Command::Response
+  {
+    return get_future (command_ref).get();
+  }
+}
+
+// deliver the command by constructor arguments
+//
+namespace mcs::rpc
+{
+  template< is_protocol Protocol
+          , is_access_policy AccessPolicy
+          , multi_connection::is_distribution Distribution
+          , is_command... Commands
+          >
+    template<is_command Command, typename... CommandArgs>
+      requires ( std::is_constructible_v<Command, CommandArgs...>
+              && is_one_of_the_commands<Command, Commands...>
+               )
+      auto MultiConnectionClient<Protocol, AccessPolicy, Distribution, Commands...>
+        ::async_call
+          ( CommandArgs&&... command_args
+          ) const -> std::future<typename Command::Response>
+  {
+    return get_future (Command {std::forward<CommandArgs> (command_args)...});
+  }
+  template< is_protocol Protocol
+          , is_access_policy AccessPolicy
+          , multi_connection::is_distribution Distribution
+          , is_command... Commands
+          >
+    template<is_command Command, typename... CommandArgs>
+      requires ( std::is_constructible_v<Command, CommandArgs...>
+              && is_one_of_the_commands<Command, Commands...>
+               )
+      auto MultiConnectionClient<Protocol, AccessPolicy, Distribution, Commands...>
+        ::call
+          ( CommandArgs&&... command_args
+          ) const -> typename Command::Response
+  {
+    return async_call<Command> (std::forward<CommandArgs> (command_args)...)
+      .get();
+  }
+}
+
+// deliver the command as rvalue
+//
+namespace mcs::rpc
+{
+  template< is_protocol Protocol
+          , is_access_policy AccessPolicy
+          , multi_connection::is_distribution Distribution
+          , is_command... Commands
+          >
+    template<is_command Command>
+      requires (is_one_of_the_commands<Command, Commands...>)
+      auto MultiConnectionClient<Protocol, AccessPolicy, Distribution, Commands...>
+        ::get_future
+          ( Command&& command
+          ) const -> std::future<typename Command::Response>
+  {
+    auto promise {std::promise<typename Command::Response>{}};
+    auto future {promise.get_future()};
+
+    (*this)
+      ( std::forward<Command> (command)
+      , multi_connection::detail::SetPromise<typename Command::Response>
+          {std::move (promise)}
+      );
+
+    return future;
+  }
+  template< is_protocol Protocol
+          , is_access_policy AccessPolicy
+          , multi_connection::is_distribution Distribution
+          , is_command... Commands
+          >
+    template<is_command Command>
+      requires (is_one_of_the_commands<Command, Commands...>)
+      auto MultiConnectionClient<Protocol, AccessPolicy, Distribution, Commands...>
+        ::operator()
+          ( Command&& command
+          ) const -> typename Command::Response
+  {
+    return get_future (std::forward<Command> (command)).get();
+  }
+}
+
+// deliver the response to a completion handler
+//
+namespace mcs::rpc
+{
+  template< is_protocol Protocol
+          , is_access_policy AccessPolicy
+          , multi_connection::is_distribution Distribution
+          , is_command... Commands
+          >
+    template<is_command Command, typename Handler>
+      requires ( is_one_of_the_commands<Command, Commands...>
+              && is_completion_handler_for_command<Handler, Command>
+               )
+      auto MultiConnectionClient<Protocol, AccessPolicy, Distribution, Commands...>
+        ::operator()
+          ( std::reference_wrapper<Command const> command_ref
+          , Handler handler
+          ) const -> void
+  {
+    auto outstanding {select()};
+    auto const& connection {_state->connections[outstanding.connection]};
+
+    return connection
+      ( command_ref
+      , CountingHandler<Handler> {std::move (handler), std::move (outstanding)}
+      );
+  }
+  template< is_protocol Protocol
+          , is_access_policy AccessPolicy
+          , multi_connection::is_distribution Distribution
+          , is_command... Commands
+          >
+    template<is_command Command, typename Handler>
+      requires ( is_one_of_the_commands<Command, Commands...>
+              && is_completion_handler_for_command<Handler, Command>
+               )
+      auto MultiConnectionClient<Protocol, AccessPolicy, Distribution, Commands...>
+        ::operator()
+          ( Command&& command
+          , Handler handler
+          ) const -> void
+  {
+    auto outstanding {select()};
+    auto const& connection {_state->connections[outstanding.connection]};
+
+    return connection
+      ( std::forward<Command> (command)
+      , CountingHandler<Handler> {std::move (handler), std::move (outstanding)}
+      );
+  }
+}
+
+namespace mcs::rpc
+{
+  template< is_protocol Protocol
+          , typename Dispatcher
+          , is_access_policy AccessPolicy
+          , multi_connection::is_distribution Distribution
+          , typename Executor
+          >
+    requires ( std::is_default_constructible_v<AccessPolicy>
+            && std::is_default_constructible_v<Distribution>
+             )
+    auto make_multi_connection_client
+      ( Executor& executor
+      , typename Protocol::endpoint endpoint
+      , multi_connection::NumberOfConnections number_of_connections
+      )
+  {
+    return typename Dispatcher::template MultiConnectionClientType
+      <Protocol, AccessPolicy, Distribution>
+        { executor
+        , endpoint
+        , number_of_connections
+        };
+  }
+
+  template< is_protocol Protocol
+          , typename Dispatcher
+          , is_access_policy AccessPolicy
+          , multi_connection::is_distribution Distribution
+          , typename Executor
+          >
+    requires ( std::is_default_constructible_v<AccessPolicy>
+            && std::is_default_constructible_v<Distribution>
+             )
+    auto make_multi_connection_client
+      ( Executor& executor
+      , util::ASIO::Connectable<Protocol> connectable
+      , multi_connection::NumberOfConnections number_of_connections
+      )
+  {
+    return typename Dispatcher::template MultiConnectionClientType
+      <Protocol, AccessPolicy, Distribution>
+        { executor
+        , connectable
+        , number_of_connections
+        };
+  }
+}
@@ -4,17 +4,24 @@
 #include <asio/bind_executor.hpp>
 #include <asio/co_spawn.hpp>
 #include <asio/detached.hpp>
+#include <asio/ip/tcp.hpp>
 #include <asio/strand.hpp>
 #include <asio/this_coro.hpp>
 #include <asio/use_awaitable.hpp>
 #include <asio/write.hpp>
+#include <cstddef>
 #include <exception>
+#include <fmt/format.h>
+#include <limits>
 #include <mcs/rpc/detail/Buffer.hpp>
+#include <mcs/rpc/detail/ResponseQueue.hpp>
 #include <mcs/rpc/detail/ResultHolder.hpp>
 #include <mcs/rpc/detail/receive_buffer_with_header.hpp>
 #include <mcs/serialization/OArchive.hpp>
+#include <mcs/util/ASIO/Connectable.hpp>
 #include <mcs/util/ASIO/SetSocketOptions.hpp>
 #include <memory>
+#include <type_traits>
 #include <utility>
 
 namespace mcs::rpc
@@ -25,12 +32,65 @@ namespace mcs::rpc
         ( typename Protocol::endpoint endpoint
         , Executor& executor
         , HandlerArgs... handler_args
+        )
+          : Provider {endpoint, Options{}, executor, handler_args...}
+  {}
+
+  template<is_protocol Protocol, typename Dispatcher, typename... HandlerArgs>
+    template<typename Executor>
+      Provider<Protocol, Dispatcher, HandlerArgs...>::Provider
+        ( typename Protocol::endpoint endpoint
+        , Options options
+        , Executor& executor
+        , HandlerArgs... handler_args
         )
           : _acceptor {executor, endpoint}
   {
+    if ( options.admission.max_requests()
+       != std::numeric_limits<std::size_t>::max()
+       )
+    {
+      _in_flight = std::make_shared<detail::InFlightLimit>
+        (options.admission.max_requests());
+    }
+
+    if constexpr (Dispatcher::has_blocking_commands)
+    {
+      _blocking_pool = std::make_shared<asio::thread_pool>
+        (options.blocking_pool.number_of_threads());
+    }
+
+    auto const connections
+      { Connections
+        { options.per_core_io_contexts
+        , options.response_batching
+        , options.admission
+        , _in_flight
+        , _buffer_pool_counters
+        , _statistics_counters
+        , _blocking_pool
+        }
+      };
+
+    if (options.same_host)
+    {
+      if constexpr (!std::is_same_v<Protocol, asio::ip::tcp>)
+      {
+        throw typename Error::SameHostRequiresTCP{};
+      }
+
+      _same_host_acceptor.emplace (executor, *options.same_host);
+
+      asio::co_spawn
+        ( executor
+        , accept_clients (*_same_host_acceptor, connections, handler_args...)
+        , asio::detached
+        );
+    }
+
     asio::co_spawn
       ( executor
-      , accept_clients (handler_args...)
+      , accept_clients (_acceptor, connections, handler_args...)
       , asio::detached
       );
   }
@@ -44,61 +104,196 @@ namespace mcs::rpc
   }
 
   template<is_protocol Protocol, typename Dispatcher, typename... HandlerArgs>
-    auto Provider<Protocol, Dispatcher, HandlerArgs...>::accept_clients
-      ( HandlerArgs... handler_args
-      ) -> asio::awaitable<void>
+    auto Provider<Protocol, Dispatcher, HandlerArgs...>::same_host_endpoint
+      (
+      ) const -> std::optional<asio::local::stream_protocol::endpoint>
   {
-    auto executor {co_await asio::this_coro::executor};
+    if (!_same_host_acceptor)
+    {
+      return {};
+    }
+
+    return _same_host_acceptor->local_endpoint();
+  }
+
+  template<is_protocol Protocol, typename Dispatcher, typename... HandlerArgs>
+    auto Provider<Protocol, Dispatcher, HandlerArgs...>::connection_information
+      (
+      ) const -> util::ASIO::Connectable<Protocol>
+  {
+    auto connectable {util::ASIO::make_connectable (local_endpoint())};
+
+    if constexpr (std::is_same_v<Protocol, asio::ip::tcp>)
+    {
+      if (auto const same_host {same_host_endpoint()})
+      {
+        connectable.same_host = util::ASIO::make_connectable (*same_host);
+      }
+    }
+
+    return connectable;
+  }
+
+  template<is_protocol Protocol, typename Dispatcher, typename... HandlerArgs>
+    auto Provider<Protocol, Dispatcher, HandlerArgs...>::buffer_pool_statistics
+      (
+      ) const noexcept -> BufferPoolStatistics
+  {
+    return _buffer_pool_counters->statistics();
+  }
+
+  template<is_protocol Protocol, typename Dispatcher, typename... HandlerArgs>
+    auto Provider<Protocol, Dispatcher, HandlerArgs...>::statistics
+      (
+      ) const -> Statistics
+  {
+    return _statistics_counters->statistics();
+  }
 
+  template<is_protocol Protocol, typename Dispatcher, typename... HandlerArgs>
+    template<is_protocol AcceptorProtocol>
+      auto Provider<Protocol, Dispatcher, HandlerArgs...>::accept_clients
+        ( util::ASIO::ListeningAcceptor<AcceptorProtocol>& acceptor
+        , Connections connections
+        , HandlerArgs... handler_args
+        ) -> asio::awaitable<void>
+  {
     while (true)
     {
-      auto socket {co_await _acceptor.async_accept()};
+      // \note not a conditional expression: gcc 12 destroys the
+      // awaitable of a co_awaited conditional expression twice
+      //
+      auto socket
+        { co_await [&]
+          {
+            if (connections.per_core_io_contexts != nullptr)
+            {
+              return acceptor.async_accept
+                (connections.per_core_io_contexts->next());
+            }
+
+            return acceptor.async_accept();
+          }()
+        };
+
+      // the connection runs on the executor of its socket
+      auto executor {socket.get_executor()};
 
       asio::co_spawn
         ( executor
-        , dispatch (std::move (socket), handler_args...)
+        , dispatch<AcceptorProtocol>
+            (std::move (socket), connections, handler_args...)
         , asio::detached
         );
     }
   }
 
   template<is_protocol Protocol, typename Dispatcher, typename... HandlerArgs>
-    auto Provider<Protocol, Dispatcher, HandlerArgs...>::dispatch
-      ( typename Protocol::socket socket
-      , HandlerArgs... handler_args
-      ) -> asio::awaitable<void>
+    template<is_protocol SocketProtocol>
+      auto Provider<Protocol, Dispatcher, HandlerArgs...>::dispatch
+        ( typename SocketProtocol::socket accepted
+        , Connections connections
+        , HandlerArgs... handler_args
+        ) -> asio::awaitable<void>
   try
   {
-    util::ASIO::SetSocketOptions<Protocol>{} (socket);
+    // shared with the response queue, its pending writes and timers
+    // might outlive the connection
+    auto const socket
+      { std::make_shared<typename SocketProtocol::socket>
+          (std::move (accepted))
+      };
+
+    util::ASIO::SetSocketOptions<SocketProtocol>{} (*socket);
 
     {
       auto const data {Dispatcher::handshake_data()};
       auto const oa {serialization::OArchive {data}};
 
-      co_await asio::async_write (socket, oa.buffers(), asio::use_awaitable);
+      co_await asio::async_write (*socket, oa.buffers(), asio::use_awaitable);
     }
 
     auto executor {co_await asio::this_coro::executor};
     auto strand {asio::make_strand (executor)};
-    auto dispatcher {Dispatcher {handler_args...}};
+    auto dispatcher
+      { Dispatcher
+        { connections.blocking_pool
+          ? std::optional {connections.blocking_pool->get_executor()}
+          : std::nullopt
+        , detail::StatisticsCounters::connect
+            ( std::move (connections.statistics_counters)
+            , fmt::format
+                ( "{}"
+                , util::ASIO::make_connectable (socket->remote_endpoint())
+                )
+            )
+        , handler_args...
+        }
+      };
+    auto responses
+      { std::make_shared
+          < detail::ResponseQueue< typename SocketProtocol::socket
+                                 , decltype (executor)
+                                 >
+          > (socket, strand, connections.response_batching)
+      };
+    auto buffer_pool
+      { std::make_shared<detail::BufferPool>
+          (std::move (connections.buffer_pool_counters))
+      };
+    auto const in_flight {std::move (connections.in_flight)};
+    auto const in_flight_of_connection
+      { connections.admission.max_requests_per_connection()
+          != std::numeric_limits<std::size_t>::max()
+        ? std::make_shared<detail::InFlightLimit>
+            (connections.admission.max_requests_per_connection())
+        : nullptr
+      };
 
     auto error {std::exception_ptr{}};
 
-    while (!error)
+    while (!error && !responses->failed())
     {
+      // the connection is not read while it is at its limit
+      if ( in_flight_of_connection
+         && !in_flight_of_connection->try_acquire()
+         )
+      {
+        co_await in_flight_of_connection->async_acquire (asio::use_awaitable);
+      }
+
       auto response
-        {co_await detail::receive_buffer_with_header<typename Dispatcher::Header> (socket)};
+        { co_await detail::receive_buffer_with_header<typename Dispatcher::Header>
+            (*socket, *buffer_pool)
+        };
+      auto const received {detail::StatisticsCounters::Clock::now()};
+
+      // the connection is not read while the request waits
+      if (in_flight && !in_flight->try_acquire())
+      {
+        co_await in_flight->async_acquire (asio::use_awaitable);
+      }
 
       asio::co_spawn
         ( executor
-        , dispatcher.template dispatch<Protocol> (std::move (response), socket)
+        , dispatcher.template dispatch<SocketProtocol>
+            (std::move (response), received, *socket)
         , asio::bind_executor
           ( strand
-          , [&]
+          , [&, responses, in_flight, in_flight_of_connection]
               ( std::exception_ptr rpc_error
               , detail::ResultHolder result_holder
               ) noexcept
             {
+              if (in_flight)
+              {
+                in_flight->release();
+              }
+              if (in_flight_of_connection)
+              {
+                in_flight_of_connection->release();
+              }
+
               if (rpc_error)
               {
                 error = rpc_error;
@@ -106,17 +301,9 @@ namespace mcs::rpc
               else
               {
                 // \note the write might fail in case that the client
-                // has been destroyed, exceptions must be catched to
-                // prevent from terminate as the completion handler
-                // must be noexcept
-                try
-                {
-                  asio::write (socket, result_holder.archive().buffers());
-                }
-                catch (...)
-                {
-                  error = std::current_exception();
-                }
+                // has been destroyed, the queue remembers the failure
+                // and stops the connection
+                responses->push (std::move (result_holder));
               }
             }
           )
@@ -134,6 +321,40 @@ namespace mcs::rpc
 
 namespace mcs::rpc
 {
+  template<is_protocol Protocol, typename Dispatcher, typename... HandlerArgs>
+    Provider<Protocol, Dispatcher, HandlerArgs...>::Error::SameHostRequiresTCP::SameHostRequiresTCP
+      (
+      ) noexcept
+        : mcs::Error {"Same host endpoint of the provider requires ip::tcp."}
+  {}
+  template<is_protocol Protocol, typename Dispatcher, typename... HandlerArgs>
+    Provider<Protocol, Dispatcher, HandlerArgs...>::Error::SameHostRequiresTCP::~SameHostRequiresTCP
+      (
+      ) = default
+    ;
+}
+
+namespace mcs::rpc
+{
+  template< is_protocol Protocol
+          , typename Dispatcher
+          , typename Executor
+          , typename... HandlerArgs
+          >
+    requires (std::is_constructible_v<typename Dispatcher::HandlerType, HandlerArgs...>)
+    auto make_provider
+      ( typename Protocol::endpoint endpoint
+      , Executor& executor
+      , HandlerArgs... handler_args
+      ) -> Provider<Protocol, Dispatcher, HandlerArgs...>
+  {
+    return Provider<Protocol, Dispatcher, HandlerArgs...>
+      { endpoint
+      , executor
+      , handler_args...
+      };
+  }
+
   template< is_protocol Protocol
           , typename Dispatcher
           , typename Executor
@@ -142,12 +363,14 @@ namespace mcs::rpc
     requires (std::is_constructible_v<typename Dispatcher::HandlerType, HandlerArgs...>)
     auto make_provider
       ( typename Protocol::endpoint endpoint
+      , provider::Options options
       , Executor& executor
       , HandlerArgs... handler_args
       ) -> Provider<Protocol, Dispatcher, HandlerArgs...>
   {
     return Provider<Protocol, Dispatcher, HandlerArgs...>
       { endpoint
+      , std::move (options)
       , executor
       , handler_args...
       };
@@ -0,0 +1,16 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+namespace mcs::rpc
+{
+  constexpr ResponseBatching::MaxResponses::MaxResponses
+    ( std::size_t value_
+    ) noexcept
+      : value {value_}
+  {}
+  constexpr ResponseBatching::MaxLatency::MaxLatency
+    ( std::chrono::microseconds value_
+    ) noexcept
+      : value {value_}
+  {}
+}
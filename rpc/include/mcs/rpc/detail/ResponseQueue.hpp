@@ -0,0 +1,76 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <asio/buffer.hpp>
+#include <asio/steady_timer.hpp>
+#include <asio/strand.hpp>
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <mcs/rpc/ResponseBatching.hpp>
+#include <mcs/rpc/detail/ResultHolder.hpp>
+#include <mcs/serialization/OArchive.hpp>
+#include <memory>
+#include <vector>
+
+namespace mcs::rpc::detail
+{
+  // Per connection queue of responses that are ready to be sent. At
+  // most one write is in flight, responses that become ready in the
+  // meantime are gathered into the next write, see ResponseBatching.
+  //
+  // All member functions must be called on the strand.
+  //
+  template<typename Socket, typename Executor>
+    struct ResponseQueue
+      : public std::enable_shared_from_this<ResponseQueue<Socket, Executor>>
+  {
+    // The socket is shared with the connection: Pending writes and
+    // timers keep the queue and the socket alive after the connection
+    // has ended.
+    //
+    ResponseQueue
+      ( std::shared_ptr<Socket>
+      , asio::strand<Executor>
+      , ResponseBatching
+      );
+
+    auto push (ResultHolder) -> void;
+
+    // Whether or not a write has failed. A failed queue drops all
+    // responses.
+    //
+    // \note can be called from any thread
+    //
+    [[nodiscard]] auto failed() const noexcept -> bool;
+
+  private:
+    // The archive refers to the result holder, both do not move.
+    //
+    struct Response
+    {
+      explicit Response (ResultHolder);
+
+      ResultHolder result_holder;
+      serialization::OArchive archive;
+    };
+
+    std::shared_ptr<Socket> _socket;
+    asio::strand<Executor> _strand;
+    ResponseBatching _batching;
+    asio::steady_timer _timer;
+    std::deque<std::unique_ptr<Response>> _responses;
+    std::vector<asio::const_buffer> _buffers;
+    bool _writing {false};
+    std::atomic<bool> _failed {false};
+
+    auto start_write() -> void;
+    auto write_batch() -> void;
+    auto written (std::size_t batch) -> void;
+    auto fail() -> void;
+  };
+}
+
+#include "detail/ResponseQueue.ipp"
@@ -3,10 +3,13 @@
 
 #pragma once
 
+#include <cstddef>
 #include <functional>
 #include <mcs/rpc/detail/CallID.hpp>
 #include <mcs/rpc/detail/ResultOrError.hpp>
+#include <mcs/rpc/detail/StatisticsCounters.hpp>
 #include <mcs/serialization/OArchive.hpp>
+#include <memory>
 
 namespace mcs::rpc::detail
 {
@@ -29,6 +32,11 @@ namespace mcs::rpc::detail
     auto operator= (ResultHolder&&) noexcept -> ResultHolder& = default;
 
     std::function<serialization::OArchive()> archive;
+
+    // Where to count the size of the response, if anywhere.
+    //
+    std::shared_ptr<StatisticsCounters::Connection> statistics;
+    std::size_t command {0};
   };
 }
 
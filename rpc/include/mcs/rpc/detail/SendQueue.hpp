@@ -0,0 +1,83 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mcs/serialization/OArchive.hpp>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace mcs::rpc::detail
+{
+  // Per connection queue of serialized calls. Calls are sent in the
+  // order in which they have been pushed. At most one thread sends at
+  // any time: The first caller of send() that finds the queue idle
+  // becomes the writer and sends all calls that are pushed until the
+  // queue runs empty, calls that have been queued during a write are
+  // gathered into a single write.
+  //
+  // The other callers of send() wait until the calls that have been
+  // pushed before have been written: The buffers of a call refer to
+  // data of its caller, e.g. the payload of a put, and streaming
+  // calls read from the caller while they are written.
+  //
+  struct SendQueue
+  {
+    struct Call
+    {
+      Call() = default;
+      Call (Call const&) = delete;
+      Call (Call&&) = delete;
+      auto operator= (Call const&) -> Call& = delete;
+      auto operator= (Call&&) -> Call& = delete;
+      virtual ~Call() = default;
+
+      [[nodiscard]] virtual auto buffers
+        (
+        ) const noexcept -> serialization::OArchive::Buffers const& = 0;
+
+      // Streaming calls write additional data directly to the socket
+      // after their buffers have been written.
+      //
+      [[nodiscard]] virtual auto is_streaming() const noexcept -> bool = 0;
+      virtual auto stream() -> void = 0;
+    };
+
+    // Pre: The caller holds the send lock of the access policy, that
+    // makes the order of the queue the order of the call ids.
+    //
+    auto push (std::unique_ptr<Call>) -> void;
+
+    // Sends all queued calls unless another thread is sending
+    // already, then waits until the calls that have been pushed
+    // before have been written or dropped. If a write fails, then all
+    // queued calls are dropped and on_error is called with the error.
+    //
+    template<typename Socket, typename OnError>
+      requires (std::is_invocable_v<OnError, std::exception_ptr>)
+      auto send (Socket&, OnError&&) -> void;
+
+  private:
+    // Returns true if the caller has become the writer, otherwise
+    // waits for the writer.
+    //
+    [[nodiscard]] auto start_sending_or_wait() -> bool;
+    [[nodiscard]] auto take() -> std::vector<std::unique_ptr<Call>>;
+    auto written (std::size_t) -> void;
+    auto stop_sending() noexcept -> void;
+
+    std::mutex _guard;
+    std::condition_variable _written_or_dropped;
+    std::vector<std::unique_ptr<Call>> _calls;
+    std::size_t _pushed {0};
+    std::size_t _done {0};
+    bool _sending {false};
+  };
+}
+
+#include "detail/SendQueue.ipp"
@@ -0,0 +1,140 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <algorithm>
+#include <bit>
+#include <fmt/format.h>
+#include <mcs/util/FMT/define.hpp>
+#include <numeric>
+
+namespace mcs::rpc
+{
+  constexpr auto LatencyHistogram::bucket
+    ( std::chrono::nanoseconds latency
+    ) noexcept -> std::size_t
+  {
+    auto const microseconds
+      {std::chrono::duration_cast<std::chrono::microseconds> (latency).count()};
+
+    if (microseconds <= 0)
+    {
+      return 0;
+    }
+
+    return std::min<std::size_t>
+      ( std::bit_width (static_cast<std::uint64_t> (microseconds))
+      , NumberOfBuckets - 1
+      );
+  }
+
+  constexpr auto LatencyHistogram::count() const noexcept -> std::uint64_t
+  {
+    return std::accumulate
+      (std::begin (counts), std::end (counts), std::uint64_t {0});
+  }
+}
+
+namespace fmt
+{
+  MCS_UTIL_FMT_DEFINE_PARSE (ctx, mcs::rpc::LatencyHistogram)
+  {
+    return ctx.begin();
+  }
+  MCS_UTIL_FMT_DEFINE_FORMAT (histogram, ctx, mcs::rpc::LatencyHistogram)
+  {
+    using mcs::rpc::LatencyHistogram;
+
+    auto out {fmt::format_to (ctx.out(), "{{")};
+    auto separator {""};
+
+    for ( auto bucket {std::size_t {0}}
+        ; bucket < LatencyHistogram::NumberOfBuckets
+        ; ++bucket
+        )
+    {
+      if (histogram.counts[bucket] == 0)
+      {
+        continue;
+      }
+
+      out = bucket + 1 < LatencyHistogram::NumberOfBuckets
+        ? fmt::format_to
+            ( out
+            , "{}<{}us: {}"
+            , separator
+            , std::uint64_t {1} << bucket
+            , histogram.counts[bucket]
+            )
+        : fmt::format_to
+            ( out
+            , "{}>={}us: {}"
+            , separator
+            , std::uint64_t {1} << (bucket - 1)
+            , histogram.counts[bucket]
+            )
+        ;
+      separator = ", ";
+    }
+
+    return fmt::format_to (out, "}}");
+  }
+
+  MCS_UTIL_FMT_DEFINE_PARSE (ctx, mcs::rpc::CommandStatistics)
+  {
+    return ctx.begin();
+  }
+  MCS_UTIL_FMT_DEFINE_FORMAT (command, ctx, mcs::rpc::CommandStatistics)
+  {
+    return fmt::format_to
+      ( ctx.out()
+      , "{}: calls {}, errors {}, bytes in {}, bytes out {}"
+        ", queueing {}, handling {}"
+      , command.command
+      , command.calls
+      , command.errors
+      , command.bytes_in
+      , command.bytes_out
+      , command.queueing
+      , command.handling
+      );
+  }
+
+  MCS_UTIL_FMT_DEFINE_PARSE (ctx, mcs::rpc::ConnectionStatistics)
+  {
+    return ctx.begin();
+  }
+  MCS_UTIL_FMT_DEFINE_FORMAT (connection, ctx, mcs::rpc::ConnectionStatistics)
+  {
+    return fmt::format_to
+      ( ctx.out()
+      , "{}: requests {}, bytes in {}, bytes out {}"
+      , connection.peer
+      , connection.requests
+      , connection.bytes_in
+      , connection.bytes_out
+      );
+  }
+
+  MCS_UTIL_FMT_DEFINE_PARSE (ctx, mcs::rpc::Statistics)
+  {
+    return ctx.begin();
+  }
+  MCS_UTIL_FMT_DEFINE_FORMAT (statistics, ctx, mcs::rpc::Statistics)
+  {
+    auto out {fmt::format_to (ctx.out(), "commands:\n")};
+
+    for (auto const& command : statistics.commands)
+    {
+      out = fmt::format_to (out, "  {}\n", command);
+    }
+
+    out = fmt::format_to (out, "connections:\n");
+
+    for (auto const& connection : statistics.connections)
+    {
+      out = fmt::format_to (out, "  {}\n", connection);
+    }
+
+    return out;
+  }
+}
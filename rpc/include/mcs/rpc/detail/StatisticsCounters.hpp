@@ -0,0 +1,107 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mcs/rpc/Statistics.hpp>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace mcs::rpc::detail
+{
+  // The counters behind Statistics. There is one instance per
+  // provider, shared by all of its connections.
+  //
+  // \note can be called from any thread
+  //
+  struct StatisticsCounters
+  {
+    using Clock = std::chrono::steady_clock;
+
+    struct Histogram
+    {
+      auto add (Clock::duration) noexcept -> void;
+
+      [[nodiscard]] auto histogram() const noexcept -> LatencyHistogram;
+
+    private:
+      std::array
+        < std::atomic<std::uint64_t>
+        , LatencyHistogram::NumberOfBuckets
+        > _counts {};
+    };
+
+    struct Command
+    {
+      std::atomic<std::uint64_t> calls {0};
+      std::atomic<std::uint64_t> errors {0};
+      std::atomic<std::uint64_t> bytes_in {0};
+      std::atomic<std::uint64_t> bytes_out {0};
+      Histogram queueing;
+      Histogram handling;
+    };
+
+    // The counters of a connection. Counts into the counters of the
+    // commands, too.
+    //
+    struct Connection
+    {
+      Connection (std::shared_ptr<StatisticsCounters>, std::string peer);
+
+      auto received (std::size_t command, std::size_t bytes) noexcept -> void;
+      auto handled
+        ( std::size_t command
+        , Clock::time_point received
+        , Clock::time_point started
+        , bool is_error
+        ) noexcept -> void;
+      auto sent (std::size_t command, std::size_t bytes) noexcept -> void;
+
+      [[nodiscard]] auto statistics() const -> ConnectionStatistics;
+
+      // The counters of the provider the connection belongs to.
+      //
+      [[nodiscard]] auto counters() const noexcept
+        -> StatisticsCounters const&
+        ;
+
+    private:
+      std::shared_ptr<StatisticsCounters> _counters;
+      std::string _peer;
+      std::atomic<std::uint64_t> _requests {0};
+      std::atomic<std::uint64_t> _bytes_in {0};
+      std::atomic<std::uint64_t> _bytes_out {0};
+    };
+
+    // The commands are given by their type names, e.g. the handshake
+    // data of the dispatcher.
+    //
+    explicit StatisticsCounters (std::vector<std::string> const& commands);
+
+    // Registers a connection. It is part of the statistics as long as
+    // the returned connection is alive.
+    //
+    [[nodiscard]] static auto connect
+      ( std::shared_ptr<StatisticsCounters>
+      , std::string peer
+      ) -> std::shared_ptr<Connection>
+      ;
+
+    [[nodiscard]] auto statistics() const -> Statistics;
+
+  private:
+    std::vector<std::string> _commands;
+    std::vector<Command> _counters;
+
+    mutable std::mutex _guard;
+    mutable std::list<std::weak_ptr<Connection>> _connections;
+  };
+}
@@ -0,0 +1,22 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <string>
+
+namespace mcs::rpc::detail
+{
+  // Returns: The demangled name, the name itself if it can not be
+  // demangled.
+  //
+  [[nodiscard]] auto demangle (std::string const&) -> std::string;
+
+  // Returns: The demangled name of the command, computed once per
+  // command.
+  //
+  template<typename Command>
+    [[nodiscard]] auto command_name() -> std::string const&;
+}
+
+#include "detail/command_name.ipp"
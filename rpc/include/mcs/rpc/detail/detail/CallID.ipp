@@ -18,6 +18,11 @@ namespace mcs::rpc::detail
 
     return old;
   }
+
+  constexpr auto CallID::value() const noexcept -> std::size_t
+  {
+    return _value;
+  }
 }
 
 namespace fmt
@@ -2,6 +2,7 @@
 // License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
 
 #include <mcs/rpc/detail/connected_socket.hpp>
+#include <memory>
 #include <utility>
 
 namespace mcs::rpc::detail
@@ -13,9 +14,29 @@ namespace mcs::rpc::detail
       ClientState<Protocol, AccessPolicy, Commands...>::ClientState
         ( std::shared_ptr<typename Protocol::socket> socket_
         , std::shared_ptr<AccessPolicy> access_policy_
+        )
+          : ClientState<Protocol, AccessPolicy, Commands...>
+            { std::move (socket_)
+            , std::move (access_policy_)
+            , std::make_shared<SendQueue>()
+            , std::make_shared<BufferPool>()
+            }
+  {}
+
+  template< is_protocol Protocol
+          , is_access_policy AccessPolicy
+          , is_command... Commands
+          >
+      ClientState<Protocol, AccessPolicy, Commands...>::ClientState
+        ( std::shared_ptr<typename Protocol::socket> socket_
+        , std::shared_ptr<AccessPolicy> access_policy_
+        , std::shared_ptr<SendQueue> send_queue_
+        , std::shared_ptr<BufferPool> buffer_pool_
         ) noexcept
           : socket {std::move (socket_)}
-          , access_policy {access_policy_}
+          , access_policy {std::move (access_policy_)}
+          , send_queue {std::move (send_queue_)}
+          , buffer_pool {std::move (buffer_pool_)}
   {}
 
   template< is_protocol Protocol
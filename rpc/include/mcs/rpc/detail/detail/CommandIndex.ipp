@@ -17,6 +17,10 @@ namespace mcs::rpc::detail
 
     return *this;
   }
+  constexpr auto CommandIndex::value() const noexcept -> std::size_t
+  {
+    return _value;
+  }
 
   template<typename T, typename Head, typename... Ts>
     constexpr auto command_index() noexcept -> CommandIndex
@@ -7,20 +7,54 @@
 #include <mcs/rpc/error/HandlerException.hpp>
 #include <mcs/util/overloaded.hpp>
 #include <memory>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
+#include <variant>
 
 namespace mcs::rpc::detail
 {
-  template<typename T>
-    constexpr Completion::Completion (std::promise<T> promise)
-      : _complete
-     //! \note std::function must be copy-constructible, therefore the
-     //! shared pointer.
-  { [_promise = std::make_shared<std::promise<T>> (std::move (promise))]
-      ( std::exception_ptr rpc_error
-      , Buffer buffer
-      ) mutable
+  namespace completion
+  {
+    template<typename T>
+      struct SetPromise
+    {
+      std::promise<T> promise;
+
+      auto operator() (std::exception_ptr error) -> void
+      {
+        promise.set_exception (error);
+      }
+      auto operator() (T value) -> void
+      {
+        promise.set_value (std::move (value));
+      }
+    };
+
+    template<>
+      struct SetPromise<void>
+    {
+      std::promise<void> promise;
+
+      auto operator() (std::exception_ptr error) -> void
+      {
+        promise.set_exception (error);
+      }
+      auto operator()() -> void
+      {
+        promise.set_value();
+      }
+    };
+
+    template<typename T>
+      using ResultOrException = std::variant<std::exception_ptr, Result<T>>;
+
+    template<typename T>
+      auto result_or_exception
+        ( std::exception_ptr rpc_error
+        , Buffer buffer
+        ) -> ResultOrException<T>
     {
       if (rpc_error)
       {
@@ -30,49 +64,211 @@ namespace mcs::rpc::detail
         }
         catch (...)
         {
-          _promise->set_exception (std::current_exception());
+          return std::current_exception();
         }
       }
-      else
+
+      try
       {
-        try
-        {
-          std::visit
-            ( util::overloaded
-              ( [&] (Error handler_error)
+        return std::visit
+          ( util::overloaded
+            ( [&] (Error handler_error) -> ResultOrException<T>
+              {
+                try
                 {
-                  try
-                  {
-                    // \todo rethrow the complete (de/serialized!)
-                    // exception
-                    throw error::HandlerError {handler_error.reason};
-                  }
-                  catch (...)
-                  {
-                    _promise->set_exception (std::current_exception());
-                  }
+                  // \todo rethrow the complete (de/serialized!)
+                  // exception
+                  throw error::HandlerError {handler_error.reason};
                 }
-              , [&] (Result<T> result)
+                catch (...)
                 {
-                  if constexpr (std::is_same_v<T, void>)
-                  {
-                     _promise->set_value();
-                  }
-                  else
-                  {
-                    _promise->set_value (std::move (result.value));
-                  }
+                  return std::current_exception();
                 }
+              }
+            , [&] (Result<T> result) noexcept
+                ( std::is_nothrow_constructible_v
+                    <ResultOrException<T>, Result<T>>
+                ) -> ResultOrException<T>
+              {
+                return result;
+              }
+            )
+          , buffer.template load<ResultOrError<T>>()
+          );
+      }
+      catch (...)
+      {
+        return std::current_exception();
+      }
+    }
+  }
+
+  namespace completion
+  {
+    template<typename Handler>
+      constexpr auto is_stored_in_place
+        {  sizeof (Handler) <= Completion::InPlaceSize
+        && alignof (Handler) <= alignof (std::max_align_t)
+        && std::is_nothrow_move_constructible_v<Handler>
+        };
+
+    template<typename Handler>
+      using Stored = std::conditional_t
+        < is_stored_in_place<Handler>
+        , Handler
+        , std::unique_ptr<Handler>
+        >;
+
+    template<typename Handler>
+      auto handler (void* stored) -> Handler&
+    {
+      if constexpr (is_stored_in_place<Handler>)
+      {
+        return *static_cast<Handler*> (stored);
+      }
+      else
+      {
+        return **static_cast<std::unique_ptr<Handler>*> (stored);
+      }
+    }
+
+    template<typename T, typename Handler>
+      auto complete
+        ( Handler& handler
+        , std::exception_ptr rpc_error
+        , Buffer buffer
+        ) -> void
+    {
+      // \note the handler is called outside of the try-blocks: An
+      // exception thrown by the handler must not lead to a second
+      // call of the handler.
+      //
+      std::visit
+        ( util::overloaded
+          ( [&] (std::exception_ptr error) noexcept
+              (std::is_nothrow_invocable_v<Handler&, std::exception_ptr>)
+            {
+              handler (error);
+            }
+          , [&] (Result<T> result) noexcept
+              ( std::conditional_t
+                  < std::is_same_v<T, void>
+                  , std::is_nothrow_invocable<Handler&>
+                  , std::is_nothrow_invocable<Handler&, T>
+                  >::value
               )
-            , buffer.template load<ResultOrError<T>>()
-            );
+            {
+              if constexpr (std::is_same_v<T, void>)
+              {
+                handler();
+              }
+              else
+              {
+                handler (std::move (result.value));
+              }
+            }
+          )
+        , result_or_exception<T> (rpc_error, std::move (buffer))
+        );
+    }
+
+    template<typename Handler>
+      auto relocate (void* from, void* to) noexcept -> void
+    {
+      auto& stored {*static_cast<Stored<Handler>*> (from)};
+
+      ::new (to) Stored<Handler> (std::move (stored));
+
+      std::destroy_at (std::addressof (stored));
+    }
+
+    template<typename Handler>
+      auto destroy (void* stored) noexcept -> void
+    {
+      std::destroy_at (static_cast<Stored<Handler>*> (stored));
+    }
+
+    template<typename T, typename Handler>
+      constexpr auto operations
+        { Operations
+          { [] (void* stored, std::exception_ptr rpc_error, Buffer buffer)
+            {
+              complete<T>
+                (handler<Handler> (stored), rpc_error, std::move (buffer));
+            }
+          , &relocate<Handler>
+          , &destroy<Handler>
           }
-          catch (...)
-          {
-            _promise->set_exception (std::current_exception());
+        };
+
+    template<typename Before>
+      struct Chained
+    {
+      Completion completion;
+      Before before;
+    };
+
+    template<typename Before>
+      constexpr auto chained_operations
+        { Operations
+          { [] (void* stored, std::exception_ptr rpc_error, Buffer buffer)
+            {
+              auto& chained {handler<Chained<Before>> (stored)};
+
+              chained.before();
+
+              if (rpc_error)
+              {
+                chained.completion (rpc_error);
+              }
+              else
+              {
+                chained.completion (std::move (buffer));
+              }
+            }
+          , &relocate<Chained<Before>>
+          , &destroy<Chained<Before>>
           }
-        }
+        };
+
+    template<typename Handler>
+      auto store (void* storage, Handler handler) -> void
+    {
+      if constexpr (is_stored_in_place<Handler>)
+      {
+        ::new (storage) Handler (std::move (handler));
+      }
+      else
+      {
+        ::new (storage) std::unique_ptr<Handler>
+          (std::make_unique<Handler> (std::move (handler)));
       }
     }
+  }
+
+  template<typename T>
+    Completion::Completion (std::promise<T> promise)
+      : Completion
+        { std::in_place_type<T>
+        , completion::SetPromise<T> {std::move (promise)}
+        }
   {}
+
+  template<typename T, typename Handler>
+    Completion::Completion (std::in_place_type_t<T>, Handler handler)
+      : _operations {std::addressof (completion::operations<T, Handler>)}
+  {
+    completion::store (_storage.data(), std::move (handler));
+  }
+
+  template<typename Before>
+    Completion::Completion (Completion inner, Before before)
+      : _operations {std::addressof (completion::chained_operations<Before>)}
+  {
+    completion::store
+      ( _storage.data()
+      , completion::Chained<Before>
+          {std::move (inner), std::move (before)}
+      );
+  }
 }
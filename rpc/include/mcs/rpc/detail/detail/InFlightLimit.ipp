@@ -0,0 +1,51 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <asio/async_result.hpp>
+#include <asio/post.hpp>
+#include <utility>
+
+namespace mcs::rpc::detail
+{
+  template<typename Handler>
+    struct InFlightLimit::WaiterFor final : public InFlightLimit::Waiter
+  {
+    explicit WaiterFor (Handler handler)
+      : _handler {std::move (handler)}
+    {}
+
+    auto resume() -> void override
+    {
+      asio::post (std::move (_handler));
+    }
+
+  private:
+    Handler _handler;
+  };
+
+  template<typename CompletionToken>
+    auto InFlightLimit::async_acquire (CompletionToken&& token)
+  {
+    return asio::async_initiate<CompletionToken, void()>
+      ( [this] (auto handler)
+        {
+          auto lock {std::unique_lock {_guard}};
+
+          if (acquire_locked())
+          {
+            lock.unlock();
+
+            asio::post (std::move (handler));
+          }
+          else
+          {
+            _waiters.emplace_back
+              ( std::make_unique<WaiterFor<decltype (handler)>>
+                  (std::move (handler))
+              );
+          }
+        }
+      , token
+      );
+  }
+}
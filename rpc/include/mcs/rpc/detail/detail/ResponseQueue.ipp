@@ -0,0 +1,168 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <algorithm>
+#include <asio/bind_executor.hpp>
+#include <asio/write.hpp>
+#include <chrono>
+#include <cstddef>
+#include <iterator>
+#include <mcs/util/cast.hpp>
+#include <utility>
+
+namespace mcs::rpc::detail
+{
+  template<typename Socket, typename Executor>
+    ResponseQueue<Socket, Executor>::Response::Response
+      ( ResultHolder result_holder_
+      )
+        : result_holder {std::move (result_holder_)}
+        , archive {result_holder.archive()}
+  {
+    if (result_holder.statistics)
+    {
+      result_holder.statistics->sent
+        (result_holder.command, archive.sum_size_buffers());
+    }
+  }
+
+  template<typename Socket, typename Executor>
+    ResponseQueue<Socket, Executor>::ResponseQueue
+      ( std::shared_ptr<Socket> socket
+      , asio::strand<Executor> strand
+      , ResponseBatching batching
+      )
+        : _socket {std::move (socket)}
+        , _strand {strand}
+        , _batching {batching}
+        , _timer {strand}
+  {}
+
+  template<typename Socket, typename Executor>
+    auto ResponseQueue<Socket, Executor>::failed() const noexcept -> bool
+  {
+    return _failed.load();
+  }
+
+  template<typename Socket, typename Executor>
+    auto ResponseQueue<Socket, Executor>::push
+      ( ResultHolder result_holder
+      ) -> void
+  try
+  {
+    if (failed())
+    {
+      return;
+    }
+
+    _responses.emplace_back
+      (std::make_unique<Response> (std::move (result_holder)));
+
+    if (!std::exchange (_writing, true))
+    {
+      start_write();
+    }
+    else if (_responses.size() == _batching.max_responses())
+    {
+      // stop waiting for more responses
+      _timer.cancel();
+    }
+  }
+  catch (...)
+  {
+    fail();
+  }
+
+  template<typename Socket, typename Executor>
+    auto ResponseQueue<Socket, Executor>::start_write() -> void
+  {
+    if (  _responses.size() < _batching.max_responses()
+       && _batching.max_latency() > std::chrono::microseconds {0}
+       )
+    {
+      _timer.expires_after (_batching.max_latency());
+      _timer.async_wait
+        ( asio::bind_executor
+          ( _strand
+          , [queue = this->shared_from_this()] (auto const&)
+            {
+              // expired or cancelled because the batch is full
+              queue->write_batch();
+            }
+          )
+        );
+    }
+    else
+    {
+      write_batch();
+    }
+  }
+
+  template<typename Socket, typename Executor>
+    auto ResponseQueue<Socket, Executor>::write_batch() -> void
+  {
+    auto const batch
+      {std::min (_responses.size(), _batching.max_responses())};
+
+    std::for_each
+      ( std::begin (_responses)
+      , std::next (std::begin (_responses), util::cast<std::ptrdiff_t> (batch))
+      , [&] (auto const& response)
+        {
+          for (auto const& buffer : response->archive.buffers())
+          {
+            _buffers.emplace_back (buffer.data(), buffer.size());
+          }
+        }
+      );
+
+    asio::async_write
+      ( *_socket
+      , _buffers
+      , asio::bind_executor
+        ( _strand
+        , [queue = this->shared_from_this(), batch]
+            (auto const& error, std::size_t)
+          {
+            if (error)
+            {
+              // \note the write might fail in case that the client
+              // has been destroyed
+              queue->fail();
+            }
+            else
+            {
+              queue->written (batch);
+            }
+          }
+        )
+      );
+  }
+
+  template<typename Socket, typename Executor>
+    auto ResponseQueue<Socket, Executor>::written (std::size_t batch) -> void
+  {
+    _buffers.clear();
+    _responses.erase
+      ( std::begin (_responses)
+      , std::next (std::begin (_responses), util::cast<std::ptrdiff_t> (batch))
+      );
+
+    if (_responses.empty())
+    {
+      _writing = false;
+    }
+    else
+    {
+      start_write();
+    }
+  }
+
+  template<typename Socket, typename Executor>
+    auto ResponseQueue<Socket, Executor>::fail() -> void
+  {
+    _failed = true;
+    _responses.clear();
+    _buffers.clear();
+  }
+}
@@ -0,0 +1,58 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <asio/buffer.hpp>
+#include <asio/write.hpp>
+#include <utility>
+
+namespace mcs::rpc::detail
+{
+  template<typename Socket, typename OnError>
+    requires (std::is_invocable_v<OnError, std::exception_ptr>)
+    auto SendQueue::send (Socket& socket, OnError&& on_error) -> void
+  {
+    if (!start_sending_or_wait())
+    {
+      return;
+    }
+
+    try
+    {
+      auto buffers {std::vector<asio::const_buffer>{}};
+
+      for (auto calls {take()}; !calls.empty(); calls = take())
+      {
+        for (auto const& call : calls)
+        {
+          for (auto const& buffer : call->buffers())
+          {
+            buffers.emplace_back (buffer.data(), buffer.size());
+          }
+
+          if (call->is_streaming())
+          {
+            asio::write (socket, buffers);
+            buffers.clear();
+
+            call->stream();
+          }
+        }
+
+        asio::write (socket, buffers);
+        buffers.clear();
+
+        // released before their callers are released
+        auto const number_of_calls {calls.size()};
+        calls.clear();
+
+        written (number_of_calls);
+      }
+    }
+    catch (...)
+    {
+      stop_sending();
+
+      std::forward<OnError> (on_error) (std::current_exception());
+    }
+  }
+}
@@ -0,0 +1,15 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <typeinfo>
+
+namespace mcs::rpc::detail
+{
+  template<typename Command>
+    auto command_name() -> std::string const&
+  {
+    static auto const name {demangle (typeid (Command).name())};
+
+    return name;
+  }
+}
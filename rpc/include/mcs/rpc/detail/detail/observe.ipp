@@ -33,6 +33,8 @@ namespace mcs::rpc::detail
          ( state.access_policy
          , std::forward<ObserverArgs> (observer_args)...
          )
+     , state.send_queue
+     , state.buffer_pool
      };
   }
 }
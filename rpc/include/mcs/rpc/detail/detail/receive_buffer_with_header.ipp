@@ -12,7 +12,10 @@
 namespace mcs::rpc::detail
 {
   template<typename Header, typename Socket>
-    auto receive_buffer_with_header (Socket& socket)
+    auto receive_buffer_with_header
+      ( Socket& socket
+      , BufferPool& buffer_pool
+      )
       -> asio::awaitable<std::tuple<Header, Buffer>>
   {
     struct SizeAndHeader
@@ -30,7 +33,7 @@ namespace mcs::rpc::detail
     {
       throw std::logic_error {"receive: Not enough data."};
     }
-    auto buffer {detail::Buffer {prolog.size - sizeof (Header)}};
+    auto buffer {buffer_pool.acquire (prolog.size - sizeof (Header))};
     co_await asio::async_read
       (socket, buffer.modifiable(), asio::use_awaitable);
     co_return std::make_tuple
@@ -40,10 +43,12 @@ namespace mcs::rpc::detail
   template<typename Protocol, typename Header, typename ReadLock>
     auto receive_buffer_with_header
       ( std::shared_ptr<typename Protocol::socket> socket
+      , std::shared_ptr<BufferPool> buffer_pool
       , ReadLock
       ) -> asio::awaitable<std::tuple<Header, Buffer>>
   {
-    auto response {co_await receive_buffer_with_header<Header> (*socket)};
+    auto response
+      {co_await receive_buffer_with_header<Header> (*socket, *buffer_pool)};
 
     co_return response;
   }
@@ -51,9 +56,11 @@ namespace mcs::rpc::detail
   template<typename Protocol, typename Header>
     auto receive_buffer_with_header
       ( std::shared_ptr<typename Protocol::socket> socket
+      , std::shared_ptr<BufferPool> buffer_pool
       ) -> asio::awaitable<std::tuple<Header, Buffer>>
   {
-    auto response {co_await receive_buffer_with_header<Header> (*socket)};
+    auto response
+      {co_await receive_buffer_with_header<Header> (*socket, *buffer_pool)};
 
     co_return response;
   }
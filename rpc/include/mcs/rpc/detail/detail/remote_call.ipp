@@ -9,13 +9,71 @@
 #include <mcs/rpc/detail/CallID.hpp>
 #include <mcs/rpc/detail/CommandIndex.hpp>
 #include <mcs/rpc/detail/Completion.hpp>
+#include <mcs/rpc/detail/SendQueue.hpp>
+#include <mcs/rpc/detail/command_name.hpp>
 #include <mcs/rpc/detail/receive_buffer_with_header.hpp>
 #include <mcs/serialization/OArchive.hpp>
+#include <mcs/util/trace/Context.hpp>
+#include <mcs/util/trace/Span.hpp>
+#include <memory>
 #include <tuple>
 #include <utility>
 
 namespace mcs::rpc::detail
 {
+  // The header and the archive of a call in the send queue.
+  //
+  // \note the command might be held by reference and the archive
+  // refers to its data, e.g. the payload of a put: remote_call does
+  // not return before the call has been written, see SendQueue.
+  //
+  template<typename Socket, typename Command, typename CommandHolder>
+    struct QueuedCall final : public SendQueue::Call
+  {
+    QueuedCall
+      ( std::shared_ptr<Socket> socket
+      , CallID call_id
+      , CommandIndex index
+      , util::trace::Context trace
+      , CommandHolder command
+      )
+        : _socket {std::move (socket)}
+        , _call_id {call_id}
+        , _index {index}
+        , _trace {trace}
+        , _command {std::move (command)}
+    {}
+
+    [[nodiscard]] auto buffers
+      (
+      ) const noexcept -> serialization::OArchive::Buffers const& override
+    {
+      return _archive.buffers();
+    }
+
+    [[nodiscard]] auto is_streaming() const noexcept -> bool override
+    {
+      return command_is_streaming<Command, Socket>;
+    }
+
+    auto stream() -> void override
+    {
+      if constexpr (command_is_streaming<Command, Socket>)
+      {
+        _command.ref().stream (*_socket);
+      }
+    }
+
+  private:
+    std::shared_ptr<Socket> _socket;
+    CallID const _call_id;
+    CommandIndex const _index;
+    util::trace::Context const _trace;
+    CommandHolder _command;
+    serialization::OArchive _archive
+      {_call_id, _index, _trace, _command.ref()};
+  };
+
   template< is_protocol Protocol
           , is_access_policy AccessPolicy
           , is_command Command
@@ -30,29 +88,98 @@ namespace mcs::rpc::detail
   {
     auto promise {std::promise<typename Command::Response>{}};
     auto future {promise.get_future()};
-    auto const call_id
-      {client.access_policy->start_call (Completion {std::move (promise)})};
-    auto constexpr index {command_index<Command, Commands...>()};
 
-    auto oa {serialization::OArchive { call_id
-                                     , index
-                                     , command.ref()
-                                     }
-            };
+    remote_call<Protocol, AccessPolicy, Command>
+      ( client
+      , std::move (command)
+      , Completion {std::move (promise)}
+      );
+
+    return future;
+  }
 
-    asio::write (*client.socket, oa.buffers());
+  template< is_protocol Protocol
+          , is_access_policy AccessPolicy
+          , is_command Command
+          , is_command... Commands
+          , typename CommandHolder
+          >
+    requires (is_one_of_the_commands<Command, Commands...>)
+    auto remote_call
+      ( ClientState<Protocol, AccessPolicy, Commands...> client
+      , CommandHolder command
+      , Completion completion
+      ) -> void
+  {
+    // The span ends when the response has been received. The
+    // provider records its span as a child of the span of the call.
+    //
+    auto span
+      { util::trace::Span::start
+          ( command_name<Command>()
+          , "rpc.client"
+          , util::trace::Kind::Client
+          , util::trace::current()
+          )
+      };
+    auto const trace {span ? span->context() : util::trace::current()};
 
-    if constexpr (command_is_streaming<Command, typename Protocol::socket>)
+    if (span)
     {
-      command.ref().stream (*client.socket);
+      completion = Completion
+        { std::move (completion)
+        , [span = std::move (span)]() mutable
+          {
+            span->end();
+          }
+        };
     }
 
+    auto const call_id
+      {client.access_policy->start_call (std::move (completion))};
+    auto constexpr index {command_index<Command, Commands...>()};
+
     if constexpr (needs_sent_notification<AccessPolicy>)
     {
+      // Queued while the send lock is held: The queue is in call_id
+      // order. Whoever finds the queue idle writes all queued calls,
+      // including the calls of other threads, the others wait until
+      // their call has been written.
+      //
+      client.send_queue->push
+        ( std::make_unique
+            < QueuedCall<typename Protocol::socket, Command, CommandHolder>
+            > (client.socket, call_id, index, trace, std::move (command))
+        );
+
       client.access_policy->sent();
+
+      client.send_queue->send
+        ( *client.socket
+        , [&] (std::exception_ptr send_error) noexcept
+          {
+            client.access_policy->error (send_error);
+          }
+        );
+    }
+    else
+    {
+      auto oa {serialization::OArchive { call_id
+                                       , index
+                                       , trace
+                                       , command.ref()
+                                       }
+              };
+
+      asio::write (*client.socket, oa.buffers());
+
+      if constexpr (command_is_streaming<Command, typename Protocol::socket>)
+      {
+        command.ref().stream (*client.socket);
+      }
     }
 
-    auto completion
+    auto receive_completion
       { [access_policy = client.access_policy]
           ( std::exception_ptr rpc_error
           , std::tuple<CallID, Buffer> response
@@ -77,19 +204,21 @@ namespace mcs::rpc::detail
       asio::co_spawn
         ( client.socket->get_executor()
         , receive_buffer_with_header<Protocol, CallID>
-            (client.socket, client.access_policy->read_lock())
-        , completion
+            ( client.socket
+            , client.buffer_pool
+            , client.access_policy->read_lock()
+            )
+        , receive_completion
         );
     }
     else
     {
       asio::co_spawn
         ( client.socket->get_executor()
-        , receive_buffer_with_header<Protocol, CallID> (client.socket)
-        , completion
+        , receive_buffer_with_header<Protocol, CallID>
+            (client.socket, client.buffer_pool)
+        , receive_completion
         );
     }
-
-    return future;
   }
 }
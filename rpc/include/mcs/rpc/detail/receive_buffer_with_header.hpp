@@ -5,12 +5,16 @@
 
 #include <asio/awaitable.hpp>
 #include <mcs/rpc/detail/Buffer.hpp>
+#include <mcs/rpc/detail/BufferPool.hpp>
 #include <tuple>
 
 namespace mcs::rpc::detail
 {
+  // The buffer is taken from the pool and returns into the pool when
+  // it is destroyed.
+  //
   template<typename Header, typename Socket>
-    auto receive_buffer_with_header (Socket&)
+    auto receive_buffer_with_header (Socket&, BufferPool&)
       -> asio::awaitable<std::tuple<Header, Buffer>>
     ;
 }
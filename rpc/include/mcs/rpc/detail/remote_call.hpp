@@ -6,6 +6,7 @@
 #include <future>
 #include <mcs/rpc/Concepts.hpp>
 #include <mcs/rpc/detail/ClientState.hpp>
+#include <mcs/rpc/detail/Completion.hpp>
 
 namespace mcs::rpc::detail
 {
@@ -18,10 +19,26 @@ namespace mcs::rpc::detail
     requires (is_one_of_the_commands<Command, Commands...>)
     auto remote_call
       ( ClientState<Protocol, AccessPolicy, Commands...>
-      , std::shared_ptr<AccessPolicy>
       , CommandHolder
       ) -> std::future<typename Command::Response>
     ;
+
+  // Sends the command and calls the completion once the response
+  // has been received. Does not involve any future.
+  //
+  template< is_protocol Protocol
+          , is_access_policy AccessPolicy
+          , is_command Command
+          , is_command... Commands
+          , typename CommandHolder
+          >
+    requires (is_one_of_the_commands<Command, Commands...>)
+    auto remote_call
+      ( ClientState<Protocol, AccessPolicy, Commands...>
+      , CommandHolder
+      , Completion
+      ) -> void
+    ;
 }
 
 #include "detail/remote_call.ipp"
@@ -34,11 +34,51 @@ namespace mcs::rpc::multi_client
 
       unsigned int value {1u};
     };
+
+    // Starts with at most `initial` parallel calls and adapts the
+    // limit to the latencies of the calls: The limit grows while the
+    // latencies stay close to the smallest latency and shrinks when
+    // they grow, it never exceeds `maximum`. See
+    // detail::AdaptiveLimit.
+    //
+    struct Adaptive
+    {
+      constexpr explicit Adaptive (unsigned int initial, unsigned int maximum);
+
+      struct Error
+      {
+        struct MustBePositive : public mcs::Error
+        {
+        public:
+          MCS_ERROR_COPY_MOVE_DEFAULT (MustBePositive);
+
+        private:
+          friend ParallelCalls;
+
+          MustBePositive() noexcept;
+        };
+
+        struct InitialExceedsMaximum : public mcs::Error
+        {
+        public:
+          MCS_ERROR_COPY_MOVE_DEFAULT (InitialExceedsMaximum);
+
+        private:
+          friend ParallelCalls;
+
+          InitialExceedsMaximum() noexcept;
+        };
+      };
+
+      unsigned int initial {1u};
+      unsigned int maximum {1u};
+    };
   };
 
   using ParallelCallsLimit = std::variant
     < ParallelCalls::Unlimited
     , ParallelCalls::AtMost
+    , ParallelCalls::Adaptive
     >;
 }
 
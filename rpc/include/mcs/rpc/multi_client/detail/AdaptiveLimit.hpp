@@ -0,0 +1,59 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mcs/rpc/multi_client/ParallelCallsLimit.hpp>
+#include <mcs/rpc/multi_client/detail/CallID.hpp>
+#include <optional>
+#include <unordered_map>
+
+namespace mcs::rpc::multi_client::detail
+{
+  // The limit of a single wave for ParallelCalls::Adaptive: Additive
+  // increase, multiplicative decrease, driven by the latencies of the
+  // calls.
+  //
+  // A call whose latency is at most Tolerance times the smallest
+  // latency seen so far increases the limit by 1/limit, that is by
+  // one per "round" of calls. A call whose latency is larger halves
+  // the limit, at most once per round: Calls that have been started
+  // before the last decrease do not decrease the limit again. The
+  // limit stays within [1, maximum].
+  //
+  // Calls that complete with an error are treated as calls that
+  // complete with a result, only their latency counts.
+  //
+  struct AdaptiveLimit
+  {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr auto Tolerance {2};
+
+    explicit AdaptiveLimit (ParallelCalls::Adaptive) noexcept;
+
+    [[nodiscard]] auto value() const noexcept -> unsigned int;
+
+    auto call_started (CallID, Clock::time_point) -> void;
+    auto call_completed (CallID, Clock::time_point) -> void;
+
+  private:
+    unsigned int _maximum;
+    double _limit;
+    std::optional<Clock::duration> _minimum_latency;
+
+    using Sequence = std::uintmax_t;
+    Sequence _calls_started {0u};
+    Sequence _first_call_after_decrease {0u};
+
+    struct Start
+    {
+      Clock::time_point time;
+      Sequence sequence;
+    };
+    std::unordered_map<CallID, Start> _starts;
+  };
+}
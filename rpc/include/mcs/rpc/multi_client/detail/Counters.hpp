@@ -5,8 +5,10 @@
 
 #include <condition_variable>
 #include <mcs/rpc/multi_client/ParallelCallsLimit.hpp>
+#include <mcs/rpc/multi_client/detail/AdaptiveLimit.hpp>
 #include <mcs/rpc/multi_client/detail/CallID.hpp>
 #include <mutex>
+#include <optional>
 #include <unordered_set>
 
 namespace mcs::rpc::multi_client::detail
@@ -38,6 +40,7 @@ namespace mcs::rpc::multi_client::detail
     std::mutex _guard;
     std::condition_variable _completed;
     multi_client::ParallelCallsLimit _parallel_calls_limit;
+    std::optional<AdaptiveLimit> _adaptive_limit;
     unsigned int _call_started {0u};
     unsigned int _call_completed {0u};
     unsigned int _error_execution {0u};
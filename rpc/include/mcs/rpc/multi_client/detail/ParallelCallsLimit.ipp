@@ -1,10 +1,16 @@
 // Copyright (C) 2023-2025 Fraunhofer ITWM
 // License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
 
+#include <fmt/ranges.h>
 #include <mcs/util/FMT/define.hpp>
 #include <mcs/util/overloaded.hpp>
+#include <mcs/util/read/STD/tuple.hpp>
 #include <mcs/util/read/declare.hpp>
+#include <mcs/util/read/define.hpp>
+#include <mcs/util/read/parse.hpp>
+#include <mcs/util/read/prefix.hpp>
 #include <mcs/util/read/uint.hpp>
+#include <tuple>
 
 namespace mcs::rpc::multi_client
 {
@@ -16,6 +22,24 @@ namespace mcs::rpc::multi_client
       throw Error::MustBePositive{};
     }
   }
+
+  constexpr ParallelCalls::Adaptive::Adaptive
+    ( unsigned int _initial
+    , unsigned int _maximum
+    )
+      : initial {_initial}
+      , maximum {_maximum}
+  {
+    if (initial == 0)
+    {
+      throw Error::MustBePositive{};
+    }
+
+    if (initial > maximum)
+    {
+      throw Error::InitialExceedsMaximum{};
+    }
+  }
 }
 
 namespace fmt
@@ -41,6 +65,14 @@ namespace fmt
               , std::make_tuple (at_most.value)
               );
           }
+        , [&] (mcs::rpc::multi_client::ParallelCalls::Adaptive adaptive)
+          {
+            return fmt::format_to
+              ( ctx.out()
+              , "ParallelCalls::Adaptive {}"
+              , std::make_tuple (adaptive.initial, adaptive.maximum)
+              );
+          }
         )
       , parallel_calls_limit
       );
@@ -66,6 +98,15 @@ namespace mcs::util::read
       return rpc::multi_client::ParallelCalls::AtMost {value};
     }
 
-    throw state.error ("Expected: 'Unlimited' | 'AtMost (UINT)'");
+    if (maybe_prefix (state, "Adaptive"))
+    {
+      auto [initial, maximum]
+        {parse<std::tuple<unsigned int, unsigned int>> (state)};
+
+      return rpc::multi_client::ParallelCalls::Adaptive {initial, maximum};
+    }
+
+    throw state.error
+      ("Expected: 'Unlimited' | 'AtMost (UINT)' | 'Adaptive (UINT, UINT)'");
   }
 }
@@ -27,6 +27,10 @@ namespace mcs::rpc::multi_client::detail
           {
             return _call_started < finished (lock) + max.value;
           }
+        , [&] (multi_client::ParallelCalls::Adaptive) noexcept
+          {
+            return _call_started < finished (lock) + _adaptive_limit->value();
+          }
         )
       , _parallel_calls_limit
       );
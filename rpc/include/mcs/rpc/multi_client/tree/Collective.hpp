@@ -0,0 +1,70 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <cstddef>
+#include <mcs/Error.hpp>
+#include <mcs/rpc/Concepts.hpp>
+#include <mcs/serialization/STD/vector.hpp>
+#include <mcs/serialization/declare.hpp>
+#include <mcs/util/ASIO/Connectable.hpp>
+#include <vector>
+
+namespace mcs::rpc::multi_client::tree
+{
+  // The maximum number of children of a node in the tree.
+  //
+  struct Arity
+  {
+    // \note throws if value is zero
+    //
+    constexpr explicit Arity (std::size_t);
+    std::size_t value;
+
+    struct Error
+    {
+      struct MustBePositive : public mcs::Error
+      {
+      public:
+        MCS_ERROR_COPY_MOVE_DEFAULT (MustBePositive);
+
+      private:
+        friend Arity;
+
+        MustBePositive() noexcept;
+      };
+    };
+  };
+
+  // The command that travels down a tree of providers: The receiver
+  // executes the command itself, forwards it to its children, each
+  // with its share of the subtree, and replies with the reduction of
+  // its own response and the responses of its children, see Node.
+  //
+  // The providers of the subtree are split into arity many contiguous
+  // parts of about the same size, the first provider of each part is
+  // a child and the rest of the part is the subtree of that child.
+  //
+  template<is_command Command>
+    struct Collective
+  {
+    using Response = typename Command::Response;
+
+    static constexpr auto is_blocking {true};
+
+    Command command;
+    std::vector<util::ASIO::AnyConnectable> subtree;
+    std::size_t arity;
+  };
+}
+
+namespace mcs::serialization
+{
+  template<rpc::is_command Command>
+    MCS_SERIALIZATION_DECLARE_NONINTRUSIVE_IMPLEMENTATION
+      (rpc::multi_client::tree::Collective<Command>)
+    ;
+}
+
+#include "detail/Collective.ipp"
@@ -0,0 +1,55 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <asio/io_context.hpp>
+#include <asio/ip/tcp.hpp>
+#include <asio/local/stream_protocol.hpp>
+#include <mcs/rpc/Client.hpp>
+#include <mcs/rpc/Concepts.hpp>
+#include <mcs/rpc/access_policy/Concurrent.hpp>
+#include <mcs/util/ASIO/Connectable.hpp>
+#include <mutex>
+#include <unordered_map>
+#include <variant>
+
+namespace mcs::rpc::multi_client::tree
+{
+  // The clients of a node to its children. A client is created when
+  // a child is used for the first time and is shared by all later
+  // collectives that use the same child. The clients use the
+  // given io_context, it must outlive the Connections.
+  //
+  // Thread safe.
+  //
+  template<is_command... Commands>
+    struct Connections
+  {
+    using Client = std::variant
+      < rpc::Client< asio::ip::tcp
+                   , access_policy::Concurrent
+                   , Commands...
+                   >
+      , rpc::Client< asio::local::stream_protocol
+                   , access_policy::Concurrent
+                   , Commands...
+                   >
+      >;
+
+    explicit Connections (asio::io_context&) noexcept;
+
+    // Returns the client connected to the provider, creates it if
+    // required. Prefers the same host endpoint, see
+    // util::ASIO::prefer_same_host.
+    //
+    [[nodiscard]] auto client (util::ASIO::AnyConnectable) -> Client;
+
+  private:
+    asio::io_context& _io_context;
+    std::mutex _guard;
+    std::unordered_map<util::ASIO::AnyConnectable, Client> _clients;
+  };
+}
+
+#include "detail/Connections.ipp"
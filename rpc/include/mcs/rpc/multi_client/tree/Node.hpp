@@ -0,0 +1,111 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <concepts>
+#include <mcs/rpc/Concepts.hpp>
+#include <mcs/rpc/Dispatcher.hpp>
+#include <mcs/rpc/multi_client/tree/Collective.hpp>
+#include <mcs/rpc/multi_client/tree/Connections.hpp>
+#include <mcs/util/not_null.hpp>
+#include <type_traits>
+
+namespace mcs::rpc::multi_client::tree
+{
+  // A reduction combines two responses into one. It is applied in
+  // unspecified order, e.g. std::plus<>.
+  //
+  template<typename Reduction, typename Command>
+    concept is_reduction_for_command
+     = !std::is_void_v<typename Command::Response>
+    && std::default_initializable<Reduction>
+    && std::invocable< Reduction&
+                     , typename Command::Response
+                     , typename Command::Response
+                     >
+    && std::convertible_to
+       < std::invoke_result_t< Reduction&
+                             , typename Command::Response
+                             , typename Command::Response
+                             >
+       , typename Command::Response
+       >
+    ;
+
+  // The handler of a provider that takes part in collectives for
+  // Command: All commands but Collective<Command> are handled by
+  // Handler. A Collective<Command> is forwarded to the children of
+  // the provider, executed by Handler and answered with the reduction
+  // of all responses of the subtree.
+  //
+  // The calls to the children and the local execution overlap. If
+  // any of them fails, then the collective fails with
+  // multi_client::Errors that contains all errors of the subtree,
+  // after all calls have been finished.
+  //
+  // A collective is a blocking command, see command_is_blocking, it
+  // occupies a thread of the BlockingPool of each inner node until
+  // its subtree has answered.
+  //
+  // \note a provider must not appear more than once in a tree
+  //
+  template< typename Handler
+          , typename Reduction
+          , is_command Command
+          , is_command... Commands
+          >
+    requires ( is_reduction_for_command<Reduction, Command>
+            && handler::provides_response<Handler, Command>
+             )
+    struct Node : public Handler
+  {
+    using Connections
+      = tree::Connections<Collective<Command>, Command, Commands...>;
+
+    template<typename... HandlerArgs>
+      requires (std::is_constructible_v<Handler, HandlerArgs...>)
+      explicit Node (util::not_null<Connections>, HandlerArgs&&...);
+
+    using Handler::operator();
+
+    auto operator() (Collective<Command>) -> typename Command::Response;
+
+  private:
+    util::not_null<Connections> _connections;
+  };
+
+  // The dispatcher of a provider that takes part in collectives for
+  // Command. The provider is constructed with a
+  // util::not_null<Connections> followed by the arguments for
+  // Handler.
+  //
+  // EXAMPLE:
+  //
+  //   using Dispatcher = tree::Dispatcher<Handler, std::plus<>, Size>;
+  //   using Connections = Dispatcher::HandlerType::Connections;
+  //
+  //   auto connections {Connections {io_context}};
+  //   auto provider
+  //     { make_provider<Protocol, Dispatcher>
+  //         ( endpoint
+  //         , io_context
+  //         , util::not_null {std::addressof (connections)}
+  //         , handler_args...
+  //         )
+  //     };
+  //
+  template< typename Handler
+          , typename Reduction
+          , is_command Command
+          , is_command... Commands
+          >
+    using Dispatcher = rpc::Dispatcher
+      < Node<Handler, Reduction, Command, Commands...>
+      , Collective<Command>
+      , Command
+      , Commands...
+      >;
+}
+
+#include "detail/Node.ipp"
@@ -0,0 +1,36 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <mcs/rpc/Concepts.hpp>
+#include <mcs/rpc/multi_client/tree/Collective.hpp>
+#include <mcs/util/ASIO/Connectable.hpp>
+#include <vector>
+
+namespace mcs::rpc::multi_client::tree
+{
+  // Executes the command on the root, the provider the client is
+  // connected to, and on all providers of the subtree and returns
+  // the reduction of all responses, see Node. The command travels
+  // down a tree with the given arity, the caller sends one command
+  // and receives one response, the collective completes in about
+  // log_arity (subtree.size()) rounds.
+  //
+  // EXAMPLE:
+  //
+  //   auto const sum_of_sizes
+  //     { tree::call<Size> (client, Size{}, providers, tree::Arity {8})
+  //     };
+  //
+  template<is_command Command, typename Client>
+    [[nodiscard]] auto call
+      ( Client const&
+      , Command
+      , std::vector<util::ASIO::AnyConnectable> subtree
+      , Arity
+      ) -> typename Command::Response
+      ;
+}
+
+#include "detail/call.ipp"
@@ -0,0 +1,49 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <mcs/serialization/define.hpp>
+#include <utility>
+
+namespace mcs::rpc::multi_client::tree
+{
+  constexpr Arity::Arity (std::size_t value_)
+    : value {value_}
+  {
+    if (value == 0)
+    {
+      throw Error::MustBePositive{};
+    }
+  }
+}
+
+namespace mcs::serialization
+{
+  template<rpc::is_command Command>
+    MCS_SERIALIZATION_DEFINE_NONINTRUSIVE_IMPLEMENTATION_INPUT
+      ( ia
+      , rpc::multi_client::tree::Collective<Command>
+      )
+  {
+    using Collective = rpc::multi_client::tree::Collective<Command>;
+
+    MCS_SERIALIZATION_LOAD_FIELD (ia, command, Collective);
+    MCS_SERIALIZATION_LOAD_FIELD (ia, subtree, Collective);
+    MCS_SERIALIZATION_LOAD_FIELD (ia, arity, Collective);
+
+    return Collective {std::move (command), std::move (subtree), arity};
+  }
+
+  template<rpc::is_command Command>
+    MCS_SERIALIZATION_DEFINE_NONINTRUSIVE_IMPLEMENTATION_OUTPUT
+      ( oa
+      , collective
+      , rpc::multi_client::tree::Collective<Command>
+      )
+  {
+    MCS_SERIALIZATION_SAVE_FIELD (oa, collective, command);
+    MCS_SERIALIZATION_SAVE_FIELD (oa, collective, subtree);
+    MCS_SERIALIZATION_SAVE_FIELD (oa, collective, arity);
+
+    return oa;
+  }
+}
@@ -0,0 +1,54 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace mcs::rpc::multi_client::tree
+{
+  template<is_command... Commands>
+    Connections<Commands...>::Connections
+      ( asio::io_context& io_context
+      ) noexcept
+        : _io_context {io_context}
+  {}
+
+  template<is_command... Commands>
+    auto Connections<Commands...>::client
+      ( util::ASIO::AnyConnectable provider
+      ) -> Client
+  {
+    auto const lock {std::lock_guard {_guard}};
+
+    if ( auto known {_clients.find (provider)}
+       ; known != std::end (_clients)
+       )
+    {
+      return known->second;
+    }
+
+    auto client
+      { std::visit
+        ( [&]<is_protocol Protocol>
+            ( util::ASIO::Connectable<Protocol> const& connectable
+            ) -> Client
+          {
+            return rpc::Client< Protocol
+                              , access_policy::Concurrent
+                              , Commands...
+                              >
+              { _io_context
+              , connectable
+              , std::make_shared<access_policy::Concurrent>()
+              };
+          }
+        , util::ASIO::prefer_same_host (provider)
+        )
+      };
+
+    return _clients.emplace (std::move (provider), std::move (client))
+      .first->second
+      ;
+  }
+}
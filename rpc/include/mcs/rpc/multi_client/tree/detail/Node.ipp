@@ -0,0 +1,124 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <exception>
+#include <future>
+#include <list>
+#include <mcs/rpc/multi_client/Errors.hpp>
+#include <mcs/rpc/multi_client/tree/detail/split.hpp>
+#include <optional>
+#include <utility>
+#include <variant>
+
+namespace mcs::rpc::multi_client::tree
+{
+  template< typename Handler
+          , typename Reduction
+          , is_command Command
+          , is_command... Commands
+          >
+    requires ( is_reduction_for_command<Reduction, Command>
+            && handler::provides_response<Handler, Command>
+             )
+    template<typename... HandlerArgs>
+      requires (std::is_constructible_v<Handler, HandlerArgs...>)
+      Node<Handler, Reduction, Command, Commands...>::Node
+        ( util::not_null<Connections> connections
+        , HandlerArgs&&... handler_args
+        )
+          : Handler {std::forward<HandlerArgs> (handler_args)...}
+          , _connections {connections}
+  {}
+
+  template< typename Handler
+          , typename Reduction
+          , is_command Command
+          , is_command... Commands
+          >
+    requires ( is_reduction_for_command<Reduction, Command>
+            && handler::provides_response<Handler, Command>
+             )
+    auto Node<Handler, Reduction, Command, Commands...>::operator()
+      ( Collective<Command> collective
+      ) -> typename Command::Response
+  {
+    using Response = typename Command::Response;
+
+    auto errors {std::list<std::exception_ptr>{}};
+    auto responses {std::list<std::future<Response>>{}};
+
+    // start the children first to overlap their work with the local
+    // execution
+    for ( auto& child
+        : detail::split (std::move (collective.subtree), collective.arity)
+        )
+    {
+      try
+      {
+        responses.emplace_back
+          ( std::visit
+            ( [&] (auto const& client)
+              {
+                return client.get_future
+                  ( Collective<Command>
+                    { collective.command
+                    , std::move (child.subtree)
+                    , collective.arity
+                    }
+                  );
+              }
+            , _connections->client (std::move (child.provider))
+            )
+          );
+      }
+      catch (...)
+      {
+        errors.emplace_back (std::current_exception());
+      }
+    }
+
+    auto response {std::optional<Response>{}};
+    auto reduction {Reduction{}};
+    auto const reduce
+      { [&] (Response other)
+        {
+          if (!response)
+          {
+            response.emplace (std::move (other));
+          }
+          else
+          {
+            *response = reduction (std::move (*response), std::move (other));
+          }
+        }
+      };
+
+    try
+    {
+      reduce (static_cast<Handler&> (*this) (collective.command));
+    }
+    catch (...)
+    {
+      errors.emplace_back (std::current_exception());
+    }
+
+    for (auto& child_response : responses)
+    {
+      try
+      {
+        reduce (child_response.get());
+      }
+      catch (...)
+      {
+        errors.emplace_back (std::current_exception());
+      }
+    }
+
+    if (!errors.empty())
+    {
+      throw Errors {std::move (errors)};
+    }
+
+    return std::move (*response);
+  }
+}
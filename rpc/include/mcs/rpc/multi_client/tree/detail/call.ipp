@@ -0,0 +1,24 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <utility>
+
+namespace mcs::rpc::multi_client::tree
+{
+  template<is_command Command, typename Client>
+    auto call
+      ( Client const& root
+      , Command command
+      , std::vector<util::ASIO::AnyConnectable> subtree
+      , Arity arity
+      ) -> typename Command::Response
+  {
+    return root
+      ( Collective<Command>
+        { std::move (command)
+        , std::move (subtree)
+        , arity.value
+        }
+      );
+  }
+}
@@ -0,0 +1,29 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <cstddef>
+#include <mcs/util/ASIO/Connectable.hpp>
+#include <vector>
+
+namespace mcs::rpc::multi_client::tree::detail
+{
+  struct Child
+  {
+    util::ASIO::AnyConnectable provider;
+    std::vector<util::ASIO::AnyConnectable> subtree;
+  };
+
+  // Splits the subtree into min (arity, subtree.size()) contiguous
+  // parts whose sizes differ by at most one. The first provider of
+  // each part is a child, the rest of the part is its subtree.
+  //
+  // \note throws Arity::Error::MustBePositive if arity is zero
+  //
+  [[nodiscard]] auto split
+    ( std::vector<util::ASIO::AnyConnectable> subtree
+    , std::size_t arity
+    ) -> std::vector<Child>
+    ;
+}
@@ -0,0 +1,27 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+namespace mcs::rpc::multi_connection
+{
+  // A distribution selects the connection for the next call, given
+  // the number of outstanding calls per connection. It is called
+  // concurrently by all threads that use the client and must return
+  // an index into the outstanding calls.
+  //
+  template<typename Distribution>
+    concept is_distribution =
+    requires ( Distribution& distribution
+             , std::span<std::atomic<std::size_t> const> outstanding_calls
+             )
+    {
+      { distribution.select (outstanding_calls)
+      } -> std::convertible_to<std::size_t>;
+    };
+}
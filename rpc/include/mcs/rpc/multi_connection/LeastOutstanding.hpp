@@ -0,0 +1,33 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mcs/rpc/multi_connection/Concepts.hpp>
+#include <span>
+
+namespace mcs::rpc::multi_connection
+{
+  // Selects a connection with the least number of outstanding calls,
+  // ties are broken round robin. Good for calls of different cost,
+  // slow calls do not delay the calls that are queued behind them.
+  //
+  // Costs: O(number of connections) per call.
+  //
+  // \note the numbers are a snapshot, concurrent selections might
+  // select the same connection
+  //
+  struct LeastOutstanding
+  {
+    [[nodiscard]] auto select
+      ( std::span<std::atomic<std::size_t> const>
+      ) noexcept -> std::size_t;
+
+  private:
+    std::atomic<std::size_t> _start {0};
+  };
+
+  static_assert (is_distribution<LeastOutstanding>);
+}
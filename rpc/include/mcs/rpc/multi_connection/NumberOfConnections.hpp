@@ -0,0 +1,34 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <cstddef>
+#include <mcs/Error.hpp>
+
+namespace mcs::rpc::multi_connection
+{
+  struct NumberOfConnections
+  {
+    // \note throws if value is zero
+    //
+    constexpr explicit NumberOfConnections (std::size_t);
+    std::size_t value;
+
+    struct Error
+    {
+      struct MustBePositive : public mcs::Error
+      {
+      public:
+        MCS_ERROR_COPY_MOVE_DEFAULT (MustBePositive);
+
+      private:
+        friend NumberOfConnections;
+
+        MustBePositive() noexcept;
+      };
+    };
+  };
+}
+
+#include "detail/NumberOfConnections.ipp"
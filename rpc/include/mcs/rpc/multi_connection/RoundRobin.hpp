@@ -0,0 +1,27 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mcs/rpc/multi_connection/Concepts.hpp>
+#include <span>
+
+namespace mcs::rpc::multi_connection
+{
+  // Selects the connections one after the other, regardless of the
+  // outstanding calls. Cheapest, good for calls of similar cost.
+  //
+  struct RoundRobin
+  {
+    [[nodiscard]] auto select
+      ( std::span<std::atomic<std::size_t> const>
+      ) noexcept -> std::size_t;
+
+  private:
+    std::atomic<std::size_t> _next {0};
+  };
+
+  static_assert (is_distribution<RoundRobin>);
+}
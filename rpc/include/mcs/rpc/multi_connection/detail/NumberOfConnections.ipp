@@ -0,0 +1,16 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+namespace mcs::rpc::multi_connection
+{
+  constexpr NumberOfConnections::NumberOfConnections
+    ( std::size_t value_
+    )
+      : value {value_}
+  {
+    if (value == 0)
+    {
+      throw Error::MustBePositive{};
+    }
+  }
+}
@@ -0,0 +1,57 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <asio/local/stream_protocol.hpp>
+#include <mcs/rpc/Admission.hpp>
+#include <mcs/rpc/BlockingPool.hpp>
+#include <mcs/rpc/PerCoreIOContexts.hpp>
+#include <mcs/rpc/ResponseBatching.hpp>
+#include <optional>
+
+namespace mcs::rpc::provider
+{
+  // Optional settings of a Provider. The defaults are the behavior of
+  // a provider that is constructed without options, e.g.
+  //
+  //   make_provider<Protocol, Dispatcher>
+  //     ( endpoint
+  //     , provider::Options {.admission = Admission {...}}
+  //     , io_context
+  //     , handler_args...
+  //     );
+  //
+  struct Options
+  {
+    // Listens on a local::stream_protocol endpoint in addition, if
+    // set. Clients on the same host can use it instead of the
+    // loopback device, see util::ASIO::prefer_same_host.
+    //
+    // \note the provider throws Provider::Error::SameHostRequiresTCP
+    // if set and its Protocol is not ip::tcp
+    // \note the caller is responsible for the path
+    //
+    std::optional<asio::local::stream_protocol::endpoint> same_host {};
+
+    // Writes the responses of each connection in batches.
+    //
+    ResponseBatching response_batching {};
+
+    // Executes the blocking commands, see command_is_blocking. The
+    // pool is created only if the dispatcher has blocking commands.
+    //
+    BlockingPool blocking_pool {};
+
+    // Limits the number of requests in flight.
+    //
+    Admission admission {};
+
+    // Hands each accepted connection to the next of the io_contexts,
+    // if set, the connection stays there. The acceptors run on the
+    // executor of the provider, e.g. the first of the io_contexts.
+    // The io_contexts must outlive the provider and its connections.
+    //
+    PerCoreIOContexts* per_core_io_contexts {nullptr};
+  };
+}
@@ -0,0 +1,58 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <mcs/rpc/Admission.hpp>
+
+namespace mcs::rpc
+{
+  Admission::Admission
+    ( MaxRequestsPerConnection max_requests_per_connection
+    , MaxRequests max_requests
+    )
+      : _max_requests_per_connection {max_requests_per_connection.value}
+      , _max_requests {max_requests.value}
+  {
+    if (_max_requests_per_connection == 0)
+    {
+      throw Error::MaxRequestsPerConnectionMustBePositive{};
+    }
+
+    if (_max_requests == 0)
+    {
+      throw Error::MaxRequestsMustBePositive{};
+    }
+  }
+
+  auto Admission::max_requests_per_connection
+    (
+    ) const noexcept -> std::size_t
+  {
+    return _max_requests_per_connection;
+  }
+
+  auto Admission::max_requests() const noexcept -> std::size_t
+  {
+    return _max_requests;
+  }
+}
+
+namespace mcs::rpc
+{
+  Admission::Error::MaxRequestsPerConnectionMustBePositive::MaxRequestsPerConnectionMustBePositive
+    (
+    ) noexcept
+      : mcs::Error {"Max requests per connection must be positive."}
+  {}
+  Admission::Error::MaxRequestsPerConnectionMustBePositive::~MaxRequestsPerConnectionMustBePositive
+    (
+    ) = default;
+
+  Admission::Error::MaxRequestsMustBePositive::MaxRequestsMustBePositive
+    (
+    ) noexcept
+      : mcs::Error {"Max requests of the admission must be positive."}
+  {}
+  Admission::Error::MaxRequestsMustBePositive::~MaxRequestsMustBePositive
+    (
+    ) = default;
+}
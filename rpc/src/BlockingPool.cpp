@@ -0,0 +1,33 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <mcs/rpc/BlockingPool.hpp>
+
+namespace mcs::rpc
+{
+  BlockingPool::BlockingPool (NumberOfThreads number_of_threads)
+    : _number_of_threads {number_of_threads.value}
+  {
+    if (_number_of_threads == 0)
+    {
+      throw Error::NumberOfThreadsMustBePositive{};
+    }
+  }
+
+  auto BlockingPool::number_of_threads() const noexcept -> std::size_t
+  {
+    return _number_of_threads;
+  }
+}
+
+namespace mcs::rpc
+{
+  BlockingPool::Error::NumberOfThreadsMustBePositive::NumberOfThreadsMustBePositive
+    (
+    ) noexcept
+      : mcs::Error {"Number of threads of the blocking pool must be positive."}
+  {}
+  BlockingPool::Error::NumberOfThreadsMustBePositive::~NumberOfThreadsMustBePositive
+    (
+    ) = default;
+}
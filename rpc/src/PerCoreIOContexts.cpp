@@ -0,0 +1,163 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <mcs/rpc/PerCoreIOContexts.hpp>
+#include <mcs/util/syscall/sched_getaffinity.hpp>
+#include <mcs/util/syscall/sched_setaffinity.hpp>
+#include <optional>
+#include <sched.h>
+#include <utility>
+#include <vector>
+
+namespace mcs::rpc
+{
+  namespace
+  {
+    auto cores_of_the_process() -> std::vector<std::size_t>
+    {
+      auto const allowed {util::syscall::sched_getaffinity (0)};
+      auto cores {std::vector<std::size_t>{}};
+
+      for (auto core {std::size_t {0}}; core < CPU_SETSIZE; ++core)
+      {
+        if (CPU_ISSET (core, &allowed))
+        {
+          cores.emplace_back (core);
+        }
+      }
+
+      return cores;
+    }
+
+    // binds the calling thread
+    //
+    auto pin_to_core (std::size_t core) -> void
+    {
+      auto cpu_set {cpu_set_t{}};
+      CPU_ZERO (&cpu_set);
+      CPU_SET (core, &cpu_set);
+
+      util::syscall::sched_setaffinity (0, cpu_set);
+    }
+  }
+
+  PerCoreIOContexts::PerCoreIOContexts
+    ( NumberOfContexts number_of_contexts
+    , Pinning pinning
+    )
+  {
+    if (number_of_contexts.value == 0)
+    {
+      throw Error::NumberOfContextsMustBePositive{};
+    }
+
+    auto const cores
+      { pinning == Pinning::ToCores ? cores_of_the_process()
+                                    : std::vector<std::size_t>{}
+      };
+
+    try
+    {
+      auto started {std::vector<std::future<void>>{}};
+
+      for (auto i {std::size_t {0}}; i < number_of_contexts.value; ++i)
+      {
+        auto& context {*_contexts.emplace_back (std::make_unique<Context>())};
+        auto const core
+          { cores.empty() ? std::optional<std::size_t>{}
+                          : std::optional {cores[i % cores.size()]}
+          };
+        auto promise {std::promise<void>{}};
+        started.emplace_back (promise.get_future());
+
+        _threads.emplace_back
+          ( [&context, core, promise = std::move (promise)]() mutable
+            {
+              try
+              {
+                if (core)
+                {
+                  pin_to_core (*core);
+                }
+
+                promise.set_value();
+              }
+              catch (...)
+              {
+                promise.set_exception (std::current_exception());
+
+                return;
+              }
+
+              context.io_context.run();
+            }
+          );
+      }
+
+      for (auto& thread_started : started)
+      {
+        thread_started.get();
+      }
+    }
+    catch (...)
+    {
+      stop_and_join();
+
+      throw;
+    }
+  }
+
+  PerCoreIOContexts::~PerCoreIOContexts()
+  {
+    stop_and_join();
+  }
+
+  auto PerCoreIOContexts::stop_and_join() noexcept -> void
+  {
+    for (auto& context : _contexts)
+    {
+      context->io_context.stop();
+    }
+
+    for (auto& thread : _threads)
+    {
+      if (thread.joinable())
+      {
+        thread.join();
+      }
+    }
+  }
+
+  auto PerCoreIOContexts::size() const noexcept -> std::size_t
+  {
+    return _contexts.size();
+  }
+
+  auto PerCoreIOContexts::operator[]
+    ( std::size_t i
+    ) noexcept -> asio::io_context&
+  {
+    return _contexts[i]->io_context;
+  }
+
+  auto PerCoreIOContexts::next() noexcept -> asio::io_context&
+  {
+    return operator[]
+      (_next.fetch_add (1, std::memory_order_relaxed) % _contexts.size());
+  }
+}
+
+namespace mcs::rpc
+{
+  PerCoreIOContexts::Error::NumberOfContextsMustBePositive::NumberOfContextsMustBePositive
+    (
+    ) noexcept
+      : mcs::Error {"Number of io contexts must be positive."}
+  {}
+  PerCoreIOContexts::Error::NumberOfContextsMustBePositive::~NumberOfContextsMustBePositive
+    (
+    ) = default;
+}
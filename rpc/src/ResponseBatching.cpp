@@ -0,0 +1,44 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <mcs/rpc/ResponseBatching.hpp>
+
+namespace mcs::rpc
+{
+  ResponseBatching::ResponseBatching
+    ( MaxResponses max_responses
+    , MaxLatency max_latency
+    )
+      : _max_responses {max_responses.value}
+      , _max_latency {max_latency.value}
+  {
+    if (_max_responses == 0)
+    {
+      throw Error::MaxResponsesMustBePositive{};
+    }
+  }
+
+  auto ResponseBatching::max_responses() const noexcept -> std::size_t
+  {
+    return _max_responses;
+  }
+
+  auto ResponseBatching::max_latency
+    (
+    ) const noexcept -> std::chrono::microseconds
+  {
+    return _max_latency;
+  }
+}
+
+namespace mcs::rpc
+{
+  ResponseBatching::Error::MaxResponsesMustBePositive::MaxResponsesMustBePositive
+    (
+    ) noexcept
+      : mcs::Error {"Max responses of the batching must be positive."}
+  {}
+  ResponseBatching::Error::MaxResponsesMustBePositive::~MaxResponsesMustBePositive
+    (
+    ) = default;
+}
@@ -0,0 +1,32 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <mcs/rpc/Statistics.hpp>
+#include <mcs/serialization/STD/string.hpp>
+#include <mcs/serialization/STD/vector.hpp>
+#include <mcs/util/tuplish/define.hpp>
+
+MCS_UTIL_TUPLISH_DEFINE_SERIALIZATION7
+  ( mcs::rpc::CommandStatistics
+  , command
+  , calls
+  , errors
+  , bytes_in
+  , bytes_out
+  , queueing
+  , handling
+  );
+
+MCS_UTIL_TUPLISH_DEFINE_SERIALIZATION4
+  ( mcs::rpc::ConnectionStatistics
+  , peer
+  , requests
+  , bytes_in
+  , bytes_out
+  );
+
+MCS_UTIL_TUPLISH_DEFINE_SERIALIZATION2
+  ( mcs::rpc::Statistics
+  , commands
+  , connections
+  );
@@ -12,7 +12,7 @@ namespace mcs::rpc::access_policy
     ( detail::Completion completion
     ) noexcept -> detail::CallID
   {
-    _completion = std::make_unique<detail::Completion> (std::move (completion));
+    _completion.emplace (std::move (completion));
 
     return _call_id;
   }
@@ -12,11 +12,9 @@ namespace mcs::rpc::access_policy
     ( detail::Completion completion
     ) noexcept -> detail::CallID
   {
-    _lock_send
-      = std::make_unique<std::lock_guard<decltype (_guard_send)>> (_guard_send)
-      ;
+    _lock_send = std::unique_lock {_guard_send};
 
-    _completion = std::make_unique<detail::Completion> (std::move (completion));
+    _completion.emplace (std::move (completion));
 
     return _call_id;
   }
@@ -38,7 +36,7 @@ namespace mcs::rpc::access_policy
 
   auto Sequential::completion() -> detail::Completion
   {
-    if (!_lock_send || !_completion)
+    if (!_lock_send.owns_lock() || !_completion)
     {
       throw std::logic_error {"No completion."};
     }
@@ -47,7 +45,9 @@ namespace mcs::rpc::access_policy
 
     auto completion {std::move (*_completion)}; _completion.reset();
 
-    _lock_send.reset();
+    // \note move out before unlock, the next owner assigns _lock_send
+    // as soon as the mutex is unlocked
+    auto const lock_send {std::move (_lock_send)};
 
     return completion;
   }
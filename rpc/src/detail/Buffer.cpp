@@ -2,9 +2,37 @@
 // License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
 
 #include <mcs/rpc/detail/Buffer.hpp>
+#include <mcs/rpc/detail/BufferPool.hpp>
+#include <utility>
 
 namespace mcs::rpc::detail
 {
+  auto ReturnToPool::operator() (std::byte* bytes) const noexcept -> void
+  {
+    if (pool)
+    {
+      pool->release (size_class, bytes);
+    }
+    else
+    {
+      std::default_delete<std::byte[]>{} (bytes);
+    }
+  }
+
+  Buffer::Buffer (std::size_t size)
+    : Buffer
+      { size
+      , Memory
+        { std::make_unique_for_overwrite<std::byte[]> (size).release()
+        , ReturnToPool{}
+        }
+      }
+  {}
+
+  Buffer::Buffer (std::size_t size, Memory memory)
+    : util::Buffer<std::byte[], ReturnToPool> {size, std::move (memory)}
+  {}
+
   auto Buffer::modifiable() const noexcept -> asio::mutable_buffer
   {
     auto bytes {data<std::byte>()};
@@ -0,0 +1,148 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <bit>
+#include <mcs/rpc/detail/BufferPool.hpp>
+#include <utility>
+
+namespace mcs::rpc::detail
+{
+  namespace
+  {
+    constexpr auto size_of_class (std::size_t size_class) noexcept
+      -> std::size_t
+    {
+      return BufferPool::SmallestSizeClass << size_class;
+    }
+
+    constexpr auto size_class_of (std::size_t size) noexcept -> std::size_t
+    {
+      if (size <= BufferPool::SmallestSizeClass)
+      {
+        return 0;
+      }
+
+      return std::bit_width (size - 1)
+        - std::bit_width (BufferPool::SmallestSizeClass - 1)
+        ;
+    }
+
+    static_assert (size_class_of (0) == 0);
+    static_assert (size_class_of (64) == 0);
+    static_assert (size_class_of (65) == 1);
+    static_assert (size_class_of (128) == 1);
+    static_assert (size_of_class (size_class_of (1000)) == 1024);
+    static_assert
+      ( size_of_class (BufferPool::NumberOfSizeClasses - 1)
+      == std::size_t {1} << 20u
+      );
+  }
+
+  auto BufferPool::Counters::statistics
+    (
+    ) const noexcept -> BufferPoolStatistics
+  {
+    return BufferPoolStatistics
+      { reused.load (std::memory_order_relaxed)
+      , allocated.load (std::memory_order_relaxed)
+      , oversized.load (std::memory_order_relaxed)
+      , returned.load (std::memory_order_relaxed)
+      , dropped.load (std::memory_order_relaxed)
+      , pooled_bytes.load (std::memory_order_relaxed)
+      };
+  }
+
+  BufferPool::BufferPool()
+    : BufferPool {std::make_shared<Counters>()}
+  {}
+
+  BufferPool::BufferPool (std::shared_ptr<Counters> counters) noexcept
+    : _counters {std::move (counters)}
+  {}
+
+  auto BufferPool::statistics() const noexcept -> BufferPoolStatistics
+  {
+    return _counters->statistics();
+  }
+
+  auto BufferPool::acquire (std::size_t size) -> Buffer
+  {
+    auto const size_class {size_class_of (size)};
+
+    if (size_class >= NumberOfSizeClasses)
+    {
+      _counters->oversized.fetch_add (1, std::memory_order_relaxed);
+
+      return Buffer {size};
+    }
+
+    auto memory {std::unique_ptr<std::byte[]>{}};
+
+    {
+      auto const lock {std::lock_guard {_guard}};
+
+      if (auto& free {_free[size_class]}; !free.empty())
+      {
+        memory = std::move (free.back());
+        free.pop_back();
+        _pooled_bytes -= size_of_class (size_class);
+      }
+    }
+
+    if (memory)
+    {
+      _counters->reused.fetch_add (1, std::memory_order_relaxed);
+      _counters->pooled_bytes.fetch_sub
+        (size_of_class (size_class), std::memory_order_relaxed);
+    }
+    else
+    {
+      memory = std::make_unique_for_overwrite<std::byte[]>
+        (size_of_class (size_class));
+
+      _counters->allocated.fetch_add (1, std::memory_order_relaxed);
+    }
+
+    return Buffer
+      { size
+      , Buffer::Memory
+          { memory.release()
+          , ReturnToPool {shared_from_this(), size_class}
+          }
+      };
+  }
+
+  auto BufferPool::release
+    ( std::size_t size_class
+    , std::byte* bytes
+    ) noexcept -> void
+  {
+    auto memory {std::unique_ptr<std::byte[]> {bytes}};
+    auto const size {size_of_class (size_class)};
+
+    try
+    {
+      auto const lock {std::lock_guard {_guard}};
+
+      if (_pooled_bytes + size <= MaximumPooledBytes)
+      {
+        _free[size_class].emplace_back (std::move (memory));
+        _pooled_bytes += size;
+      }
+    }
+    catch (...) // NOLINT (bugprone-empty-catch)
+    {
+      // the free list could not grow, memory is deleted below
+    }
+
+    if (memory)
+    {
+      _counters->dropped.fetch_add (1, std::memory_order_relaxed);
+    }
+    else
+    {
+      _counters->returned.fetch_add (1, std::memory_order_relaxed);
+      _counters->pooled_bytes.fetch_add (size, std::memory_order_relaxed);
+    }
+  }
+}
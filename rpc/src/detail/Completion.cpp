@@ -2,17 +2,67 @@
 // License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
 
 #include <mcs/rpc/detail/Completion.hpp>
+#include <stdexcept>
 #include <utility>
 
 namespace mcs::rpc::detail
 {
+  Completion::Completion (Completion&& other) noexcept
+    : _operations {std::exchange (other._operations, nullptr)}
+  {
+    if (_operations != nullptr)
+    {
+      _operations->relocate (other._storage.data(), _storage.data());
+    }
+  }
+
+  auto Completion::operator= (Completion&& other) noexcept -> Completion&
+  {
+    if (this != std::addressof (other))
+    {
+      reset();
+
+      _operations = std::exchange (other._operations, nullptr);
+
+      if (_operations != nullptr)
+      {
+        _operations->relocate (other._storage.data(), _storage.data());
+      }
+    }
+
+    return *this;
+  }
+
+  Completion::~Completion() noexcept
+  {
+    reset();
+  }
+
+  auto Completion::reset() noexcept -> void
+  {
+    if (_operations != nullptr)
+    {
+      std::exchange (_operations, nullptr)->destroy (_storage.data());
+    }
+  }
+
   auto Completion::operator() (std::exception_ptr rpc_error) -> void
   {
-    _complete (rpc_error, Buffer{});
+    if (_operations == nullptr)
+    {
+      throw std::logic_error {"Completion: Moved from."};
+    }
+
+    _operations->complete (_storage.data(), rpc_error, Buffer{});
   }
 
   auto Completion::operator() (Buffer buffer) -> void
   {
-    _complete (nullptr, std::move (buffer));
+    if (_operations == nullptr)
+    {
+      throw std::logic_error {"Completion: Moved from."};
+    }
+
+    _operations->complete (_storage.data(), nullptr, std::move (buffer));
   }
 }
@@ -0,0 +1,168 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <algorithm>
+#include <bit>
+#include <mcs/rpc/detail/CompletionTable.hpp>
+#include <stdexcept>
+#include <utility>
+
+namespace mcs::rpc::detail
+{
+  namespace
+  {
+    constexpr auto Taking {~std::uint64_t {0}};
+
+    constexpr auto tag (std::size_t call_id) noexcept -> std::uint64_t
+    {
+      return std::uint64_t {call_id} + 1;
+    }
+  }
+
+  CompletionTable::Ring::Ring (std::size_t first_call_id_, std::size_t size)
+    : first_call_id {first_call_id_}
+    , mask {size - 1}
+    , slots {std::make_unique<Slot[]> (size)}
+  {}
+
+  CompletionTable::CompletionTable (InitialCapacity initial_capacity)
+    : _initial_capacity
+      {std::bit_ceil (std::max (initial_capacity.value, std::size_t {1}))}
+  {}
+
+  auto CompletionTable::capacity() const noexcept -> std::size_t
+  {
+    auto capacity {std::size_t {0}};
+
+    for ( auto ring {std::size_t {0}}
+        ; ring != _number_of_rings.load (std::memory_order_acquire)
+        ; ++ring
+        )
+    {
+      capacity += _rings[ring]->mask + 1;
+    }
+
+    return capacity;
+  }
+
+  auto CompletionTable::insert (CallID call_id, Completion completion) -> void
+  {
+    auto const id {call_id.value()};
+    auto const number_of_rings
+      {_number_of_rings.load (std::memory_order_relaxed)};
+
+    auto* slot
+      { [&]() -> Slot*
+        {
+          if (number_of_rings == 0)
+          {
+            return nullptr;
+          }
+
+          auto& ring {*_rings[number_of_rings - 1]};
+          auto& candidate {ring.slots[id & ring.mask]};
+
+          return candidate.tag.load (std::memory_order_acquire) == 0
+            ? &candidate : nullptr
+            ;
+        }()
+      };
+
+    if (slot == nullptr)
+    {
+      if (number_of_rings == _rings.size())
+      {
+        throw std::logic_error {"CompletionTable: Too many rings."};
+      }
+
+      auto const size
+        { number_of_rings == 0
+        ? _initial_capacity
+        : 2 * (_rings[number_of_rings - 1]->mask + 1)
+        };
+
+      _rings[number_of_rings] = std::make_unique<Ring> (id, size);
+
+      slot = &_rings[number_of_rings]->slots[id & (size - 1)];
+
+      _number_of_rings.store (number_of_rings + 1, std::memory_order_release);
+    }
+
+    slot->completion.emplace (std::move (completion));
+    slot->tag.store (tag (id), std::memory_order_release);
+  }
+
+  auto CompletionTable::take
+    ( Slot& slot
+    , std::uint64_t expected
+    ) -> std::optional<Completion>
+  {
+    if (!slot.tag.compare_exchange_strong
+          (expected, Taking, std::memory_order_acquire)
+       )
+    {
+      return {};
+    }
+
+    auto completion {std::exchange (slot.completion, std::nullopt)};
+
+    slot.tag.store (0, std::memory_order_release);
+
+    return completion;
+  }
+
+  auto CompletionTable::take (CallID call_id) -> Completion
+  {
+    auto const id {call_id.value()};
+
+    // the call belongs to the newest ring that started at or before it
+    for ( auto ring {_number_of_rings.load (std::memory_order_acquire)}
+        ; ring != 0
+        ; --ring
+        )
+    {
+      auto& candidate {*_rings[ring - 1]};
+
+      if (candidate.first_call_id <= id)
+      {
+        if ( auto completion
+               {take (candidate.slots[id & candidate.mask], tag (id))}
+           )
+        {
+          return std::move (*completion);
+        }
+
+        break;
+      }
+    }
+
+    throw std::logic_error {"Unknown call_id."};
+  }
+
+  auto CompletionTable::error (std::exception_ptr rpc_error) noexcept -> void
+  {
+    for ( auto ring {std::size_t {0}}
+        ; ring != _number_of_rings.load (std::memory_order_acquire)
+        ; ++ring
+        )
+    {
+      auto& candidate {*_rings[ring]};
+
+      for (auto index {std::size_t {0}}; index <= candidate.mask; ++index)
+      {
+        auto& slot {candidate.slots[index]};
+        auto const expected {slot.tag.load (std::memory_order_acquire)};
+
+        if (expected == 0 || expected == Taking)
+        {
+          continue;
+        }
+
+        if (auto completion {take (slot, expected)})
+        {
+          (*completion) (rpc_error);
+        }
+      }
+    }
+  }
+}
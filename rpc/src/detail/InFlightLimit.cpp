@@ -0,0 +1,50 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <mcs/rpc/detail/InFlightLimit.hpp>
+#include <utility>
+
+namespace mcs::rpc::detail
+{
+  InFlightLimit::InFlightLimit (std::size_t limit) noexcept
+    : _limit {limit}
+  {}
+
+  auto InFlightLimit::acquire_locked() noexcept -> bool
+  {
+    if (_in_flight < _limit)
+    {
+      ++_in_flight;
+
+      return true;
+    }
+
+    return false;
+  }
+
+  auto InFlightLimit::try_acquire() -> bool
+  {
+    auto const lock {std::lock_guard {_guard}};
+
+    return acquire_locked();
+  }
+
+  auto InFlightLimit::release() noexcept -> void
+  {
+    auto lock {std::unique_lock {_guard}};
+
+    if (_waiters.empty())
+    {
+      --_in_flight;
+
+      return;
+    }
+
+    // the slot is handed over, _in_flight does not change
+    auto const waiter {std::move (_waiters.front())};
+    _waiters.pop_front();
+    lock.unlock();
+
+    waiter->resume();
+  }
+}
@@ -0,0 +1,76 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <mcs/rpc/detail/SendQueue.hpp>
+#include <utility>
+
+namespace mcs::rpc::detail
+{
+  auto SendQueue::push (std::unique_ptr<Call> call) -> void
+  {
+    auto const lock {std::lock_guard {_guard}};
+
+    _calls.emplace_back (std::move (call));
+    ++_pushed;
+  }
+
+  auto SendQueue::start_sending_or_wait() -> bool
+  {
+    auto lock {std::unique_lock {_guard}};
+
+    if (!std::exchange (_sending, true))
+    {
+      return true;
+    }
+
+    _written_or_dropped.wait
+      ( lock
+      , [this, pushed = _pushed]
+        {
+          return _done >= pushed;
+        }
+      );
+
+    return false;
+  }
+
+  auto SendQueue::take() -> std::vector<std::unique_ptr<Call>>
+  {
+    auto const lock {std::lock_guard {_guard}};
+
+    if (_calls.empty())
+    {
+      _sending = false;
+    }
+
+    return std::exchange (_calls, {});
+  }
+
+  auto SendQueue::written (std::size_t number_of_calls) -> void
+  {
+    {
+      auto const lock {std::lock_guard {_guard}};
+
+      _done += number_of_calls;
+    }
+
+    _written_or_dropped.notify_all();
+  }
+
+  auto SendQueue::stop_sending() noexcept -> void
+  {
+    auto calls {std::vector<std::unique_ptr<Call>>{}};
+
+    {
+      auto const lock {std::lock_guard {_guard}};
+
+      std::swap (calls, _calls);
+      _done = _pushed;
+      _sending = false;
+    }
+
+    calls.clear();
+
+    _written_or_dropped.notify_all();
+  }
+}
@@ -0,0 +1,183 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <iterator>
+#include <mcs/rpc/detail/StatisticsCounters.hpp>
+#include <mcs/rpc/detail/command_name.hpp>
+#include <memory>
+#include <utility>
+
+namespace mcs::rpc::detail
+{
+  auto StatisticsCounters::Histogram::add
+    ( Clock::duration latency
+    ) noexcept -> void
+  {
+    _counts[LatencyHistogram::bucket (latency)].fetch_add
+      (1, std::memory_order_relaxed);
+  }
+
+  auto StatisticsCounters::Histogram::histogram
+    (
+    ) const noexcept -> LatencyHistogram
+  {
+    auto histogram {LatencyHistogram{}};
+
+    for ( auto bucket {std::size_t {0}}
+        ; bucket < LatencyHistogram::NumberOfBuckets
+        ; ++bucket
+        )
+    {
+      histogram.counts[bucket]
+        = _counts[bucket].load (std::memory_order_relaxed);
+    }
+
+    return histogram;
+  }
+
+  StatisticsCounters::Connection::Connection
+    ( std::shared_ptr<StatisticsCounters> counters
+    , std::string peer
+    )
+      : _counters {std::move (counters)}
+      , _peer {std::move (peer)}
+  {}
+
+  auto StatisticsCounters::Connection::received
+    ( std::size_t command
+    , std::size_t bytes
+    ) noexcept -> void
+  {
+    _requests.fetch_add (1, std::memory_order_relaxed);
+    _bytes_in.fetch_add (bytes, std::memory_order_relaxed);
+
+    auto& counters {_counters->_counters[command]};
+
+    counters.calls.fetch_add (1, std::memory_order_relaxed);
+    counters.bytes_in.fetch_add (bytes, std::memory_order_relaxed);
+  }
+
+  auto StatisticsCounters::Connection::handled
+    ( std::size_t command
+    , Clock::time_point received
+    , Clock::time_point started
+    , bool is_error
+    ) noexcept -> void
+  {
+    auto& counters {_counters->_counters[command]};
+
+    counters.queueing.add (started - received);
+    counters.handling.add (Clock::now() - started);
+
+    if (is_error)
+    {
+      counters.errors.fetch_add (1, std::memory_order_relaxed);
+    }
+  }
+
+  auto StatisticsCounters::Connection::sent
+    ( std::size_t command
+    , std::size_t bytes
+    ) noexcept -> void
+  {
+    _bytes_out.fetch_add (bytes, std::memory_order_relaxed);
+    _counters->_counters[command].bytes_out.fetch_add
+      (bytes, std::memory_order_relaxed);
+  }
+
+  auto StatisticsCounters::Connection::statistics
+    (
+    ) const -> ConnectionStatistics
+  {
+    return ConnectionStatistics
+      { _peer
+      , _requests.load (std::memory_order_relaxed)
+      , _bytes_in.load (std::memory_order_relaxed)
+      , _bytes_out.load (std::memory_order_relaxed)
+      };
+  }
+
+  auto StatisticsCounters::Connection::counters
+    (
+    ) const noexcept -> StatisticsCounters const&
+  {
+    return *_counters;
+  }
+
+  StatisticsCounters::StatisticsCounters
+    ( std::vector<std::string> const& commands
+    )
+      : _counters (commands.size())
+  {
+    _commands.reserve (commands.size());
+
+    for (auto const& command : commands)
+    {
+      _commands.emplace_back (demangle (command));
+    }
+  }
+
+  auto StatisticsCounters::connect
+    ( std::shared_ptr<StatisticsCounters> counters
+    , std::string peer
+    ) -> std::shared_ptr<Connection>
+  {
+    auto& self {*counters};
+    auto connection
+      {std::make_shared<Connection> (std::move (counters), std::move (peer))};
+
+    auto const lock {std::lock_guard {self._guard}};
+
+    // forget the closed connections
+    std::erase_if
+      ( self._connections
+      , [] (auto const& known) { return known.expired(); }
+      );
+
+    self._connections.emplace_back (connection);
+
+    return connection;
+  }
+
+  auto StatisticsCounters::statistics() const -> Statistics
+  {
+    auto statistics {Statistics{}};
+
+    for (auto command {std::size_t {0}}; command < _commands.size(); ++command)
+    {
+      auto const& counters {_counters[command]};
+
+      statistics.commands.emplace_back
+        ( CommandStatistics
+          { _commands[command]
+          , counters.calls.load (std::memory_order_relaxed)
+          , counters.errors.load (std::memory_order_relaxed)
+          , counters.bytes_in.load (std::memory_order_relaxed)
+          , counters.bytes_out.load (std::memory_order_relaxed)
+          , counters.queueing.histogram()
+          , counters.handling.histogram()
+          }
+        );
+    }
+
+    auto const lock {std::lock_guard {_guard}};
+
+    for ( auto known {std::begin (_connections)}
+        ; known != std::end (_connections)
+        ;
+        )
+    {
+      if (auto const connection {known->lock()})
+      {
+        statistics.connections.emplace_back (connection->statistics());
+        ++known;
+      }
+      else
+      {
+        known = _connections.erase (known);
+      }
+    }
+
+    return statistics;
+  }
+}
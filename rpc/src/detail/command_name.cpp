@@ -0,0 +1,23 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <cstdlib>
+#include <cxxabi.h>
+#include <mcs/rpc/detail/command_name.hpp>
+#include <memory>
+
+namespace mcs::rpc::detail
+{
+  auto demangle (std::string const& name) -> std::string
+  {
+    auto status {0};
+    auto const demangled
+      { std::unique_ptr<char, decltype (&std::free)>
+          { abi::__cxa_demangle (name.c_str(), nullptr, nullptr, &status)
+          , &std::free
+          }
+      };
+
+    return (status == 0 && demangled) ? std::string {demangled.get()} : name;
+  }
+}
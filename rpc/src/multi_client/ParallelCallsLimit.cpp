@@ -11,4 +11,21 @@ namespace mcs::rpc::multi_client
       : mcs::Error {"Maximum number of parallel calls must be positive."}
   {}
   ParallelCalls::AtMost::Error::MustBePositive::~MustBePositive() = default;
+
+  ParallelCalls::Adaptive::Error::MustBePositive::MustBePositive
+    (
+    ) noexcept
+      : mcs::Error {"Initial number of parallel calls must be positive."}
+  {}
+  ParallelCalls::Adaptive::Error::MustBePositive::~MustBePositive() = default;
+
+  ParallelCalls::Adaptive::Error::InitialExceedsMaximum::InitialExceedsMaximum
+    (
+    ) noexcept
+      : mcs::Error
+        {"Initial number of parallel calls must not exceed the maximum."}
+  {}
+  ParallelCalls::Adaptive::Error::InitialExceedsMaximum::~InitialExceedsMaximum
+    (
+    ) = default;
 }
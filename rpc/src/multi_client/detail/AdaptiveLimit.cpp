@@ -0,0 +1,67 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <algorithm>
+#include <mcs/rpc/multi_client/detail/AdaptiveLimit.hpp>
+#include <stdexcept>
+
+namespace mcs::rpc::multi_client::detail
+{
+  AdaptiveLimit::AdaptiveLimit
+    ( ParallelCalls::Adaptive adaptive
+    ) noexcept
+      : _maximum {adaptive.maximum}
+      , _limit {static_cast<double> (adaptive.initial)}
+  {}
+
+  auto AdaptiveLimit::value() const noexcept -> unsigned int
+  {
+    return static_cast<unsigned int> (_limit);
+  }
+
+  auto AdaptiveLimit::call_started
+    ( CallID call_id
+    , Clock::time_point now
+    ) -> void
+  {
+    if (!_starts.emplace (call_id, Start {now, _calls_started}).second)
+    {
+      throw std::logic_error {"Duplicate call id."};
+    }
+
+    ++_calls_started;
+  }
+
+  auto AdaptiveLimit::call_completed
+    ( CallID call_id
+    , Clock::time_point now
+    ) -> void
+  {
+    auto const start {_starts.extract (call_id)};
+
+    if (start.empty())
+    {
+      throw std::logic_error {"Unknown call_id"};
+    }
+
+    auto const latency {now - start.mapped().time};
+
+    if (!_minimum_latency || latency < *_minimum_latency)
+    {
+      _minimum_latency = latency;
+    }
+
+    if (latency <= Tolerance * *_minimum_latency)
+    {
+      _limit = std::min
+        ( _limit + 1.0 / _limit
+        , static_cast<double> (_maximum)
+        );
+    }
+    else if (start.mapped().sequence >= _first_call_after_decrease)
+    {
+      _limit = std::max (_limit / 2.0, 1.0);
+      _first_call_after_decrease = _calls_started;
+    }
+  }
+}
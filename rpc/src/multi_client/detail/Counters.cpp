@@ -6,6 +6,7 @@
 #include <mcs/rpc/multi_client/detail/Counters.hpp>
 #include <stdexcept>
 #include <utility>
+#include <variant>
 
 namespace mcs::rpc::multi_client::detail
 {
@@ -13,7 +14,16 @@ namespace mcs::rpc::multi_client::detail
     ( multi_client::ParallelCallsLimit parallel_calls_limit
     ) noexcept
       : _parallel_calls_limit {parallel_calls_limit}
-  {}
+  {
+    if ( auto const* adaptive
+           { std::get_if<multi_client::ParallelCalls::Adaptive>
+               (&_parallel_calls_limit)
+           }
+       )
+    {
+      _adaptive_limit.emplace (*adaptive);
+    }
+  }
 
   auto Counters::call_started (CallID call_id) -> void
   try
@@ -96,6 +106,11 @@ namespace mcs::rpc::multi_client::detail
     {
       throw std::logic_error {"Duplicate call id."};
     }
+
+    if (_adaptive_limit)
+    {
+      _adaptive_limit->call_started (call_id, AdaptiveLimit::Clock::now());
+    }
   }
 
   auto Counters::complete (Guarded const&, CallID call_id) -> void
@@ -110,6 +125,11 @@ namespace mcs::rpc::multi_client::detail
       throw std::logic_error {"Duplicate call id."};
     }
 
+    if (_adaptive_limit)
+    {
+      _adaptive_limit->call_completed (call_id, AdaptiveLimit::Clock::now());
+    }
+
     _completed.notify_one();
   }
 }
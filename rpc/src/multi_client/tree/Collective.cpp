@@ -0,0 +1,14 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <mcs/rpc/multi_client/tree/Collective.hpp>
+
+namespace mcs::rpc::multi_client::tree
+{
+  Arity::Error::MustBePositive::MustBePositive
+    (
+    ) noexcept
+      : mcs::Error {"Arity of the tree must be positive."}
+  {}
+  Arity::Error::MustBePositive::~MustBePositive() = default;
+}
@@ -0,0 +1,49 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <mcs/rpc/multi_client/tree/Collective.hpp>
+#include <mcs/rpc/multi_client/tree/detail/split.hpp>
+#include <mcs/util/cast.hpp>
+
+namespace mcs::rpc::multi_client::tree::detail
+{
+  auto split
+    ( std::vector<util::ASIO::AnyConnectable> subtree
+    , std::size_t arity
+    ) -> std::vector<Child>
+  {
+    // \note the arity comes from the wire, Arity rejects zero
+    auto const number_of_children
+      {std::min (Arity {arity}.value, subtree.size())};
+    auto children {std::vector<Child>{}};
+    children.reserve (number_of_children);
+
+    auto begin {std::make_move_iterator (std::begin (subtree))};
+
+    for (auto child {std::size_t {0}}; child < number_of_children; ++child)
+    {
+      // the first parts are one larger than the last parts
+      auto const size
+        { util::cast<std::ptrdiff_t>
+            ( subtree.size() / number_of_children
+            + (child < subtree.size() % number_of_children ? 1 : 0)
+            )
+        };
+
+      children.emplace_back
+        ( Child
+          { *begin
+          , std::vector<util::ASIO::AnyConnectable>
+              {std::next (begin), std::next (begin, size)}
+          }
+        );
+
+      std::advance (begin, size);
+    }
+
+    return children;
+  }
+}
@@ -0,0 +1,33 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <mcs/rpc/multi_connection/LeastOutstanding.hpp>
+
+namespace mcs::rpc::multi_connection
+{
+  auto LeastOutstanding::select
+    ( std::span<std::atomic<std::size_t> const> outstanding_calls
+    ) noexcept -> std::size_t
+  {
+    auto const n {outstanding_calls.size()};
+    auto const start {_start.fetch_add (1, std::memory_order_relaxed) % n};
+
+    auto selected {start};
+    auto least {outstanding_calls[start].load (std::memory_order_relaxed)};
+
+    for (auto i {std::size_t {1}}; i < n && least > 0; ++i)
+    {
+      auto const candidate {(start + i) % n};
+      auto const outstanding
+        {outstanding_calls[candidate].load (std::memory_order_relaxed)};
+
+      if (outstanding < least)
+      {
+        selected = candidate;
+        least = outstanding;
+      }
+    }
+
+    return selected;
+  }
+}
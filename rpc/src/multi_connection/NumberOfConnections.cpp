@@ -0,0 +1,14 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <mcs/rpc/multi_connection/NumberOfConnections.hpp>
+
+namespace mcs::rpc::multi_connection
+{
+  NumberOfConnections::Error::MustBePositive::MustBePositive
+    (
+    ) noexcept
+      : mcs::Error {"Number of connections must be positive."}
+  {}
+  NumberOfConnections::Error::MustBePositive::~MustBePositive() = default;
+}
@@ -0,0 +1,16 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <mcs/rpc/multi_connection/RoundRobin.hpp>
+
+namespace mcs::rpc::multi_connection
+{
+  auto RoundRobin::select
+    ( std::span<std::atomic<std::size_t> const> outstanding_calls
+    ) noexcept -> std::size_t
+  {
+    return _next.fetch_add (1, std::memory_order_relaxed)
+      % outstanding_calls.size()
+      ;
+  }
+}
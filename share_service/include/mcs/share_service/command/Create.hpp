@@ -36,6 +36,9 @@ namespace mcs::share_service::command
       = SupportedStorageImplementations::fmap<create::Parameters>
       ;
 
+    // creates and maps the storage in the handler
+    static constexpr auto is_blocking {true};
+
     core::memory::Size size;
     typename Parameters::Variant parameters;
   };
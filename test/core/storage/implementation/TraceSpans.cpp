@@ -0,0 +1,142 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <algorithm>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <mcs/core/memory/Size.hpp>
+#include <mcs/core/storage/MaxSize.hpp>
+#include <mcs/core/storage/implementation/Heap.hpp>
+#include <mcs/core/storage/implementation/Trace.hpp>
+#include <mcs/core/storage/tracer/Record.hpp>
+#include <mcs/testing/core/storage/implementation/Heap.hpp>
+#include <mcs/testing/random/Test.hpp>
+#include <mcs/testing/random/value/integral.hpp>
+#include <mcs/util/trace/Context.hpp>
+#include <mcs/util/trace/Recorder.hpp>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace mcs::core
+{
+  namespace
+  {
+    using TestingStorage = testing::core::storage::implementation::Heap;
+    using Storage = typename TestingStorage::Storage;
+    using Tracer = storage::tracer::Record<Storage>;
+    using TracedStorage = storage::implementation::Trace<Tracer, Storage>;
+
+    struct MCSStorageTraceSpansR : public testing::random::Test
+    {
+      MCSStorageTraceSpansR()
+      {
+        util::trace::install (recorder);
+      }
+      ~MCSStorageTraceSpansR() override
+      {
+        util::trace::install (nullptr);
+      }
+      MCSStorageTraceSpansR (MCSStorageTraceSpansR const&) = delete;
+      MCSStorageTraceSpansR (MCSStorageTraceSpansR&&) = delete;
+      auto operator= (MCSStorageTraceSpansR const&)
+        -> MCSStorageTraceSpansR& = delete;
+      auto operator= (MCSStorageTraceSpansR&&)
+        -> MCSStorageTraceSpansR& = delete;
+
+      std::shared_ptr<util::trace::Recorder> recorder
+        {std::make_shared<util::trace::Recorder>()};
+
+      TestingStorage testing_storage
+        { "TraceSpans"
+        , storage::MaxSize::Limit {memory::make_size (2 << 20)}
+        };
+      typename Tracer::Events events;
+      TracedStorage traced_storage
+        { typename TracedStorage::Parameter::Create
+          { typename Tracer::Parameter::Create {std::addressof (events)}
+          , testing_storage.parameter_create()
+          }
+        };
+
+      auto use_storage() -> void
+      {
+        std::ignore = traced_storage.size_max
+          (testing_storage.parameter_size_max());
+        std::ignore = traced_storage.size_used
+          (testing_storage.parameter_size_used());
+        auto const segment_id
+          { traced_storage.segment_create
+            ( testing_storage.parameter_segment_create()
+            , memory::make_size (2 << 10)
+            )
+          };
+        std::ignore = traced_storage.segment_remove
+          (testing_storage.parameter_segment_remove(), segment_id);
+      }
+
+      auto span_names() const -> std::vector<std::string>
+      {
+        auto names {std::vector<std::string>{}};
+        auto const spans {recorder->spans()};
+
+        std::ranges::transform
+          ( spans
+          , std::back_inserter (names)
+          , &util::trace::Recorded::name
+          );
+
+        return names;
+      }
+    };
+  }
+
+  TEST_F (MCSStorageTraceSpansR, untraced_operations_are_not_recorded)
+  {
+    use_storage();
+
+    ASSERT_TRUE (recorder->spans().empty());
+  }
+
+  TEST_F
+    ( MCSStorageTraceSpansR
+    , traced_operations_are_recorded_as_children_of_the_current_context
+    )
+  {
+    using RandomID = testing::random::value<std::uint64_t>;
+
+    auto const context
+      { util::trace::Context
+        { RandomID {RandomID::Min {1u}}()
+        , RandomID {RandomID::Min {1u}}()
+        }
+      };
+
+    {
+      auto const scoped_context {util::trace::ScopedContext {context}};
+
+      use_storage();
+    }
+
+    ASSERT_EQ
+      ( span_names()
+      , ( std::vector<std::string>
+          { "storage::size_max"
+          , "storage::size_used"
+          , "storage::segment_create"
+          , "storage::segment_remove"
+          }
+        )
+      );
+
+    for (auto const& span : recorder->spans())
+    {
+      ASSERT_EQ (span.category, "storage");
+      ASSERT_EQ (span.kind, util::trace::Kind::Internal);
+      ASSERT_EQ (span.trace_id, context.trace_id);
+      ASSERT_EQ (span.parent_span, context.parent_span);
+    }
+  }
+}
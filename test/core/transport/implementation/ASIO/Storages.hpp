@@ -0,0 +1,520 @@
+// Copyright (C) 2023-2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <algorithm>
+#include <asio/ip/tcp.hpp>
+#include <asio/local/stream_protocol.hpp>
+#include <cstddef>
+#include <fmt/format.h>
+#include <future>
+#include <gtest/gtest.h>
+#include <mcs/core/Chunk.hpp>
+#include <mcs/core/Storages.hpp>
+#include <mcs/core/UniqueStorage.hpp>
+#include <mcs/core/memory/Offset.hpp>
+#include <mcs/core/memory/Range.hpp>
+#include <mcs/core/memory/Size.hpp>
+#include <mcs/core/storage/Parameter.hpp>
+#include <mcs/core/storage/UniqueSegment.hpp>
+#include <mcs/core/transport/Address.hpp>
+#include <mcs/core/transport/implementation/ASIO/Client.hpp>
+#include <mcs/core/transport/implementation/ASIO/Provider.hpp>
+#include <mcs/core/transport/implementation/ASIO/Weight.hpp>
+#include <mcs/core/transport/implementation/ASIO/client/Credits.hpp>
+#include <mcs/core/transport/implementation/ASIO/client/Encoding.hpp>
+#include <mcs/core/transport/implementation/ASIO/client/Lanes.hpp>
+#include <mcs/core/transport/implementation/ASIO/provider/Scheduler.hpp>
+#include <mcs/core/transport/implementation/ASIO/provider/ZeroCopy.hpp>
+#include <mcs/rpc/Concepts.hpp>
+#include <mcs/rpc/ScopedRunningIOContext.hpp>
+#include <mcs/rpc/access_policy/Exclusive.hpp>
+#include <mcs/testing/RPC/ProtocolState.hpp>
+#include <mcs/testing/core/storage/implementation/Files.hpp>
+#include <mcs/testing/core/storage/implementation/Heap.hpp>
+#include <mcs/testing/core/storage/implementation/SHMEM.hpp>
+#include <mcs/testing/core/storage/implementation/Virtual.hpp>
+#include <mcs/testing/random/Test.hpp>
+#include <mcs/testing/random/value/integral.hpp>
+#include <mcs/util/ASIO/Connectable.hpp>
+#include <mcs/util/type/List.hpp>
+#include <memory>
+#include <optional>
+#include <span>
+#include <utility>
+
+namespace mcs::core
+{
+  namespace
+  {
+    template<rpc::is_protocol P, typename L, typename R>
+      struct ProtocolAndStorages
+    {
+      using Protocol = P;
+      using First = L;
+      using Second = R;
+    };
+
+    namespace Impl = testing::core::storage::implementation;
+
+    using RandomSize = testing::random::value<std::size_t>;
+
+    using StoragePairs = ::testing::Types
+      < ProtocolAndStorages<asio::ip::tcp, Impl::Files, Impl::Files>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Files, Impl::Heap>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Files, Impl::SHMEM>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Heap, Impl::Files>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Heap, Impl::Heap>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Heap, Impl::SHMEM>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::SHMEM, Impl::Files>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::SHMEM, Impl::Heap>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::SHMEM, Impl::SHMEM>
+
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Virtual<Impl::Files>, Impl::Files>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Virtual<Impl::Files>, Impl::Heap>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Virtual<Impl::Files>, Impl::SHMEM>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Virtual<Impl::Heap>, Impl::Files>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Virtual<Impl::Heap>, Impl::Heap>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Virtual<Impl::Heap>, Impl::SHMEM>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Virtual<Impl::SHMEM>, Impl::Files>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Virtual<Impl::SHMEM>, Impl::Heap>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Virtual<Impl::SHMEM>, Impl::SHMEM>
+
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Files, Impl::Virtual<Impl::Files>>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Files, Impl::Virtual<Impl::Heap>>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Files, Impl::Virtual<Impl::SHMEM>>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Heap, Impl::Virtual<Impl::Files>>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Heap, Impl::Virtual<Impl::Heap>>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Heap, Impl::Virtual<Impl::SHMEM>>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::SHMEM, Impl::Virtual<Impl::Files>>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::SHMEM, Impl::Virtual<Impl::Heap>>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::SHMEM, Impl::Virtual<Impl::SHMEM>>
+
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Virtual<Impl::Files>, Impl::Virtual<Impl::Files>>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Virtual<Impl::Files>, Impl::Virtual<Impl::Heap>>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Virtual<Impl::Files>, Impl::Virtual<Impl::SHMEM>>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Virtual<Impl::Heap>, Impl::Virtual<Impl::Files>>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Virtual<Impl::Heap>, Impl::Virtual<Impl::Heap>>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Virtual<Impl::Heap>, Impl::Virtual<Impl::SHMEM>>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Virtual<Impl::SHMEM>, Impl::Virtual<Impl::Files>>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Virtual<Impl::SHMEM>, Impl::Virtual<Impl::Heap>>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Virtual<Impl::SHMEM>, Impl::Virtual<Impl::SHMEM>>
+
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Files, Impl::Files>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Files, Impl::Heap>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Files, Impl::SHMEM>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Heap, Impl::Files>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Heap, Impl::Heap>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Heap, Impl::SHMEM>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::SHMEM, Impl::Files>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::SHMEM, Impl::Heap>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::SHMEM, Impl::SHMEM>
+
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Virtual<Impl::Files>, Impl::Files>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Virtual<Impl::Files>, Impl::Heap>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Virtual<Impl::Files>, Impl::SHMEM>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Virtual<Impl::Heap>, Impl::Files>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Virtual<Impl::Heap>, Impl::Heap>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Virtual<Impl::Heap>, Impl::SHMEM>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Virtual<Impl::SHMEM>, Impl::Files>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Virtual<Impl::SHMEM>, Impl::Heap>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Virtual<Impl::SHMEM>, Impl::SHMEM>
+
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Files, Impl::Virtual<Impl::Files>>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Files, Impl::Virtual<Impl::Heap>>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Files, Impl::Virtual<Impl::SHMEM>>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Heap, Impl::Virtual<Impl::Files>>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Heap, Impl::Virtual<Impl::Heap>>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Heap, Impl::Virtual<Impl::SHMEM>>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::SHMEM, Impl::Virtual<Impl::Files>>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::SHMEM, Impl::Virtual<Impl::Heap>>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::SHMEM, Impl::Virtual<Impl::SHMEM>>
+
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Virtual<Impl::Files>, Impl::Virtual<Impl::Files>>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Virtual<Impl::Files>, Impl::Virtual<Impl::Heap>>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Virtual<Impl::Files>, Impl::Virtual<Impl::SHMEM>>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Virtual<Impl::Heap>, Impl::Virtual<Impl::Files>>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Virtual<Impl::Heap>, Impl::Virtual<Impl::Heap>>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Virtual<Impl::Heap>, Impl::Virtual<Impl::SHMEM>>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Virtual<Impl::SHMEM>, Impl::Virtual<Impl::Files>>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Virtual<Impl::SHMEM>, Impl::Virtual<Impl::Heap>>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Virtual<Impl::SHMEM>, Impl::Virtual<Impl::SHMEM>>
+      >;
+
+    // The optional parameters of a StoragesProvider.
+    //
+    struct ProviderOptions
+    {
+      transport::implementation::ASIO::provider::ZeroCopy zero_copy {};
+      transport::implementation::ASIO::provider::Scheduler scheduler {};
+      std::optional<asio::local::stream_protocol::endpoint> same_host {};
+    };
+
+    template< typename Element
+            , rpc::is_protocol Protocol
+            , typename TestingStorage
+            >
+      struct StoragesProvider
+    {
+      using SupportedStorageImplementations
+        = util::type::List<typename TestingStorage::Storage>
+        ;
+
+      using ProviderImplementation
+        = core::transport::implementation::ASIO::Provider
+            < Protocol
+            , SupportedStorageImplementations
+            >
+        ;
+
+      template<typename RandomElement, typename Tag>
+        StoragesProvider
+          ( RandomElement& random_element
+          , std::size_t number_of_elements_per_chunk
+          , memory::Size number_of_bytes_per_chunk
+          , Tag tag
+          , ProviderOptions options = ProviderOptions{}
+          )
+            : _testing_storage {fmt::format ("P-{}", tag)}
+            , _number_of_bytes_per_chunk {number_of_bytes_per_chunk}
+            , _protocol_state {fmt::format ("P-{}", tag)}
+            , _options {std::move (options)}
+      {
+        std::generate_n
+          ( _elements.begin()
+          , number_of_elements_per_chunk
+          , random_element
+          );
+      }
+
+      [[nodiscard]] auto connection_information
+        (
+        ) const -> util::ASIO::Connectable<Protocol>
+      {
+        return _provider.connection_information();
+      }
+
+      [[nodiscard]] auto source() const -> transport::Address
+      {
+        return transport::Address
+          { _storage->id()
+          , storage::make_parameter
+              (_testing_storage.parameter_chunk_description())
+          , _segment->id()
+          , memory::make_offset (0)
+          };
+      }
+
+      [[nodiscard]] auto elements() -> std::span<Element const>
+      {
+        return _elements;
+      }
+
+    private:
+      core::Storages<SupportedStorageImplementations> _storages{};
+      TestingStorage _testing_storage;
+      memory::Size _number_of_bytes_per_chunk;
+      SupportedStorageImplementations::template wrap
+          < UniqueStorage
+          , typename TestingStorage::Storage
+          > _storage
+            { make_unique_storage<typename TestingStorage::Storage>
+                ( std::addressof (_storages)
+                , _testing_storage.parameter_create()
+                )
+            };
+      SupportedStorageImplementations::template wrap
+        < storage::UniqueSegment
+        , typename TestingStorage::Storage
+        > _segment
+          { storage::make_unique_segment<typename TestingStorage::Storage>
+              ( std::addressof (_storages)
+              , _storage->id()
+              , _number_of_bytes_per_chunk
+              , _testing_storage.parameter_segment_create()
+              , _testing_storage.parameter_segment_remove()
+              )
+          };
+      SupportedStorageImplementations::template wrap
+          < Chunk
+          , chunk::access::Mutable
+          > _chunk
+            { _storages.template chunk_description
+                  < typename TestingStorage::Storage
+                  , chunk::access::Mutable
+                  >
+                ( _storages.read_access()
+                , _storage->id()
+                , _testing_storage.parameter_chunk_description()
+                , _segment->id()
+                , memory::make_range ( memory::make_offset (0)
+                                     , _number_of_bytes_per_chunk
+                                     )
+                )
+            };
+      std::span<Element> _elements {as<Element> (_chunk)};
+      rpc::ScopedRunningIOContext _io_context
+        {rpc::ScopedRunningIOContext::NumberOfThreads {1u}, SIGINT, SIGTERM};
+      testing::RPC::ProtocolState<Protocol> _protocol_state;
+      ProviderOptions _options;
+      ProviderImplementation _provider
+        { _io_context
+        , _protocol_state.local_endpoint()
+        , std::addressof (_storages)
+        , _options.zero_copy
+        , _options.scheduler
+        , _options.same_host
+        };
+    };
+
+    // The optional parameters of a StoragesClient.
+    //
+    struct ClientOptions
+    {
+      transport::implementation::ASIO::client::Lanes lanes {};
+      std::optional<transport::implementation::ASIO::Weight> weight {};
+      transport::implementation::ASIO::client::Encoding encoding {};
+      transport::implementation::ASIO::client::Credits credits {};
+    };
+
+    template< typename Element
+            , rpc::is_protocol Protocol
+            , typename TestingStorage
+            , typename StoragesProvider
+            >
+      struct StoragesClient
+    {
+      using SupportedClientStorageImplementations
+        = util::type::List<typename TestingStorage::Storage>
+        ;
+
+      using ProviderImplementation
+        = typename StoragesProvider::ProviderImplementation
+        ;
+
+      using TransportClient = transport::implementation::ASIO::Client
+        < Protocol
+        , rpc::access_policy::Exclusive
+        , SupportedClientStorageImplementations
+        >;
+
+      template<typename Tag>
+        StoragesClient
+          ( util::ASIO::Connectable<Protocol> connection_information
+          , memory::Size number_of_bytes_per_chunk
+          , Tag tag
+          , ClientOptions options = ClientOptions{}
+          )
+            : _testing_storage {fmt::format ("C-{}", tag)}
+            , _number_of_bytes_per_chunk {number_of_bytes_per_chunk}
+            , _connection_information {connection_information}
+            , _options {std::move (options)}
+      {}
+
+      [[nodiscard]] auto memory_get
+        ( transport::Address source
+        ) const -> std::future<memory::Size>
+      {
+        return _client.memory_get
+          ( local_address()
+          , source
+          , _number_of_bytes_per_chunk
+          );
+      }
+
+      [[nodiscard]] auto memory_put
+        ( transport::Address destination
+        ) const -> std::future<memory::Size>
+      {
+        return _client.memory_put
+          ( destination
+          , local_address()
+          , _number_of_bytes_per_chunk
+          );
+      }
+
+      template<typename CompletionToken>
+        auto memory_get
+          ( transport::Address source
+          , CompletionToken&& token
+          ) const
+      {
+        return _client.memory_get
+          ( local_address()
+          , source
+          , _number_of_bytes_per_chunk
+          , std::forward<CompletionToken> (token)
+          );
+      }
+
+      template<typename CompletionToken>
+        auto memory_put
+          ( transport::Address destination
+          , CompletionToken&& token
+          ) const
+      {
+        return _client.memory_put
+          ( destination
+          , local_address()
+          , _number_of_bytes_per_chunk
+          , std::forward<CompletionToken> (token)
+          );
+      }
+
+      [[nodiscard]] auto memory_copy
+        ( transport::Address destination
+        , util::ASIO::AnyConnectable source_provider
+        , transport::Address source
+        ) const -> std::future<memory::Size>
+      {
+        return _client.memory_copy
+          ( destination
+          , source_provider
+          , source
+          , _number_of_bytes_per_chunk
+          );
+      }
+
+      [[nodiscard]] auto local_address() const -> transport::Address
+      {
+        return transport::Address
+          { _storage->id()
+          , storage::make_parameter
+              (_testing_storage.parameter_chunk_description())
+          , _segment->id()
+          , memory::make_offset (0)
+          };
+      }
+
+      [[nodiscard]] auto transport_client() const -> TransportClient const&
+      {
+        return _client;
+      }
+
+      [[nodiscard]] auto elements() -> std::span<Element const>
+      {
+        return _elements;
+      }
+
+      template<typename Generator>
+        auto generate (Generator&& generator)
+      {
+        auto const chunk
+          { typename SupportedClientStorageImplementations::template wrap
+              < Chunk
+              , chunk::access::Mutable
+              >
+                { _storages.template chunk_description
+                      < typename TestingStorage::Storage
+                      , chunk::access::Mutable
+                      >
+                    ( _storages.read_access()
+                    , _storage->id()
+                    , _testing_storage.parameter_chunk_description()
+                    , _segment->id()
+                    , memory::make_range ( memory::make_offset (0)
+                                         , _number_of_bytes_per_chunk
+                                         )
+                    )
+                }
+          };
+        std::ranges::generate
+          (as<Element> (chunk), std::forward<Generator> (generator));
+      }
+
+    private:
+      Storages<SupportedClientStorageImplementations> _storages{};
+      TestingStorage _testing_storage;
+      memory::Size _number_of_bytes_per_chunk;
+      SupportedClientStorageImplementations::template wrap
+        < UniqueStorage
+        , typename TestingStorage::Storage
+        > _storage
+          { make_unique_storage<typename TestingStorage::Storage>
+              ( std::addressof (_storages)
+              , _testing_storage.parameter_create()
+              )
+          };
+      SupportedClientStorageImplementations::template wrap
+        < storage::UniqueSegment
+        , typename TestingStorage::Storage
+        > _segment
+          { storage::make_unique_segment<typename TestingStorage::Storage>
+            ( std::addressof (_storages)
+            , _storage->id()
+            , _number_of_bytes_per_chunk
+            , _testing_storage.parameter_segment_create()
+            , _testing_storage.parameter_segment_remove()
+            )
+        };
+      SupportedClientStorageImplementations::template wrap
+        < Chunk
+        , chunk::access::Const
+        > _chunk
+          { _storages.template chunk_description
+                < typename TestingStorage::Storage
+                , chunk::access::Const
+                >
+              ( _storages.read_access()
+              , _storage->id()
+              , _testing_storage.parameter_chunk_description()
+              , _segment->id()
+              , memory::make_range ( memory::make_offset (0)
+                                   , _number_of_bytes_per_chunk
+                                   )
+              )
+          };
+      std::span<Element const> _elements {as<Element const> (_chunk)};
+      rpc::ScopedRunningIOContext _io_context
+        {rpc::ScopedRunningIOContext::NumberOfThreads {1u}, SIGINT, SIGTERM};
+
+      util::ASIO::Connectable<Protocol> _connection_information;
+      ClientOptions _options;
+      TransportClient _client
+          { _io_context
+          , _connection_information
+          , std::addressof (_storages)
+          , _options.lanes
+          , _options.weight
+          , _options.encoding
+          , _options.credits
+          };
+    };
+
+    using Element = int;
+
+    // The provider provides a storage of the first kind, the client
+    // uses a storage of the second kind.
+    //
+    template<typename ProtocolAndStorages>
+      using ProviderOf = StoragesProvider
+        < Element
+        , typename ProtocolAndStorages::Protocol
+        , typename ProtocolAndStorages::First
+        >;
+    template<typename ProtocolAndStorages>
+      using ClientOf = StoragesClient
+        < Element
+        , typename ProtocolAndStorages::Protocol
+        , typename ProtocolAndStorages::Second
+        , ProviderOf<ProtocolAndStorages>
+        >;
+
+    // Chunks of a random size with random elements.
+    //
+    template<typename ProtocolAndStorages>
+      struct MCSTransportAsio : public testing::random::Test
+    {
+      std::size_t const number_of_elements_per_chunk
+        { RandomSize { RandomSize::Min {32 << 10}
+                     , RandomSize::Max {64 << 10}
+                     }()
+        };
+      memory::Size const number_of_bytes_per_chunk
+        {memory::make_size (number_of_elements_per_chunk * sizeof (Element))};
+      testing::random::value<Element> random_element;
+    };
+    TYPED_TEST_SUITE (MCSTransportAsio, StoragePairs);
+  }
+}
@@ -0,0 +1,116 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include "Storages.hpp"
+#include <cstddef>
+#include <fmt/format.h>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <list>
+#include <mcs/core/memory/Size.hpp>
+#include <mcs/core/transport/implementation/ASIO/Broadcast.hpp>
+#include <mcs/util/ASIO/Connectable.hpp>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace mcs::core
+{
+  TYPED_TEST (MCSTransportAsio, broadcast_works)
+  {
+    using SourceProvider = ProviderOf<TypeParam>;
+    using DestinationProvider = StoragesProvider
+      < Element
+      , typename TypeParam::Protocol
+      , typename TypeParam::Second
+      >;
+    using Client = StoragesClient
+      < Element
+      , typename TypeParam::Protocol
+      , typename TypeParam::Second
+      , DestinationProvider
+      >;
+    using Broadcast = transport::implementation::ASIO::Broadcast;
+    using Target = Broadcast::Target<typename Client::TransportClient>;
+
+    auto const number_of_targets
+      {RandomSize {RandomSize::Min {1}, RandomSize::Max {7}}()};
+
+    auto source
+      { SourceProvider
+        { this->random_element
+        , this->number_of_elements_per_chunk
+        , this->number_of_bytes_per_chunk
+        , "source"
+        }
+      };
+
+    // a fragment size that is not a divisor of the chunk size
+    auto const fragment_size
+      { RandomSize { RandomSize::Min {4 << 10}
+                   , RandomSize::Max {64 << 10}
+                   }() | 1u
+      };
+
+    // chain, binary tree and flat
+    for (auto fan_out : {std::size_t {1}, std::size_t {2}, number_of_targets})
+    {
+      auto destinations {std::list<DestinationProvider>{}};
+      auto clients {std::list<Client>{}};
+      auto targets {std::vector<Target>{}};
+
+      for (auto i {std::size_t {0}}; i < number_of_targets; ++i)
+      {
+        auto const tag {fmt::format ("destination-{}-{}", fan_out, i)};
+
+        auto& destination
+          { destinations.emplace_back
+            ( this->random_element
+            , this->number_of_elements_per_chunk
+            , this->number_of_bytes_per_chunk
+            , tag
+            )
+          };
+        auto const& client
+          { clients.emplace_back
+            ( destination.connection_information()
+            , this->number_of_bytes_per_chunk
+            , tag
+            )
+          };
+
+        targets.emplace_back
+          ( Target
+            { std::addressof (client.transport_client())
+            , util::ASIO::AnyConnectable {destination.connection_information()}
+            , destination.source()
+            }
+          );
+      }
+
+      auto const broadcast
+        { Broadcast
+          { Broadcast::FragmentSize {memory::make_size (fragment_size)}
+          , Broadcast::FanOut {fan_out}
+          }
+        };
+
+      ASSERT_NO_THROW
+        ( broadcast
+            ( util::ASIO::AnyConnectable {source.connection_information()}
+            , source.source()
+            , this->number_of_bytes_per_chunk
+            , std::move (targets)
+            ).get()
+        );
+
+      for (auto& destination : destinations)
+      {
+        ASSERT_THAT
+          ( destination.elements()
+          , ::testing::ElementsAreArray (source.elements())
+          );
+      }
+    }
+  }
+}
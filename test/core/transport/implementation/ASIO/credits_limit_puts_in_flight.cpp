@@ -0,0 +1,192 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <gtest/gtest.h>
+#include <mcs/core/memory/Size.hpp>
+#include <mcs/core/transport/implementation/ASIO/client/Credits.hpp>
+#include <mcs/testing/random/Test.hpp>
+#include <mcs/testing/random/value/integral.hpp>
+#include <tuple>
+#include <vector>
+
+namespace mcs::core::transport::implementation::ASIO::client
+{
+  namespace
+  {
+    struct MCSTransportAsioCredits : public testing::random::Test{};
+
+    using RandomSize = testing::random::value<std::size_t>;
+
+    auto make_credits (std::size_t bytes, std::size_t operations) -> Credits
+    {
+      return Credits
+        { Credits::Bytes {memory::make_size (bytes)}
+        , Credits::Operations {operations}
+        };
+    }
+  }
+
+  TEST_F (MCSTransportAsioCredits, unlimited_credits_start_immediately)
+  {
+    auto const credits {Credits{}};
+
+    ASSERT_FALSE (credits.are_limited());
+
+    auto const number_of_puts
+      {RandomSize {RandomSize::Min {0}, RandomSize::Max {1000}}()};
+    auto started {std::size_t {0}};
+
+    for (auto i {std::size_t {0}}; i != number_of_puts; ++i)
+    {
+      credits.acquire
+        (memory::make_size (1 << 30), [&]() noexcept { ++started; });
+    }
+
+    ASSERT_EQ (started, number_of_puts);
+  }
+
+  TEST_F (MCSTransportAsioCredits, zero_parameters_are_rejected)
+  {
+    ASSERT_THROW
+      ( std::ignore = make_credits (0, 1)
+      , Credits::Error::BytesMustBePositive
+      );
+    ASSERT_THROW
+      ( std::ignore = make_credits (1, 0)
+      , Credits::Error::OperationsMustBePositive
+      );
+  }
+
+  TEST_F (MCSTransportAsioCredits, operations_are_limited)
+  {
+    auto const operations
+      {RandomSize {RandomSize::Min {1}, RandomSize::Max {100}}()};
+    auto const credits {make_credits (1 << 30, operations)};
+
+    ASSERT_TRUE (credits.are_limited());
+
+    auto started {std::vector<std::size_t>{}};
+
+    for (auto i {std::size_t {0}}; i != 2 * operations; ++i)
+    {
+      credits.acquire
+        (memory::make_size (1), [&, i] { started.emplace_back (i); });
+    }
+
+    ASSERT_EQ (started.size(), operations);
+
+    for (auto i {std::size_t {0}}; i != operations; ++i)
+    {
+      credits.release (memory::make_size (1));
+
+      ASSERT_EQ (started.size(), operations + i + 1);
+    }
+
+    // in the order of the calls to acquire
+    for (auto i {std::size_t {0}}; i != started.size(); ++i)
+    {
+      ASSERT_EQ (started[i], i);
+    }
+  }
+
+  TEST_F (MCSTransportAsioCredits, bytes_are_limited)
+  {
+    auto const credits {make_credits (100, 1000)};
+    auto started {std::size_t {0}};
+
+    credits.acquire (memory::make_size (60), [&]() noexcept { ++started; });
+    credits.acquire (memory::make_size (40), [&]() noexcept { ++started; });
+    ASSERT_EQ (started, 2);
+
+    credits.acquire (memory::make_size (50), [&]() noexcept { ++started; });
+    credits.acquire (memory::make_size (1), [&]() noexcept { ++started; });
+    ASSERT_EQ (started, 2);
+
+    // the later put would fit but does not overtake the waiting put
+    credits.release (memory::make_size (40));
+    ASSERT_EQ (started, 2);
+
+    credits.release (memory::make_size (60));
+    ASSERT_EQ (started, 4);
+  }
+
+  TEST_F (MCSTransportAsioCredits, oversized_put_starts_when_idle)
+  {
+    auto const credits {make_credits (100, 1000)};
+    auto started {std::size_t {0}};
+
+    credits.acquire (memory::make_size (1000), [&]() noexcept { ++started; });
+    ASSERT_EQ (started, 1);
+
+    credits.acquire (memory::make_size (1), [&]() noexcept { ++started; });
+    ASSERT_EQ (started, 1);
+
+    credits.release (memory::make_size (1000));
+    ASSERT_EQ (started, 2);
+
+    credits.acquire (memory::make_size (1000), [&]() noexcept { ++started; });
+    ASSERT_EQ (started, 2);
+
+    credits.release (memory::make_size (1));
+    ASSERT_EQ (started, 3);
+  }
+
+  TEST_F (MCSTransportAsioCredits, start_may_release_its_credits)
+  {
+    // e.g. a put that fails to start
+    auto const credits {make_credits (100, 1)};
+    auto const number_of_puts
+      {RandomSize {RandomSize::Min {1}, RandomSize::Max {100}}()};
+    auto started {std::size_t {0}};
+
+    for (auto i {std::size_t {0}}; i != number_of_puts; ++i)
+    {
+      credits.acquire
+        ( memory::make_size (100)
+        , [&]
+          {
+            ++started;
+            credits.release (memory::make_size (100));
+          }
+        );
+    }
+
+    ASSERT_EQ (started, number_of_puts);
+
+    credits.acquire (memory::make_size (100), [&]() noexcept { ++started; });
+    credits.acquire (memory::make_size (100), [&]() noexcept { ++started; });
+    ASSERT_EQ (started, number_of_puts + 1);
+
+    credits.release (memory::make_size (100));
+    ASSERT_EQ (started, number_of_puts + 2);
+  }
+
+  TEST_F (MCSTransportAsioCredits, blocking_acquire_waits_for_release)
+  {
+    auto const credits {make_credits (100, 1)};
+
+    credits.acquire (memory::make_size (100));
+
+    auto acquired
+      { std::async
+          ( std::launch::async
+          , [&]
+            {
+              credits.acquire (memory::make_size (100));
+            }
+          )
+      };
+
+    ASSERT_EQ
+      ( acquired.wait_for (std::chrono::milliseconds (50))
+      , std::future_status::timeout
+      );
+
+    credits.release (memory::make_size (100));
+
+    acquired.get();
+  }
+}
@@ -0,0 +1,86 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include "Storages.hpp"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <mcs/core/memory/Size.hpp>
+#include <mcs/util/ASIO/Connectable.hpp>
+
+namespace mcs::core
+{
+  TYPED_TEST (MCSTransportAsio, memory_copy_works)
+  {
+    using SourceProvider = ProviderOf<TypeParam>;
+    using DestinationProvider = StoragesProvider
+      < Element
+      , typename TypeParam::Protocol
+      , typename TypeParam::Second
+      >;
+    using Client = StoragesClient
+      < Element
+      , typename TypeParam::Protocol
+      , typename TypeParam::Second
+      , DestinationProvider
+      >;
+
+    auto source
+      { SourceProvider
+        { this->random_element
+        , this->number_of_elements_per_chunk
+        , this->number_of_bytes_per_chunk
+        , "source"
+        }
+      };
+    auto destination
+      { DestinationProvider
+        { this->random_element
+        , this->number_of_elements_per_chunk
+        , this->number_of_bytes_per_chunk
+        , "destination"
+        }
+      };
+
+    auto const client
+      { Client
+        { destination.connection_information()
+        , this->number_of_bytes_per_chunk
+        , "copy"
+        }
+      };
+
+    // repeated copies reuse the cached connection between the providers
+    for (auto i {0}; i < 3; ++i)
+    {
+      ASSERT_EQ
+        ( this->number_of_bytes_per_chunk
+        , client.memory_copy
+            ( destination.source()
+            , util::ASIO::AnyConnectable {source.connection_information()}
+            , source.source()
+            ).get()
+        );
+
+      ASSERT_THAT
+        ( destination.elements()
+        , ::testing::ElementsAreArray (source.elements())
+        );
+    }
+
+    // a copy from the provider itself is executed locally, e.g. it
+    // does not wait for the single thread of the provider
+    ASSERT_EQ
+      ( this->number_of_bytes_per_chunk
+      , client.memory_copy
+          ( destination.source()
+          , util::ASIO::AnyConnectable {destination.connection_information()}
+          , destination.source()
+          ).get()
+      );
+
+    ASSERT_THAT
+      ( destination.elements()
+      , ::testing::ElementsAreArray (source.elements())
+      );
+  }
+}
@@ -0,0 +1,96 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include "Storages.hpp"
+#include <asio/ip/tcp.hpp>
+#include <asio/local/stream_protocol.hpp>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <mcs/core/memory/Size.hpp>
+#include <mcs/testing/RPC/ProtocolState.hpp>
+#include <mcs/util/ASIO/Connectable.hpp>
+#include <mcs/util/ASIO/is_protocol.hpp>
+#include <mcs/util/string.hpp>
+#include <type_traits>
+
+namespace mcs::core
+{
+  TYPED_TEST (MCSTransportAsio, memory_get_put_via_same_host_works)
+  {
+    using Protocol = typename TypeParam::Protocol;
+
+    if constexpr (!std::is_same_v<Protocol, asio::ip::tcp>)
+    {
+      GTEST_SKIP() << "same host endpoints require ip::tcp";
+    }
+    else
+    {
+      using Provider = ProviderOf<TypeParam>;
+
+      auto const same_host
+        {testing::RPC::ProtocolState<asio::local::stream_protocol> {"S"}};
+
+      auto provider
+        { Provider
+          { this->random_element
+          , this->number_of_elements_per_chunk
+          , this->number_of_bytes_per_chunk
+          , 0
+          , ProviderOptions {.same_host = same_host.local_endpoint()}
+          }
+        };
+
+      auto const connection_information {provider.connection_information()};
+
+      ASSERT_TRUE (connection_information.same_host.has_value());
+      ASSERT_EQ
+        ( connection_information.same_host->path
+        , util::string {same_host.local_endpoint().path()}
+        );
+
+      // the provider has been started with an unspecified address and
+      // publishes the hostname of the local host
+      util::ASIO::run
+        ( util::ASIO::AnyConnectable {connection_information}
+        , [&]<util::ASIO::is_protocol ClientProtocol>
+            (util::ASIO::Connectable<ClientProtocol> connectable)
+          {
+            ASSERT_TRUE
+              ((std::is_same_v<ClientProtocol, asio::local::stream_protocol>));
+
+            auto client
+              { StoragesClient< Element
+                              , ClientProtocol
+                              , typename TypeParam::Second
+                              , Provider
+                              >
+                { connectable
+                , this->number_of_bytes_per_chunk
+                , 0
+                }
+              };
+
+            ASSERT_EQ
+              ( this->number_of_bytes_per_chunk
+              , client.memory_get (provider.source()).get()
+              );
+            ASSERT_THAT
+              ( client.elements()
+              , ::testing::ElementsAreArray (provider.elements())
+              );
+
+            client.generate (this->random_element);
+
+            ASSERT_EQ
+              ( this->number_of_bytes_per_chunk
+              , client.memory_put (provider.source()).get()
+              );
+            ASSERT_THAT
+              ( client.elements()
+              , ::testing::ElementsAreArray (provider.elements())
+              );
+          }
+        );
+    }
+  }
+}
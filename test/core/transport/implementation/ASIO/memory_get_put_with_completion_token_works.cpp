@@ -0,0 +1,114 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include "Storages.hpp"
+#include <asio/awaitable.hpp>
+#include <asio/co_spawn.hpp>
+#include <asio/io_context.hpp>
+#include <asio/use_awaitable.hpp>
+#include <exception>
+#include <future>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <mcs/core/memory/Size.hpp>
+#include <mcs/core/transport/client/Concepts.hpp>
+#include <mcs/core/transport/implementation/ASIO/Client.hpp>
+#include <mcs/rpc/access_policy/Exclusive.hpp>
+#include <mcs/util/type/List.hpp>
+#include <optional>
+
+namespace mcs::core
+{
+  TYPED_TEST (MCSTransportAsio, memory_get_put_with_completion_token_works)
+  {
+    using Protocol = typename TypeParam::Protocol;
+    using Provider = ProviderOf<TypeParam>;
+    using Client = ClientOf<TypeParam>;
+
+    static_assert
+      ( transport::client::is_asynchronous_implementation
+          < transport::implementation::ASIO::Client
+              < Protocol
+              , rpc::access_policy::Exclusive
+              , util::type::List<typename TypeParam::Second::Storage>
+              >
+          >
+      );
+
+    auto provider
+      { Provider
+        { this->random_element
+        , this->number_of_elements_per_chunk
+        , this->number_of_bytes_per_chunk
+        , 0
+        }
+      };
+    auto client
+      { Client
+        { provider.connection_information()
+        , this->number_of_bytes_per_chunk
+        , 0
+        }
+      };
+
+    // completion handler
+    {
+      auto got {std::promise<memory::Size>{}};
+
+      client.memory_get
+        ( provider.source()
+        , [&] (std::exception_ptr error, memory::Size size)
+          {
+            if (error)
+            {
+              got.set_exception (error);
+            }
+            else
+            {
+              got.set_value (size);
+            }
+          }
+        );
+
+      ASSERT_EQ (this->number_of_bytes_per_chunk, got.get_future().get());
+      ASSERT_THAT
+        ( client.elements()
+        , ::testing::ElementsAreArray (provider.elements())
+        );
+    }
+
+    // coroutine
+    {
+      client.generate (this->random_element);
+
+      auto io_context {asio::io_context{}};
+      auto put {std::optional<memory::Size>{}};
+
+      asio::co_spawn
+        ( io_context
+        , [&]() -> asio::awaitable<void>
+          {
+            put = co_await client.memory_put
+              ( provider.source()
+              , asio::use_awaitable
+              );
+          }
+        , [] (std::exception_ptr error)
+          {
+            if (error)
+            {
+              std::rethrow_exception (error);
+            }
+          }
+        );
+
+      io_context.run();
+
+      ASSERT_EQ (put, this->number_of_bytes_per_chunk);
+      ASSERT_THAT
+        ( client.elements()
+        , ::testing::ElementsAreArray (provider.elements())
+        );
+    }
+  }
+}
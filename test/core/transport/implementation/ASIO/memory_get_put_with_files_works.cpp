@@ -0,0 +1,187 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include "Storages.hpp"
+#include <asio/io_context.hpp>
+#include <asio/ip/tcp.hpp>
+#include <asio/local/connect_pair.hpp>
+#include <asio/local/stream_protocol.hpp>
+#include <cstddef>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <mcs/core/Storages.hpp>
+#include <mcs/core/UniqueStorage.hpp>
+#include <mcs/core/memory/Offset.hpp>
+#include <mcs/core/memory/Range.hpp>
+#include <mcs/core/memory/Size.hpp>
+#include <mcs/core/storage/Parameter.hpp>
+#include <mcs/core/storage/UniqueSegment.hpp>
+#include <mcs/core/transport/Address.hpp>
+#include <mcs/core/transport/implementation/ASIO/command/Get.hpp>
+#include <mcs/core/transport/implementation/ASIO/command/Put.hpp>
+#include <mcs/core/transport/implementation/ASIO/provider/Handler.hpp>
+#include <mcs/core/transport/implementation/ASIO/provider/Peers.hpp>
+#include <mcs/core/transport/implementation/ASIO/provider/Scheduler.hpp>
+#include <mcs/core/transport/implementation/ASIO/provider/ZeroCopy.hpp>
+#include <mcs/testing/core/storage/implementation/Files.hpp>
+#include <mcs/testing/core/storage/implementation/Heap.hpp>
+#include <mcs/testing/core/storage/implementation/SHMEM.hpp>
+#include <mcs/testing/require_exception.hpp>
+#include <mcs/util/type/List.hpp>
+#include <memory>
+#include <tuple>
+
+namespace mcs::core
+{
+  namespace
+  {
+    // Providers with a Files storage send the payload of a Get with
+    // sendfile and receive the payload of a Put with splice.
+    //
+    using FilesStoragePairs = ::testing::Types
+      < ProtocolAndStorages<asio::ip::tcp, Impl::Files, Impl::Files>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Files, Impl::Heap>
+      , ProtocolAndStorages<asio::ip::tcp, Impl::Files, Impl::SHMEM>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Files, Impl::Files>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Files, Impl::Heap>
+      , ProtocolAndStorages<asio::local::stream_protocol, Impl::Files, Impl::SHMEM>
+      >;
+
+    template<typename ProtocolAndStorages>
+      struct MCSTransportAsioFiles
+        : public MCSTransportAsio<ProtocolAndStorages>
+    {};
+    TYPED_TEST_SUITE (MCSTransportAsioFiles, FilesStoragePairs);
+  }
+
+  TYPED_TEST (MCSTransportAsioFiles, memory_get_put_works)
+  {
+    using Provider = ProviderOf<TypeParam>;
+    using Client = ClientOf<TypeParam>;
+
+    auto provider
+      { Provider
+        { this->random_element
+        , this->number_of_elements_per_chunk
+        , this->number_of_bytes_per_chunk
+        , 0
+        }
+      };
+    auto client
+      { Client
+        { provider.connection_information()
+        , this->number_of_bytes_per_chunk
+        , 0
+        }
+      };
+
+    ASSERT_EQ ( this->number_of_bytes_per_chunk
+              , client.memory_get (provider.source()).get()
+              );
+    ASSERT_THAT
+      ( client.elements()
+      , ::testing::ElementsAreArray (provider.elements())
+      );
+
+    client.generate (this->random_element);
+
+    ASSERT_EQ ( this->number_of_bytes_per_chunk
+              , client.memory_put (provider.source()).get()
+              );
+    ASSERT_THAT
+      ( client.elements()
+      , ::testing::ElementsAreArray (provider.elements())
+      );
+  }
+
+  // A Get or a Put whose range is not inside of the segment file
+  // fails before any payload is transferred.
+  //
+  TEST (MCSTransportAsioFilesHandler, range_outside_of_the_file_throws)
+  {
+    using TestingStorage = Impl::Files;
+    using Storage = TestingStorage::Storage;
+    using Handler = transport::implementation::ASIO::provider::Handler<Storage>;
+    namespace command = transport::implementation::ASIO::command;
+    namespace provider = transport::implementation::ASIO::provider;
+
+    auto const file_size {memory::make_size (4u << 10u)};
+
+    auto storages {Storages<util::type::List<Storage>>{}};
+    auto const testing_storage {TestingStorage{}};
+    auto const unique_storage
+      { make_unique_storage<Storage>
+          (std::addressof (storages), testing_storage.parameter_create())
+      };
+    auto const unique_segment
+      { storage::make_unique_segment<Storage>
+          ( std::addressof (storages)
+          , unique_storage->id()
+          , file_size
+          , testing_storage.parameter_segment_create()
+          , testing_storage.parameter_segment_remove()
+          )
+      };
+    auto const address
+      { transport::Address
+        { unique_storage->id()
+        , storage::make_parameter
+            (testing_storage.parameter_chunk_description())
+        , unique_segment->id()
+        , memory::make_offset (0)
+        }
+      };
+
+    auto const handler
+      { Handler
+        { std::addressof (storages)
+        , provider::ZeroCopy{}
+        , provider::Scheduler{}
+        , provider::Peers<Storage>{}
+        }
+      };
+
+    auto io_context {asio::io_context{}};
+    auto socket {asio::local::stream_protocol::socket {io_context}};
+    auto peer {asio::local::stream_protocol::socket {io_context}};
+    asio::local::connect_pair (socket, peer);
+
+    // one byte more than the file contains
+    auto const size {file_size + memory::make_size (1u)};
+
+    auto const assert_range_is_not_inside_of_file
+      { testing::Assert<Handler::Error::RangeIsNotInsideOfFile>
+          { [&] (auto const& caught)
+            {
+              ASSERT_EQ
+                ( caught.range()
+                , memory::make_range (memory::make_offset (0), size)
+                );
+              ASSERT_EQ (caught.file_size(), file_size);
+            }
+          }
+      };
+
+    testing::require_exception
+      ( [&]
+        {
+          std::ignore = handler
+            ( command::Get
+                {address, size, std::unique_ptr<command::Get::Destination>{}}
+            , socket
+            );
+        }
+      , assert_range_is_not_inside_of_file
+      );
+    testing::require_exception
+      ( [&]
+        {
+          std::ignore = handler
+            ( command::Put {address, memory::size_cast<std::size_t> (size)}
+            , socket
+            );
+        }
+      , assert_range_is_not_inside_of_file
+      );
+  }
+}
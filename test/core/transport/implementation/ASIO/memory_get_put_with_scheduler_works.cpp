@@ -0,0 +1,90 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include "Storages.hpp"
+#include <future>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <list>
+#include <mcs/core/memory/Size.hpp>
+#include <mcs/core/transport/implementation/ASIO/Weight.hpp>
+#include <mcs/core/transport/implementation/ASIO/provider/Scheduler.hpp>
+
+namespace mcs::core
+{
+  TYPED_TEST (MCSTransportAsio, memory_get_put_with_scheduler_works)
+  {
+    using Provider = ProviderOf<TypeParam>;
+    using Client = ClientOf<TypeParam>;
+    using Scheduler = transport::implementation::ASIO::provider::Scheduler;
+    using Weight = transport::implementation::ASIO::Weight;
+
+    // a quantum that is not a divisor of the chunk size
+    auto const quantum
+      { RandomSize { RandomSize::Min {1 << 10}
+                   , RandomSize::Max {16 << 10}
+                   }() | 1u
+      };
+
+    auto provider
+      { Provider
+        { this->random_element
+        , this->number_of_elements_per_chunk
+        , this->number_of_bytes_per_chunk
+        , 0
+        , ProviderOptions
+          { .scheduler = Scheduler
+              {Scheduler::Quantum {memory::make_size (quantum)}}
+          }
+        }
+      };
+
+    auto clients {std::list<Client>{}};
+
+    for (auto weight : {1u, 3u})
+    {
+      clients.emplace_back
+        ( provider.connection_information()
+        , this->number_of_bytes_per_chunk
+        , weight
+        , ClientOptions {.weight = Weight {weight}}
+        );
+    }
+
+    {
+      auto gets {std::list<std::future<memory::Size>>{}};
+
+      for (auto& client : clients)
+      {
+        gets.emplace_back (client.memory_get (provider.source()));
+      }
+
+      for (auto& get : gets)
+      {
+        ASSERT_EQ (this->number_of_bytes_per_chunk, get.get());
+      }
+
+      for (auto& client : clients)
+      {
+        ASSERT_THAT
+          ( client.elements()
+          , ::testing::ElementsAreArray (provider.elements())
+          );
+      }
+    }
+
+    for (auto& client : clients)
+    {
+      client.generate (this->random_element);
+
+      ASSERT_EQ ( this->number_of_bytes_per_chunk
+                , client.memory_put (provider.source()).get()
+                );
+
+      ASSERT_THAT
+        ( client.elements()
+        , ::testing::ElementsAreArray (provider.elements())
+        );
+    }
+  }
+}
@@ -0,0 +1,87 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include "Storages.hpp"
+#include <future>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <list>
+#include <mcs/core/memory/Size.hpp>
+#include <mcs/core/transport/implementation/ASIO/client/Lanes.hpp>
+
+namespace mcs::core
+{
+  TYPED_TEST (MCSTransportAsio, memory_get_put_with_separated_lanes_works)
+  {
+    using Provider = ProviderOf<TypeParam>;
+    using Client = ClientOf<TypeParam>;
+    using Lanes = transport::implementation::ASIO::client::Lanes;
+
+    auto provider
+      { Provider
+        { this->random_element
+        , this->number_of_elements_per_chunk
+        , this->number_of_bytes_per_chunk
+        , 0
+        }
+      };
+
+    // all transfers of the first client use the bulk lane, all
+    // transfers of the second client use the control lane
+    auto clients {std::list<Client>{}};
+    clients.emplace_back
+      ( provider.connection_information()
+      , this->number_of_bytes_per_chunk
+      , "bulk"
+      , ClientOptions
+        {.lanes = Lanes {Lanes::Cutoff {this->number_of_bytes_per_chunk}}}
+      );
+    clients.emplace_back
+      ( provider.connection_information()
+      , this->number_of_bytes_per_chunk
+      , "control"
+      , ClientOptions
+        { .lanes = Lanes
+            { Lanes::Cutoff
+              {this->number_of_bytes_per_chunk + memory::make_size (1)}
+            }
+        }
+      );
+
+    {
+      auto gets {std::list<std::future<memory::Size>>{}};
+
+      for (auto& client : clients)
+      {
+        gets.emplace_back (client.memory_get (provider.source()));
+      }
+
+      for (auto& get : gets)
+      {
+        ASSERT_EQ (this->number_of_bytes_per_chunk, get.get());
+      }
+
+      for (auto& client : clients)
+      {
+        ASSERT_THAT
+          ( client.elements()
+          , ::testing::ElementsAreArray (provider.elements())
+          );
+      }
+    }
+
+    for (auto& client : clients)
+    {
+      client.generate (this->random_element);
+
+      ASSERT_EQ ( this->number_of_bytes_per_chunk
+                , client.memory_put (provider.source()).get()
+                );
+
+      ASSERT_THAT
+        ( client.elements()
+        , ::testing::ElementsAreArray (provider.elements())
+        );
+    }
+  }
+}
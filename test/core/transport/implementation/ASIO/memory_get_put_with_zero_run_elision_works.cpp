@@ -0,0 +1,87 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include "Storages.hpp"
+#include <cstddef>
+#include <fmt/format.h>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <list>
+#include <mcs/core/memory/Size.hpp>
+#include <mcs/core/transport/implementation/ASIO/client/Encoding.hpp>
+
+namespace mcs::core
+{
+  TYPED_TEST (MCSTransportAsio, memory_get_put_with_zero_run_elision_works)
+  {
+    using Provider = ProviderOf<TypeParam>;
+    using Client = ClientOf<TypeParam>;
+    using Encoding = transport::implementation::ASIO::client::Encoding;
+
+    // runs of zeros and of random elements, the runs are not aligned
+    // to the fragments
+    auto const run_length
+      { RandomSize { RandomSize::Min {1}
+                   , RandomSize::Max {8 << 10}
+                   }()
+      };
+    auto sparse_element
+      { [&, i = std::size_t {0}]() mutable
+        {
+          return ((i++ / run_length) % 2 == 0)
+            ? Element {0}
+            : this->random_element()
+            ;
+        }
+      };
+
+    auto provider
+      { Provider
+        { sparse_element
+        , this->number_of_elements_per_chunk
+        , this->number_of_bytes_per_chunk
+        , 0
+        }
+      };
+
+    // the first client encodes all transfers, the second client
+    // encodes no transfer
+    auto clients {std::list<Client>{}};
+    for ( auto threshold
+        : { this->number_of_bytes_per_chunk
+          , this->number_of_bytes_per_chunk + memory::make_size (1)
+          }
+        )
+    {
+      clients.emplace_back
+        ( provider.connection_information()
+        , this->number_of_bytes_per_chunk
+        , fmt::format ("{}", threshold)
+        , ClientOptions {.encoding = Encoding {Encoding::Threshold {threshold}}}
+        );
+    }
+
+    for (auto& client : clients)
+    {
+      ASSERT_EQ
+        ( this->number_of_bytes_per_chunk
+        , client.memory_get (provider.source()).get()
+        );
+      ASSERT_THAT
+        ( client.elements()
+        , ::testing::ElementsAreArray (provider.elements())
+        );
+
+      client.generate (sparse_element);
+
+      ASSERT_EQ
+        ( this->number_of_bytes_per_chunk
+        , client.memory_put (provider.source()).get()
+        );
+      ASSERT_THAT
+        ( client.elements()
+        , ::testing::ElementsAreArray (provider.elements())
+        );
+    }
+  }
+}
@@ -0,0 +1,61 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include "Storages.hpp"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <mcs/core/memory/Size.hpp>
+#include <mcs/core/transport/implementation/ASIO/provider/ZeroCopy.hpp>
+
+namespace mcs::core
+{
+  // The payload of a Get is sent with MSG_ZEROCOPY if it reaches the
+  // threshold and falls back to the copying write otherwise. Repeated
+  // gets on the same connection require the notifications of the
+  // previous sends to be reaped. Sockets other than ip::tcp and
+  // providers that send files always fall back.
+  //
+  TYPED_TEST (MCSTransportAsio, memory_get_with_zero_copy_works)
+  {
+    using Provider = ProviderOf<TypeParam>;
+    using Client = ClientOf<TypeParam>;
+    using ZeroCopy = transport::implementation::ASIO::provider::ZeroCopy;
+
+    for ( auto const threshold
+        : { this->number_of_bytes_per_chunk
+          , this->number_of_bytes_per_chunk + memory::make_size (1)
+          }
+        )
+    {
+      auto provider
+        { Provider
+          { this->random_element
+          , this->number_of_elements_per_chunk
+          , this->number_of_bytes_per_chunk
+          , 0
+          , ProviderOptions
+              {.zero_copy = ZeroCopy {ZeroCopy::Threshold {threshold}}}
+          }
+        };
+      auto client
+        { Client
+          { provider.connection_information()
+          , this->number_of_bytes_per_chunk
+          , 0
+          }
+        };
+
+      for (auto get {0}; get != 4; ++get)
+      {
+        ASSERT_EQ ( this->number_of_bytes_per_chunk
+                  , client.memory_get (provider.source()).get()
+                  );
+
+        ASSERT_THAT
+          ( client.elements()
+          , ::testing::ElementsAreArray (provider.elements())
+          );
+      }
+    }
+  }
+}
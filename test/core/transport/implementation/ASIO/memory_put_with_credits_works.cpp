@@ -0,0 +1,132 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include "Storages.hpp"
+#include <cstddef>
+#include <exception>
+#include <fmt/format.h>
+#include <future>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <list>
+#include <mcs/core/memory/Size.hpp>
+#include <mcs/core/transport/implementation/ASIO/client/Credits.hpp>
+#include <vector>
+
+namespace mcs::core
+{
+  TYPED_TEST (MCSTransportAsio, memory_put_with_credits_works)
+  {
+    using Provider = ProviderOf<TypeParam>;
+    using Client = ClientOf<TypeParam>;
+    using Credits = transport::implementation::ASIO::client::Credits;
+
+    auto provider
+      { Provider
+        { this->random_element
+        , this->number_of_elements_per_chunk
+        , this->number_of_bytes_per_chunk
+        , 0
+        }
+      };
+
+    // the clients use the exclusive access policy and a window of a
+    // single operation, the window of the first client is smaller
+    // than a single put
+    auto clients {std::list<Client>{}};
+    for ( auto bytes
+        : { this->number_of_bytes_per_chunk - memory::make_size (1)
+          , this->number_of_bytes_per_chunk + this->number_of_bytes_per_chunk
+          }
+        )
+    {
+      clients.emplace_back
+        ( provider.connection_information()
+        , this->number_of_bytes_per_chunk
+        , fmt::format ("{}", bytes)
+        , ClientOptions
+          {.credits = Credits {Credits::Bytes {bytes}, Credits::Operations {1}}}
+        );
+    }
+
+    auto const number_of_puts
+      {RandomSize {RandomSize::Min {2}, RandomSize::Max {8}}()};
+
+    for (auto& client : clients)
+    {
+      client.generate (this->random_element);
+
+      auto puts {std::vector<std::future<memory::Size>>{}};
+      auto callbacks {std::list<std::promise<memory::Size>>{}};
+
+      for (auto i {std::size_t {0}}; i != number_of_puts; ++i)
+      {
+        puts.emplace_back (client.memory_put (provider.source()));
+
+        client.memory_put
+          ( provider.source()
+          , [&put = callbacks.emplace_back()]
+              ( std::exception_ptr error
+              , memory::Size size
+              )
+            {
+              if (error)
+              {
+                put.set_exception (error);
+              }
+              else
+              {
+                put.set_value (size);
+              }
+            }
+          );
+      }
+
+      for (auto& callback : callbacks)
+      {
+        puts.emplace_back (callback.get_future());
+      }
+
+      for (auto& put : puts)
+      {
+        ASSERT_EQ (this->number_of_bytes_per_chunk, put.get());
+      }
+
+      ASSERT_THAT
+        ( client.elements()
+        , ::testing::ElementsAreArray (provider.elements())
+        );
+
+      // a put that fails to start reports the error and releases its
+      // credits exactly once, later puts still start
+      auto failed {std::promise<memory::Size>{}};
+
+      client.transport_client().memory_put
+        ( provider.source()
+        , client.local_address()
+        , this->number_of_bytes_per_chunk + this->number_of_bytes_per_chunk
+        , [&] (std::exception_ptr error, memory::Size size)
+          {
+            if (error)
+            {
+              failed.set_exception (error);
+            }
+            else
+            {
+              failed.set_value (size);
+            }
+          }
+        );
+
+      ASSERT_ANY_THROW (failed.get_future().get());
+
+      for (auto i {std::size_t {0}}; i != number_of_puts; ++i)
+      {
+        ASSERT_EQ
+          ( this->number_of_bytes_per_chunk
+          , client.memory_put (provider.source()).get()
+          );
+      }
+    }
+  }
+}
@@ -0,0 +1,256 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <gtest/gtest.h>
+#include <mcs/core/memory/Size.hpp>
+#include <mcs/core/transport/implementation/ASIO/Weight.hpp>
+#include <mcs/core/transport/implementation/ASIO/provider/Scheduler.hpp>
+#include <mcs/testing/random/Test.hpp>
+#include <mcs/testing/random/value/integral.hpp>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace mcs::core::transport::implementation::ASIO::provider
+{
+  namespace
+  {
+    struct MCSTransportAsioScheduler : public testing::random::Test{};
+
+    using RandomSize = testing::random::value<std::size_t>;
+  }
+
+  TEST_F (MCSTransportAsioScheduler, disabled_scheduler_transfers_in_one_go)
+  {
+    auto connection {Scheduler{}.connect()};
+
+    auto const size
+      {RandomSize {RandomSize::Min {0}, RandomSize::Max {1 << 20}}()};
+    auto calls {std::size_t {0}};
+
+    ASSERT_EQ
+      ( connection.transfer
+          ( size
+          , [&] (std::size_t offset, std::size_t count)
+            {
+              ++calls;
+              EXPECT_EQ (offset, 0);
+              EXPECT_EQ (count, size);
+              return count;
+            }
+          )
+      , size
+      );
+    ASSERT_EQ (calls, 1);
+  }
+
+  TEST_F (MCSTransportAsioScheduler, zero_parameters_are_rejected)
+  {
+    using Quantum = Scheduler::Quantum;
+    using Concurrency = Scheduler::Concurrency;
+
+    ASSERT_THROW
+      ( std::ignore = Scheduler {Quantum {memory::make_size (0)}}
+      , Scheduler::Error::QuantumMustBePositive
+      );
+    ASSERT_THROW
+      ( std::ignore = (Scheduler {Quantum {memory::make_size (1)}, Concurrency {0}})
+      , Scheduler::Error::ConcurrencyMustBePositive
+      );
+    ASSERT_THROW
+      ( (Scheduler {Quantum {memory::make_size (1)}}.connect().weight (Weight {0}))
+      , Scheduler::Error::WeightMustBePositive
+      );
+  }
+
+  TEST_F (MCSTransportAsioScheduler, turns_are_limited_by_weight_and_quantum)
+  {
+    auto const quantum
+      {RandomSize {RandomSize::Min {1}, RandomSize::Max {1 << 10}}()};
+    auto const size
+      {RandomSize {RandomSize::Min {1 << 12}, RandomSize::Max {1 << 16}}()};
+
+    auto scheduler
+      {Scheduler {Scheduler::Quantum {memory::make_size (quantum)}}};
+
+    auto in_flight {std::atomic<int> {0}};
+
+    auto const transfer
+      { [&] (std::uint32_t weight)
+        {
+          auto connection {scheduler.connect()};
+          connection.weight (Weight {weight});
+
+          auto next_offset {std::size_t {0}};
+
+          return connection.transfer
+            ( size
+            , [&] (std::size_t offset, std::size_t count)
+              {
+                // concurrency 1: turns never overlap
+                EXPECT_EQ (in_flight.fetch_add (1), 0);
+
+                EXPECT_EQ (offset, next_offset);
+                EXPECT_LE (count, weight * quantum);
+                EXPECT_GT (count, 0);
+                next_offset += count;
+
+                EXPECT_EQ (in_flight.fetch_sub (1), 1);
+
+                return count;
+              }
+            );
+        }
+      };
+
+    auto transfers {std::vector<std::future<std::size_t>>{}};
+
+    for (auto weight : {1u, 2u, 3u})
+    {
+      transfers.emplace_back
+        (std::async (std::launch::async, transfer, weight));
+    }
+
+    for (auto& transferred : transfers)
+    {
+      ASSERT_EQ (transferred.get(), size);
+    }
+  }
+
+  TEST_F (MCSTransportAsioScheduler, observed_shares_follow_the_weights)
+  {
+    auto const quantum {std::size_t {64}};
+    auto const weights {std::vector<std::uint32_t> {1u, 2u, 3u}};
+    auto const size {std::size_t {1000} * quantum};
+
+    auto scheduler
+      {Scheduler {Scheduler::Quantum {memory::make_size (quantum)}}};
+
+    struct Slice
+    {
+      std::size_t connection;
+      std::size_t count;
+    };
+    auto guard {std::mutex{}};
+    auto slices {std::vector<Slice>{}};
+
+    auto const transfer
+      { [&] (std::size_t connection_index)
+        {
+          auto connection {scheduler.connect()};
+          connection.weight (Weight {weights.at (connection_index)});
+
+          return connection.transfer
+            ( size
+            , [&] (std::size_t, std::size_t count)
+              {
+                {
+                  auto const lock {std::lock_guard {guard}};
+
+                  slices.push_back (Slice {connection_index, count});
+                }
+
+                // gives the other connections the time to queue up
+                std::this_thread::sleep_for (std::chrono::microseconds {100});
+
+                return count;
+              }
+            );
+        }
+      };
+
+    auto transfers {std::vector<std::future<std::size_t>>{}};
+
+    for (auto c {std::size_t {0}}; c < weights.size(); ++c)
+    {
+      transfers.emplace_back (std::async (std::launch::async, transfer, c));
+    }
+
+    for (auto& transferred : transfers)
+    {
+      ASSERT_EQ (transferred.get(), size);
+    }
+
+    // the window in which all connections compete: from the first
+    // turn of the last connection to start up to the last turn of the
+    // first connection to finish
+    auto seen {std::vector<bool> (weights.size(), false)};
+    auto transferred {std::vector<std::size_t> (weights.size(), 0)};
+    auto begin {slices.size()};
+    auto end {slices.size()};
+
+    for ( auto s {std::size_t {0}}
+        ; s < slices.size() && end == slices.size()
+        ; ++s
+        )
+    {
+      seen.at (slices[s].connection) = true;
+      transferred.at (slices[s].connection) += slices[s].count;
+
+      if (begin == slices.size() && std::ranges::all_of (seen, std::identity{}))
+      {
+        begin = s;
+      }
+
+      if (transferred.at (slices[s].connection) == size)
+      {
+        end = s;
+      }
+    }
+
+    ASSERT_LT (begin, end);
+
+    auto share {std::vector<std::size_t> (weights.size(), 0)};
+    auto total {std::size_t {0}};
+
+    for (auto s {begin}; s < end; ++s)
+    {
+      share.at (slices[s].connection) += slices[s].count;
+      total += slices[s].count;
+    }
+
+    auto const sum_of_weights
+      { std::accumulate
+          (std::begin (weights), std::end (weights), std::size_t {0})
+      };
+    auto const round {sum_of_weights * quantum};
+
+    // many rounds in the window, the boundaries cut at most one round
+    ASSERT_GT (total, 100 * round);
+
+    for (auto c {std::size_t {0}}; c < weights.size(); ++c)
+    {
+      auto const expected {total * weights[c] / sum_of_weights};
+
+      EXPECT_LE (share[c], expected + 2 * round);
+      EXPECT_GE (share[c] + 2 * round, expected);
+    }
+  }
+
+  TEST_F (MCSTransportAsioScheduler, short_transfer_stops_the_transfer)
+  {
+    auto scheduler
+      {Scheduler {Scheduler::Quantum {memory::make_size (16)}}};
+    auto connection {scheduler.connect()};
+
+    ASSERT_EQ
+      ( connection.transfer
+          ( 100
+          , [&] (std::size_t offset, std::size_t count)
+            {
+              return offset < 32 ? count : count / 2;
+            }
+          )
+      , 16 + 16 + 8
+      );
+  }
+}
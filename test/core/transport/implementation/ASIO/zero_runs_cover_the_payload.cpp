@@ -0,0 +1,130 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <mcs/core/transport/implementation/ASIO/ZeroRuns.hpp>
+#include <mcs/testing/random/Test.hpp>
+#include <mcs/testing/random/value/bool.hpp>
+#include <mcs/testing/random/value/integral.hpp>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace mcs::core::transport::implementation::ASIO
+{
+  namespace
+  {
+    struct MCSTransportAsioZeroRuns : public testing::random::Test{};
+
+    using RandomSize = testing::random::value<std::size_t>;
+    using RandomByte = testing::random::value<std::uint8_t>;
+  }
+
+  TEST_F (MCSTransportAsioZeroRuns, runs_alternate_and_cover_the_payload)
+  {
+    auto const size
+      {RandomSize {RandomSize::Min {0}, RandomSize::Max {1 << 20}}()};
+    auto random_byte {RandomByte {RandomByte::Min {1}}};
+    auto random_bool {testing::random::value<bool>{}};
+
+    // fragments are either zero or have one byte that is not zero
+    auto bytes {std::vector<std::byte> (size, std::byte {0})};
+    auto expected_zero {std::vector<bool>{}};
+
+    for ( auto offset {std::size_t {0}}
+        ; offset < size
+        ; offset += ZeroRuns::fragment_size
+        )
+    {
+      auto const zero {random_bool()};
+      expected_zero.push_back (zero);
+
+      if (!zero)
+      {
+        auto const count {std::min (ZeroRuns::fragment_size, size - offset)};
+        auto const position
+          { RandomSize {RandomSize::Min {0}, RandomSize::Max {count - 1}}()
+          };
+
+        bytes[offset + position] = std::byte {random_byte()};
+      }
+    }
+
+    auto const zero_runs {ZeroRuns {bytes}};
+
+    ASSERT_EQ (zero_runs.bitmap().size(), ZeroRuns::bitmap_size (size));
+
+    auto next_offset {std::size_t {0}};
+    auto previous_zero {std::optional<bool>{}};
+
+    ASSERT_EQ
+      ( zero_runs.for_each_run
+          ( [&] (std::size_t offset, std::size_t count, bool is_zero)
+            {
+              EXPECT_EQ (offset, next_offset);
+              EXPECT_GT (count, 0);
+              EXPECT_NE (previous_zero, is_zero);
+
+              for ( auto fragment {offset / ZeroRuns::fragment_size}
+                  ; fragment * ZeroRuns::fragment_size < offset + count
+                  ; ++fragment
+                  )
+              {
+                EXPECT_EQ (expected_zero.at (fragment), is_zero);
+              }
+
+              next_offset += count;
+              previous_zero = is_zero;
+
+              return count;
+            }
+          )
+      , size
+      );
+    ASSERT_EQ (next_offset, size);
+
+    // the bitmap restores the same runs
+    auto const restored {ZeroRuns {size, zero_runs.bitmap()}};
+
+    ASSERT_EQ (restored.bitmap(), zero_runs.bitmap());
+  }
+
+  TEST_F (MCSTransportAsioZeroRuns, short_run_stops_the_iteration)
+  {
+    auto bytes {std::vector<std::byte> (4 * ZeroRuns::fragment_size)};
+    bytes[2 * ZeroRuns::fragment_size] = std::byte {1};
+
+    auto calls {0};
+
+    ASSERT_EQ
+      ( ZeroRuns {bytes}.for_each_run
+          ( [&] (std::size_t, std::size_t count, bool)
+            {
+              ++calls;
+
+              return count / 2;
+            }
+          )
+      , ZeroRuns::fragment_size
+      );
+    ASSERT_EQ (calls, 1);
+  }
+
+  TEST_F (MCSTransportAsioZeroRuns, bitmap_of_wrong_size_is_rejected)
+  {
+    auto const size
+      {RandomSize {RandomSize::Min {1}, RandomSize::Max {1 << 20}}()};
+
+    ASSERT_THROW
+      ( std::ignore = (ZeroRuns { size
+                                , std::vector<std::uint8_t>
+                                    (ZeroRuns::bitmap_size (size) + 1)
+                                }
+                      )
+      , ZeroRuns::Error::BitmapSizeMismatch
+      );
+  }
+}
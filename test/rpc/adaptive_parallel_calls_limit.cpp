@@ -0,0 +1,188 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <mcs/rpc/multi_client/ParallelCallsLimit.hpp>
+#include <mcs/rpc/multi_client/detail/AdaptiveLimit.hpp>
+#include <mcs/rpc/multi_client/detail/CallID.hpp>
+#include <mcs/testing/random/Test.hpp>
+#include <mcs/testing/random/value/integral.hpp>
+#include <mcs/testing/read_of_fmt_is_identity.hpp>
+#include <stdexcept>
+#include <tuple>
+#include <variant>
+
+namespace mcs::rpc::multi_client
+{
+  namespace
+  {
+    struct RPCAdaptiveParallelCallsLimitR : public testing::random::Test
+    {
+      using RandomUInt = testing::random::value<unsigned int>;
+      using Clock = detail::AdaptiveLimit::Clock;
+
+      // Starts and completes `n` calls that all take `latency`, one
+      // after the other.
+      //
+      auto calls
+        ( detail::AdaptiveLimit& limit
+        , unsigned int n
+        , Clock::duration latency
+        ) -> void
+      {
+        for (auto i {0u}; i < n; ++i, ++call_id)
+        {
+          limit.call_started (call_id, now);
+          now += latency;
+          limit.call_completed (call_id, now);
+        }
+      }
+
+      detail::CallID call_id;
+      Clock::time_point now {Clock::now()};
+    };
+  }
+
+  TEST_F (RPCAdaptiveParallelCallsLimitR, zero_initial_is_rejected)
+  {
+    ASSERT_THROW
+      ( std::ignore = ParallelCalls::Adaptive (0u, RandomUInt{}())
+      , ParallelCalls::Adaptive::Error::MustBePositive
+      );
+  }
+
+  TEST_F ( RPCAdaptiveParallelCallsLimitR
+         , initial_larger_than_maximum_is_rejected
+         )
+  {
+    auto const maximum {RandomUInt {1u, 1000u}()};
+
+    ASSERT_THROW
+      ( std::ignore = ParallelCalls::Adaptive
+          (RandomUInt {maximum + 1u, 2000u}(), maximum)
+      , ParallelCalls::Adaptive::Error::InitialExceedsMaximum
+      );
+  }
+
+  TEST_F (RPCAdaptiveParallelCallsLimitR, read_of_fmt_is_identity)
+  {
+    auto const maximum {RandomUInt {1u, 1000u}()};
+    auto const initial {RandomUInt {1u, maximum}()};
+
+    testing::read_of_fmt_is_identity
+      ( ParallelCallsLimit {ParallelCalls::Adaptive {initial, maximum}}
+      , [&] (ParallelCallsLimit const& limit)
+        {
+          auto const* adaptive
+            {std::get_if<ParallelCalls::Adaptive> (&limit)};
+
+          return adaptive != nullptr
+            && adaptive->initial == initial
+            && adaptive->maximum == maximum
+            ;
+        }
+      );
+  }
+
+  TEST_F (RPCAdaptiveParallelCallsLimitR, starts_with_initial)
+  {
+    auto const maximum {RandomUInt {1u, 1000u}()};
+    auto const initial {RandomUInt {1u, maximum}()};
+
+    auto const limit
+      {detail::AdaptiveLimit {ParallelCalls::Adaptive {initial, maximum}}};
+
+    ASSERT_EQ (limit.value(), initial);
+  }
+
+  TEST_F (RPCAdaptiveParallelCallsLimitR, steady_latency_grows_up_to_maximum)
+  {
+    auto const maximum {RandomUInt {2u, 50u}()};
+
+    auto limit {detail::AdaptiveLimit {ParallelCalls::Adaptive {1u, maximum}}};
+
+    // one round of calls increases the limit by about one
+    while (limit.value() < maximum)
+    {
+      auto const value {limit.value()};
+
+      calls (limit, 2u * value, std::chrono::milliseconds {1});
+
+      ASSERT_GT (limit.value(), value);
+    }
+
+    ASSERT_EQ (limit.value(), maximum);
+
+    calls (limit, RandomUInt {1u, 1000u}(), std::chrono::milliseconds {1});
+
+    ASSERT_EQ (limit.value(), maximum);
+  }
+
+  TEST_F (RPCAdaptiveParallelCallsLimitR, growing_latency_halves_the_limit)
+  {
+    auto const maximum {RandomUInt {2u, 1000u}()};
+
+    auto limit
+      {detail::AdaptiveLimit {ParallelCalls::Adaptive {maximum, maximum}}};
+
+    calls (limit, 1u, std::chrono::milliseconds {1});
+
+    ASSERT_EQ (limit.value(), maximum);
+
+    calls
+      ( limit
+      , 1u
+      , std::chrono::milliseconds {1}
+        * (detail::AdaptiveLimit::Tolerance + 1)
+      );
+
+    ASSERT_EQ (limit.value(), maximum / 2u);
+  }
+
+  TEST_F (RPCAdaptiveParallelCallsLimitR, the_limit_is_at_least_one)
+  {
+    auto limit {detail::AdaptiveLimit {ParallelCalls::Adaptive {1u, 1u}}};
+
+    calls (limit, 1u, std::chrono::milliseconds {1});
+    calls (limit, RandomUInt {1u, 100u}(), std::chrono::seconds {1});
+
+    ASSERT_EQ (limit.value(), 1u);
+  }
+
+  TEST_F ( RPCAdaptiveParallelCallsLimitR
+         , calls_started_before_a_decrease_do_not_decrease_again
+         )
+  {
+    auto const maximum {RandomUInt {8u, 1000u}()};
+
+    auto limit
+      {detail::AdaptiveLimit {ParallelCalls::Adaptive {maximum, maximum}}};
+
+    calls (limit, 1u, std::chrono::milliseconds {1});
+
+    // start some calls in parallel that are all slow
+    auto const n {RandomUInt {2u, 8u}()};
+    auto const first {call_id};
+    for (auto i {0u}; i < n; ++i, ++call_id)
+    {
+      limit.call_started (call_id, now);
+    }
+
+    now += std::chrono::seconds {1};
+
+    for (auto id {first}; id != call_id; ++id)
+    {
+      limit.call_completed (id, now);
+    }
+
+    ASSERT_EQ (limit.value(), maximum / 2u);
+  }
+
+  TEST_F (RPCAdaptiveParallelCallsLimitR, unknown_call_is_rejected)
+  {
+    auto limit {detail::AdaptiveLimit {ParallelCalls::Adaptive {1u, 1u}}};
+
+    ASSERT_THROW (limit.call_completed (call_id, now), std::logic_error);
+  }
+}
@@ -0,0 +1,314 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <asio/ip/tcp.hpp>
+#include <asio/local/stream_protocol.hpp>
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <gtest/gtest.h>
+#include <limits>
+#include <mcs/rpc/Admission.hpp>
+#include <mcs/rpc/BlockingPool.hpp>
+#include <mcs/rpc/Client.hpp>
+#include <mcs/rpc/Dispatcher.hpp>
+#include <mcs/rpc/Provider.hpp>
+#include <mcs/rpc/ScopedRunningIOContext.hpp>
+#include <mcs/rpc/provider/Options.hpp>
+#include <mcs/testing/random/Test.hpp>
+#include <mcs/testing/random/value/integral.hpp>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  struct State
+  {
+    std::shared_future<void> release;
+    std::atomic<std::size_t> running {0};
+    std::atomic<std::size_t> max_running {0};
+  };
+
+  struct Handler
+  {
+    struct Wait
+    {
+      static constexpr auto is_blocking {true};
+
+      int value;
+      using Response = int;
+    };
+    struct Echo { int value; using Response = int; };
+
+    State* state;
+
+    auto operator() (Wait wait) const -> Wait::Response
+    {
+      auto const running {++state->running};
+      auto max_running {state->max_running.load()};
+
+      while (  max_running < running
+            && !state->max_running.compare_exchange_weak (max_running, running)
+            )
+      {}
+
+      state->release.wait();
+
+      --state->running;
+
+      return wait.value;
+    }
+    auto operator() (Echo echo) const noexcept -> Echo::Response
+    {
+      return echo.value;
+    }
+  };
+
+  using Dispatcher = mcs::rpc::Dispatcher<Handler, Handler::Wait, Handler::Echo>;
+
+  auto make_admission
+    ( std::size_t max_requests_per_connection
+    , std::size_t max_requests
+    ) -> mcs::rpc::Admission
+  {
+    return mcs::rpc::Admission
+      { mcs::rpc::Admission::MaxRequestsPerConnection
+          {max_requests_per_connection}
+      , mcs::rpc::Admission::MaxRequests {max_requests}
+      };
+  }
+
+  auto const unlimited {std::numeric_limits<std::size_t>::max()};
+
+  // more threads than admitted requests: the limit is the admission
+  auto const blocking_pool
+    { mcs::rpc::BlockingPool {mcs::rpc::BlockingPool::NumberOfThreads {8}}
+    };
+
+  struct RPCAdmissionR : public mcs::testing::random::Test{};
+
+  using Protocols = ::testing::Types
+    < asio::ip::tcp
+    , asio::local::stream_protocol
+    >;
+  template<class> struct RPCAdmissionT
+    : public mcs::testing::random::Test{};
+  TYPED_TEST_SUITE (RPCAdmissionT, Protocols);
+}
+
+TEST_F (RPCAdmissionR, zero_limits_are_rejected)
+{
+  ASSERT_THROW
+    ( std::ignore = make_admission (0, unlimited)
+    , mcs::rpc::Admission::Error::MaxRequestsPerConnectionMustBePositive
+    );
+  ASSERT_THROW
+    ( std::ignore = make_admission (unlimited, 0)
+    , mcs::rpc::Admission::Error::MaxRequestsMustBePositive
+    );
+}
+
+TEST_F (RPCAdmissionR, default_does_not_limit)
+{
+  auto const admission {mcs::rpc::Admission{}};
+
+  ASSERT_EQ (admission.max_requests_per_connection(), unlimited);
+  ASSERT_EQ (admission.max_requests(), unlimited);
+}
+
+TYPED_TEST ( RPCAdmissionT
+           , many_requests_are_answered_with_small_limits
+           )
+{
+  using Protocol = TypeParam;
+
+  auto io_context_server
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {2u}}
+    };
+  auto io_context_client
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {1u}}
+    };
+
+  auto state {State{}};
+
+  auto const provider
+    { mcs::rpc::make_provider<Protocol, Dispatcher>
+        ( {}
+        , mcs::rpc::provider::Options
+          { .blocking_pool = blocking_pool
+          , .admission = make_admission
+              ( mcs::testing::random::value<std::size_t> {1, 8}()
+              , mcs::testing::random::value<std::size_t> {1, 8}()
+              )
+          }
+        , io_context_server
+        , &state
+        )
+    };
+
+  auto const client
+    { mcs::rpc::make_client<Protocol, Dispatcher, mcs::rpc::access_policy::Concurrent>
+        ( io_context_client
+        , provider.local_endpoint()
+        )
+    };
+
+  auto responses {std::vector<std::future<int>>{}};
+
+  for (auto i {0}; i < 10000; ++i)
+  {
+    responses.emplace_back (client.get_future (Handler::Echo {i}));
+  }
+
+  for (auto i {0}; auto& response : responses)
+  {
+    ASSERT_EQ (response.get(), i++);
+  }
+}
+
+TYPED_TEST ( RPCAdmissionT
+           , the_number_of_requests_per_connection_is_bounded
+           )
+{
+  using Protocol = TypeParam;
+
+  auto io_context_server
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {2u}}
+    };
+  auto io_context_client
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {1u}}
+    };
+
+  auto const max_requests_per_connection
+    {mcs::testing::random::value<std::size_t> {1, 3}()};
+
+  auto release {std::promise<void>{}};
+  auto state {State{}};
+  state.release = release.get_future().share();
+
+  auto const provider
+    { mcs::rpc::make_provider<Protocol, Dispatcher>
+        ( {}
+        , mcs::rpc::provider::Options
+          { .blocking_pool = blocking_pool
+          , .admission = make_admission (max_requests_per_connection, unlimited)
+          }
+        , io_context_server
+        , &state
+        )
+    };
+
+  auto const client
+    { mcs::rpc::make_client<Protocol, Dispatcher, mcs::rpc::access_policy::Concurrent>
+        ( io_context_client
+        , provider.local_endpoint()
+        )
+    };
+
+  // \note one thread per wait: a client reads one response at a
+  // time, all waits are sent to the same connection
+  auto waits {std::vector<std::future<int>>{}};
+
+  for (auto i {0}; std::cmp_less (i, 2 * max_requests_per_connection + 1); ++i)
+  {
+    waits.emplace_back
+      ( std::async
+        ( std::launch::async
+        , [&client, i]
+          {
+            return client (Handler::Wait {i});
+          }
+        )
+      );
+  }
+
+  while (state.running.load() < max_requests_per_connection)
+  {
+    std::this_thread::yield();
+  }
+
+  release.set_value();
+
+  for (auto i {0}; auto& wait : waits)
+  {
+    ASSERT_EQ (wait.get(), i++);
+  }
+
+  ASSERT_EQ (state.max_running.load(), max_requests_per_connection);
+}
+
+TYPED_TEST ( RPCAdmissionT
+           , the_number_of_requests_of_all_connections_is_bounded
+           )
+{
+  using Protocol = TypeParam;
+
+  auto io_context_server
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {2u}}
+    };
+  auto io_context_client
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {1u}}
+    };
+
+  auto const max_requests
+    {mcs::testing::random::value<std::size_t> {1, 3}()};
+
+  auto release {std::promise<void>{}};
+  auto state {State{}};
+  state.release = release.get_future().share();
+
+  auto const provider
+    { mcs::rpc::make_provider<Protocol, Dispatcher>
+        ( {}
+        , mcs::rpc::provider::Options
+          { .blocking_pool = blocking_pool
+          , .admission = make_admission (unlimited, max_requests)
+          }
+        , io_context_server
+        , &state
+        )
+    };
+
+  auto const make_client
+    { [&]
+      {
+        return mcs::rpc::make_client
+          <Protocol, Dispatcher, mcs::rpc::access_policy::Exclusive>
+            ( io_context_client
+            , provider.local_endpoint()
+            );
+      }
+    };
+
+  // \note one client per wait: a client reads one response at a time
+  auto clients {std::vector<decltype (make_client())>{}};
+  auto waits {std::vector<std::future<int>>{}};
+
+  for (auto i {0}; std::cmp_less (i, 2 * max_requests + 1); ++i)
+  {
+    clients.emplace_back (make_client());
+    waits.emplace_back (clients.back().get_future (Handler::Wait {i}));
+  }
+
+  while (state.running.load() < max_requests)
+  {
+    std::this_thread::yield();
+  }
+
+  release.set_value();
+
+  for (auto i {0}; auto& wait : waits)
+  {
+    ASSERT_EQ (wait.get(), i++);
+  }
+
+  ASSERT_EQ (state.max_running.load(), max_requests);
+}
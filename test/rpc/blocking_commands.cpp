@@ -0,0 +1,215 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <algorithm>
+#include <asio/ip/tcp.hpp>
+#include <asio/local/stream_protocol.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <gtest/gtest.h>
+#include <mcs/rpc/BlockingPool.hpp>
+#include <mcs/rpc/Client.hpp>
+#include <mcs/rpc/Concepts.hpp>
+#include <mcs/rpc/Dispatcher.hpp>
+#include <mcs/rpc/Provider.hpp>
+#include <mcs/rpc/ScopedRunningIOContext.hpp>
+#include <mcs/rpc/provider/Options.hpp>
+#include <mcs/testing/random/Test.hpp>
+#include <mcs/testing/random/value/integral.hpp>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  struct State
+  {
+    std::shared_future<void> release;
+    std::atomic<std::size_t> running {0};
+    std::atomic<std::size_t> max_running {0};
+  };
+
+  struct Handler
+  {
+    struct Wait
+    {
+      static constexpr auto is_blocking {true};
+
+      int value;
+      using Response = int;
+    };
+    struct Ping { int value; using Response = int; };
+
+    State* state;
+
+    auto operator() (Wait wait) const -> Wait::Response
+    {
+      auto const running {++state->running};
+      auto max_running {state->max_running.load()};
+
+      while (  max_running < running
+            && !state->max_running.compare_exchange_weak (max_running, running)
+            )
+      {}
+
+      state->release.wait();
+
+      --state->running;
+
+      return wait.value;
+    }
+    auto operator() (Ping ping) const noexcept -> Ping::Response
+    {
+      return ping.value;
+    }
+  };
+
+  static_assert (mcs::rpc::command_is_blocking<Handler::Wait>);
+  static_assert (!mcs::rpc::command_is_blocking<Handler::Ping>);
+
+  using Dispatcher = mcs::rpc::Dispatcher<Handler, Handler::Wait, Handler::Ping>;
+
+  struct RPCBlockingCommandsR : public mcs::testing::random::Test{};
+
+  using Protocols = ::testing::Types
+    < asio::ip::tcp
+    , asio::local::stream_protocol
+    >;
+  template<class> struct RPCBlockingCommandsT
+    : public mcs::testing::random::Test{};
+  TYPED_TEST_SUITE (RPCBlockingCommandsT, Protocols);
+}
+
+TEST_F (RPCBlockingCommandsR, zero_threads_are_rejected)
+{
+  ASSERT_THROW
+    ( std::ignore = mcs::rpc::BlockingPool
+        {mcs::rpc::BlockingPool::NumberOfThreads {0}}
+    , mcs::rpc::BlockingPool::Error::NumberOfThreadsMustBePositive
+    );
+}
+
+TYPED_TEST ( RPCBlockingCommandsT
+           , a_blocking_command_does_not_stall_the_io_thread
+           )
+{
+  using Protocol = TypeParam;
+
+  auto io_context_server
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {1u}}
+    };
+  auto io_context_client
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {1u}}
+    };
+
+  auto release {std::promise<void>{}};
+  auto state {State{}};
+  state.release = release.get_future().share();
+
+  auto const provider
+    { mcs::rpc::make_provider<Protocol, Dispatcher>
+        ({}, io_context_server, &state)
+    };
+
+  auto const client
+    { mcs::rpc::make_client<Protocol, Dispatcher, mcs::rpc::access_policy::Concurrent>
+        ( io_context_client
+        , provider.local_endpoint()
+        )
+    };
+
+  auto const value {mcs::testing::random::value<int>{}()};
+  auto wait {client.get_future (Handler::Wait {value})};
+
+  // the only io thread of the provider is not blocked by wait
+  for (auto i {0}; i < 10; ++i)
+  {
+    ASSERT_EQ (client (Handler::Ping {i}), i);
+  }
+
+  ASSERT_EQ
+    ( wait.wait_for (std::chrono::milliseconds {10})
+    , std::future_status::timeout
+    );
+
+  release.set_value();
+
+  ASSERT_EQ (wait.get(), value);
+}
+
+TYPED_TEST ( RPCBlockingCommandsT
+           , the_number_of_running_blocking_commands_is_bounded
+           )
+{
+  using Protocol = TypeParam;
+
+  auto io_context_server
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {2u}}
+    };
+  auto io_context_client
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {1u}}
+    };
+
+  auto const number_of_threads
+    {mcs::testing::random::value<std::size_t> {1, 4}()};
+
+  auto release {std::promise<void>{}};
+  auto state {State{}};
+  state.release = release.get_future().share();
+
+  auto const provider
+    { mcs::rpc::make_provider<Protocol, Dispatcher>
+        ( {}
+        , mcs::rpc::provider::Options
+          { .blocking_pool = mcs::rpc::BlockingPool
+              {mcs::rpc::BlockingPool::NumberOfThreads {number_of_threads}}
+          }
+        , io_context_server
+        , &state
+        )
+    };
+
+  auto const make_client
+    { [&]
+      {
+        return mcs::rpc::make_client
+          <Protocol, Dispatcher, mcs::rpc::access_policy::Exclusive>
+            ( io_context_client
+            , provider.local_endpoint()
+            );
+      }
+    };
+
+  // \note one client per wait: a client reads one response at a time
+  auto clients {std::vector<decltype (make_client())>{}};
+  auto waits {std::vector<std::future<int>>{}};
+
+  for (auto i {0}; std::cmp_less (i, 2 * number_of_threads + 1); ++i)
+  {
+    clients.emplace_back (make_client());
+    waits.emplace_back (clients.back().get_future (Handler::Wait {i}));
+  }
+
+  while (state.running.load() < number_of_threads)
+  {
+    std::this_thread::yield();
+  }
+
+  ASSERT_EQ (make_client() (Handler::Ping {42}), 42);
+
+  release.set_value();
+
+  for (auto i {0}; auto& wait : waits)
+  {
+    ASSERT_EQ (wait.get(), i++);
+  }
+
+  ASSERT_EQ (state.max_running.load(), number_of_threads);
+}
@@ -0,0 +1,182 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <asio/ip/tcp.hpp>
+#include <asio/local/stream_protocol.hpp>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <mcs/rpc/Client.hpp>
+#include <mcs/rpc/Dispatcher.hpp>
+#include <mcs/rpc/Provider.hpp>
+#include <mcs/rpc/ScopedRunningIOContext.hpp>
+#include <mcs/rpc/detail/BufferPool.hpp>
+#include <mcs/serialization/STD/vector.hpp>
+#include <mcs/testing/random/Test.hpp>
+#include <mcs/testing/random/value/integral.hpp>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  using BufferPool = mcs::rpc::detail::BufferPool;
+
+  struct RPCBufferPoolR : public mcs::testing::random::Test{};
+}
+
+TEST_F (RPCBufferPoolR, buffers_have_the_requested_size)
+{
+  auto const pool {std::make_shared<BufferPool>()};
+  auto const size {mcs::testing::random::value<std::size_t> {0, 2 << 20}()};
+
+  ASSERT_EQ (pool->acquire (size).size(), size);
+}
+
+TEST_F (RPCBufferPoolR, released_buffers_are_reused)
+{
+  auto const pool {std::make_shared<BufferPool>()};
+  auto const size {mcs::testing::random::value<std::size_t> {0, 1 << 20}()};
+
+  std::ignore = pool->acquire (size);
+
+  ASSERT_EQ (pool->statistics().allocated, 1);
+  ASSERT_EQ (pool->statistics().returned, 1);
+  ASSERT_GT (pool->statistics().pooled_bytes, 0);
+
+  auto const buffer {pool->acquire (size)};
+
+  ASSERT_EQ (pool->statistics().allocated, 1);
+  ASSERT_EQ (pool->statistics().reused, 1);
+  ASSERT_EQ (pool->statistics().pooled_bytes, 0);
+}
+
+TEST_F (RPCBufferPoolR, buffers_of_the_same_size_class_are_reused)
+{
+  auto const pool {std::make_shared<BufferPool>()};
+
+  std::ignore = pool->acquire (1000);
+  std::ignore = pool->acquire (513);
+  std::ignore = pool->acquire (1024);
+
+  ASSERT_EQ (pool->statistics().allocated, 1);
+  ASSERT_EQ (pool->statistics().reused, 2);
+}
+
+TEST_F (RPCBufferPoolR, oversized_buffers_are_not_pooled)
+{
+  auto const pool {std::make_shared<BufferPool>()};
+
+  std::ignore = pool->acquire (2 << 20);
+
+  ASSERT_EQ (pool->statistics().oversized, 1);
+  ASSERT_EQ (pool->statistics().returned, 0);
+  ASSERT_EQ (pool->statistics().pooled_bytes, 0);
+}
+
+TEST_F (RPCBufferPoolR, the_pool_holds_a_bounded_number_of_bytes)
+{
+  auto const pool {std::make_shared<BufferPool>()};
+  auto const size {std::size_t {1} << 20};
+  auto const number_of_buffers
+    {BufferPool::MaximumPooledBytes / size + 2};
+
+  {
+    auto buffers {std::vector<mcs::rpc::detail::Buffer>{}};
+
+    for (auto i {std::size_t {0}}; i < number_of_buffers; ++i)
+    {
+      buffers.emplace_back (pool->acquire (size));
+    }
+  }
+
+  ASSERT_EQ (pool->statistics().pooled_bytes, BufferPool::MaximumPooledBytes);
+  ASSERT_EQ (pool->statistics().dropped, 2);
+}
+
+TEST_F (RPCBufferPoolR, buffers_keep_the_pool_alive)
+{
+  auto pool {std::make_shared<BufferPool>()};
+  auto const counters {std::make_shared<BufferPool::Counters>()};
+  pool = std::make_shared<BufferPool> (counters);
+
+  auto buffer {pool->acquire (100)};
+  pool.reset();
+  buffer = mcs::rpc::detail::Buffer{};
+
+  ASSERT_EQ (counters->statistics().returned, 1);
+}
+
+namespace
+{
+  struct Handler
+  {
+    struct Values { std::size_t size; using Response = std::vector<int>; };
+
+    auto operator() (Values values) const -> Values::Response
+    {
+      return std::vector<int> (values.size);
+    }
+  };
+
+  using Protocols = ::testing::Types
+    < asio::ip::tcp
+    , asio::local::stream_protocol
+    >;
+  template<class> struct RPCBufferPoolT : public mcs::testing::random::Test{};
+  TYPED_TEST_SUITE (RPCBufferPoolT, Protocols);
+}
+
+TYPED_TEST ( RPCBufferPoolT
+           , steady_traffic_reuses_the_buffers_of_client_and_provider
+           )
+{
+  using Protocol = TypeParam;
+  using Dispatcher = mcs::rpc::Dispatcher<Handler, Handler::Values>;
+
+  auto io_context_server
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {1u}}
+    };
+  auto io_context_client
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {1u}}
+    };
+
+  auto const provider
+    { mcs::rpc::make_provider<Protocol, Dispatcher> ({}, io_context_server)
+    };
+
+  auto const client
+    { mcs::rpc::make_client<Protocol, Dispatcher, mcs::rpc::access_policy::Exclusive>
+        ( io_context_client
+        , provider.local_endpoint()
+        )
+    };
+
+  auto const number_of_calls
+    {mcs::testing::random::value<std::size_t> {2, 100}()};
+
+  for (auto i {std::size_t {0}}; i < number_of_calls; ++i)
+  {
+    auto const size {mcs::testing::random::value<std::size_t> {0, 1000}()};
+
+    ASSERT_EQ (client (Handler::Values {size}), std::vector<int> (size));
+  }
+
+  auto const client_statistics {client.buffer_pool_statistics()};
+
+  ASSERT_EQ
+    ( client_statistics.reused + client_statistics.allocated
+    , number_of_calls
+    );
+  ASSERT_LE (client_statistics.allocated, BufferPool::NumberOfSizeClasses);
+
+  auto const provider_statistics {provider.buffer_pool_statistics()};
+
+  ASSERT_EQ
+    ( provider_statistics.reused + provider_statistics.allocated
+    , number_of_calls
+    );
+  ASSERT_LE (provider_statistics.allocated, BufferPool::NumberOfSizeClasses);
+}
@@ -4,7 +4,9 @@
 #include <asio/awaitable.hpp>
 #include <asio/ip/tcp.hpp>
 #include <compare>
+#include <exception>
 #include <functional>
+#include <future>
 #include <gtest/gtest.h>
 #include <mcs/rpc/Client.hpp>
 #include <mcs/rpc/Concepts.hpp>
@@ -13,7 +15,9 @@
 #include <mcs/rpc/ScopedRunningIOContext.hpp>
 #include <mcs/testing/random/Test.hpp>
 #include <mcs/testing/random/value/integral.hpp>
+#include <memory>
 #include <type_traits>
+#include <utility>
 
 namespace
 {
@@ -139,6 +143,22 @@ namespace
     }
   };
 
+  struct SetPromise
+  {
+    std::promise<Command::Response>* promise;
+
+    auto operator() (std::exception_ptr error) const -> void
+    {
+      promise->set_exception (error);
+    }
+    auto operator() (Command::Response response) const -> void
+    {
+      promise->set_value (std::move (response));
+    }
+  };
+  static_assert
+    (mcs::rpc::is_completion_handler_for_command<SetPromise, Command>);
+
   template<typename H, mcs::rpc::is_protocol P, mcs::rpc::is_access_policy AP>
     struct HandlerAndProtocolAndAccessPolicy
   {
@@ -239,4 +259,15 @@ TYPED_TEST ( RPCClientT
   ASSERT_EQ (client.get_future (Command {value}).get(), expected);
   ASSERT_EQ (client.get_future (std::cref (command)).get(), expected);
   ASSERT_EQ (client.template async_call<Command> (value).get(), expected);
+
+  {
+    auto response {std::promise<Command::Response>{}};
+    client (Command {value}, SetPromise {std::addressof (response)});
+    ASSERT_EQ (response.get_future().get(), expected);
+  }
+  {
+    auto response {std::promise<Command::Response>{}};
+    client (std::cref (command), SetPromise {std::addressof (response)});
+    ASSERT_EQ (response.get_future().get(), expected);
+  }
 }
@@ -63,11 +63,10 @@ TYPED_TEST ( RPCClientT
         {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {1u}}
     };
 
+  using Provided = mcs::rpc::Dispatcher<Handler, A, B, C>;
+
   auto const provider
-    { mcs::rpc::make_provider< Protocol
-                        , mcs::rpc::Dispatcher<Handler, A, B, C>
-                        > ({}, io_context_server)
-    };
+    {mcs::rpc::make_provider<Protocol, Provided> ({}, io_context_server)};
 
 #define MCS_TEST_RPC_MAKE_CLIENT(_dispatcher...)                     \
   mcs::rpc::make_client<Protocol, _dispatcher, AccessPolicy>         \
@@ -91,7 +90,7 @@ TYPED_TEST ( RPCClientT
       , mcs::testing::assert_type_and_what<std::runtime_error>       \
           ( fmt::format                                              \
               ( "Not a prefix. Server: {}, Client: {}"               \
-              , mcs::rpc::detail::make_handshake_data<A, B, C>()     \
+              , Provided::handshake_data()                           \
               , mcs::rpc::detail::make_handshake_data<_types>()      \
               )                                                      \
           )                                                          \
@@ -0,0 +1,149 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <gtest/gtest.h>
+#include <mcs/rpc/detail/Buffer.hpp>
+#include <mcs/rpc/detail/Completion.hpp>
+#include <mcs/rpc/error/Completion.hpp>
+#include <mcs/testing/random/Test.hpp>
+#include <mcs/testing/random/value/integral.hpp>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+  struct RPCCompletionR : public mcs::testing::random::Test{};
+
+  // Counts the calls and remembers the last value.
+  //
+  template<std::size_t Padding>
+    struct Handler
+  {
+    std::shared_ptr<int> values {std::make_shared<int> (0)};
+    std::shared_ptr<int> errors {std::make_shared<int> (0)};
+    std::shared_ptr<int> value {std::make_shared<int> (0)};
+    std::array<std::byte, Padding> padding{};
+
+    auto operator() (std::exception_ptr) noexcept -> void
+    {
+      ++*errors;
+    }
+    auto operator() (int x) noexcept -> void
+    {
+      ++*values;
+      *value = x;
+    }
+  };
+
+  using Small = Handler<0>;
+  using Large = Handler<2 * mcs::rpc::detail::Completion::InPlaceSize>;
+
+  static_assert (std::is_nothrow_move_constructible_v<mcs::rpc::detail::Completion>);
+  static_assert (!std::is_copy_constructible_v<mcs::rpc::detail::Completion>);
+}
+
+TEST_F (RPCCompletionR, promise_is_set_with_the_error)
+{
+  auto promise {std::promise<int>{}};
+  auto future {promise.get_future()};
+
+  auto completion {mcs::rpc::detail::Completion {std::move (promise)}};
+
+  completion (std::make_exception_ptr (std::runtime_error {"error"}));
+
+  ASSERT_THROW (future.get(), mcs::rpc::error::Completion);
+}
+
+TEST_F (RPCCompletionR, small_and_large_handlers_are_called_exactly_once)
+{
+  auto const check
+    { [] (auto handler)
+      {
+        auto completion
+          { mcs::rpc::detail::Completion
+              {std::in_place_type<int>, handler}
+          };
+
+        // moves relocate the handler, including the in place storage
+        auto moved {std::move (completion)};
+        auto assigned
+          { mcs::rpc::detail::Completion
+              {std::in_place_type<int>, decltype (handler){}}
+          };
+        assigned = std::move (moved);
+
+        assigned (std::make_exception_ptr (std::runtime_error {"error"}));
+
+        ASSERT_EQ (*handler.errors, 1);
+        ASSERT_EQ (*handler.values, 0);
+      }
+    };
+
+  check (Small{});
+  check (Large{});
+}
+
+TEST_F (RPCCompletionR, move_only_handlers_are_supported)
+{
+  auto called {std::make_unique<int> (0)};
+
+  struct MoveOnly
+  {
+    std::unique_ptr<int> called;
+
+    auto operator() (std::exception_ptr) noexcept -> void { ++*called; }
+    auto operator() (int) noexcept -> void { ++*called; }
+  };
+
+  auto const counter {called.get()};
+
+  auto completion
+    { mcs::rpc::detail::Completion
+        {std::in_place_type<int>, MoveOnly {std::move (called)}}
+    };
+
+  completion (std::make_exception_ptr (std::runtime_error {"error"}));
+
+  ASSERT_EQ (*counter, 1);
+}
+
+TEST_F (RPCCompletionR, calling_a_moved_from_completion_throws)
+{
+  auto completion
+    {mcs::rpc::detail::Completion {std::in_place_type<int>, Small{}}};
+  auto const moved {std::move (completion)};
+
+  ASSERT_THROW
+    ( completion (std::make_exception_ptr (std::runtime_error {"error"}))
+    , std::logic_error
+    );
+}
+
+TEST_F (RPCCompletionR, before_is_called_before_the_completion)
+{
+  auto const handler {Small{}};
+  auto befores {0};
+
+  auto completion
+    { mcs::rpc::detail::Completion
+      { mcs::rpc::detail::Completion {std::in_place_type<int>, handler}
+      , [&, errors = handler.errors]
+        {
+          ASSERT_EQ (*errors, 0);
+          ++befores;
+        }
+      }
+    };
+  auto moved {std::move (completion)};
+
+  moved (std::make_exception_ptr (std::runtime_error {"error"}));
+
+  ASSERT_EQ (befores, 1);
+  ASSERT_EQ (*handler.errors, 1);
+}
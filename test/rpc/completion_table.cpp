@@ -0,0 +1,247 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <gtest/gtest.h>
+#include <mcs/rpc/detail/CallID.hpp>
+#include <mcs/rpc/detail/CompletionTable.hpp>
+#include <mcs/rpc/detail/Completion.hpp>
+#include <mcs/testing/random/Test.hpp>
+#include <mcs/testing/random/random_device.hpp>
+#include <mcs/testing/random/value/integral.hpp>
+#include <mcs/util/overloaded.hpp>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace mcs::rpc::detail
+{
+  namespace
+  {
+    struct MCSRPCCompletionTableR : public testing::random::Test
+    {
+      using RandomSize = testing::random::value<std::size_t>;
+
+      // Each completion records its id.
+      //
+      auto completion (std::size_t id) -> Completion
+      {
+        return Completion
+          { std::in_place_type<void>
+          , util::overloaded
+            ( [this, id] (std::exception_ptr)
+              {
+                completed.emplace_back (id);
+              }
+            , [this, id]
+              {
+                completed.emplace_back (id);
+              }
+            )
+          };
+      }
+
+      std::vector<std::size_t> completed;
+      std::exception_ptr error
+        {std::make_exception_ptr (std::runtime_error {"error"})};
+    };
+
+    auto call_id (std::size_t id) -> CallID
+    {
+      auto call_id {CallID{}};
+
+      for (auto i {std::size_t {0}}; i != id; ++i)
+      {
+        ++call_id;
+      }
+
+      return call_id;
+    }
+  }
+
+  TEST_F (MCSRPCCompletionTableR, capacity_is_a_power_of_two)
+  {
+    auto const initial_capacity
+      {RandomSize {RandomSize::Min {1}, RandomSize::Max {1000}}()};
+
+    auto completions
+      {CompletionTable {CompletionTable::InitialCapacity {initial_capacity}}};
+
+    ASSERT_EQ (completions.capacity(), 0);
+
+    completions.insert (CallID{}, completion (0));
+
+    ASSERT_GE (completions.capacity(), initial_capacity);
+    ASSERT_LT (completions.capacity(), 2 * initial_capacity);
+    ASSERT_EQ (completions.capacity() & (completions.capacity() - 1), 0);
+  }
+
+  TEST_F (MCSRPCCompletionTableR, completions_are_taken_in_any_order)
+  {
+    auto completions
+      {CompletionTable {CompletionTable::InitialCapacity {4}}};
+
+    auto const number_of_calls
+      {RandomSize {RandomSize::Min {1}, RandomSize::Max {1000}}()};
+    auto ids {std::vector<std::size_t>{}};
+
+    for (auto id {std::size_t {0}}; id != number_of_calls; ++id)
+    {
+      completions.insert (call_id (id), completion (id));
+      ids.emplace_back (id);
+    }
+
+    std::ranges::shuffle (ids, testing::random::random_device());
+
+
+    for (auto id : ids)
+    {
+      completions.take (call_id (id)) (error);
+    }
+
+    ASSERT_EQ (completed.size(), number_of_calls);
+
+    ASSERT_EQ (completed, ids);
+  }
+
+  TEST_F (MCSRPCCompletionTableR, slots_are_reused_when_calls_complete_in_time)
+  {
+    auto completions
+      {CompletionTable {CompletionTable::InitialCapacity {8}}};
+
+    for (auto id {std::size_t {0}}; id != 1000; ++id)
+    {
+      completions.insert (call_id (id), completion (id));
+      completions.take (call_id (id)) (error);
+    }
+
+    ASSERT_EQ (completions.capacity(), 8);
+  }
+
+  TEST_F (MCSRPCCompletionTableR, outstanding_calls_make_the_table_grow)
+  {
+    auto completions
+      {CompletionTable {CompletionTable::InitialCapacity {8}}};
+
+    // call 0 is outstanding all the time
+    completions.insert (call_id (0), completion (0));
+
+    for (auto id {std::size_t {1}}; id != 1000; ++id)
+    {
+      completions.insert (call_id (id), completion (id));
+      completions.take (call_id (id)) (error);
+    }
+
+    ASSERT_EQ (completions.capacity(), 8 + 16);
+
+    completions.take (call_id (0)) (error);
+
+    ASSERT_EQ (completed.size(), 1000);
+    ASSERT_EQ (completed.back(), 0);
+  }
+
+  TEST_F (MCSRPCCompletionTableR, unknown_call_ids_are_rejected)
+  {
+    auto completions {CompletionTable{}};
+
+    ASSERT_THROW
+      (std::ignore = completions.take (call_id (0)), std::logic_error);
+
+    completions.insert (call_id (0), completion (0));
+    completions.take (call_id (0)) (error);
+
+    ASSERT_THROW
+      (std::ignore = completions.take (call_id (0)), std::logic_error);
+    ASSERT_THROW
+      (std::ignore = completions.take (call_id (1)), std::logic_error);
+  }
+
+  TEST_F (MCSRPCCompletionTableR, error_completes_all_outstanding_calls)
+  {
+    auto completions
+      {CompletionTable {CompletionTable::InitialCapacity {2}}};
+
+    auto const number_of_calls
+      {RandomSize {RandomSize::Min {1}, RandomSize::Max {100}}()};
+
+    for (auto id {std::size_t {0}}; id != number_of_calls; ++id)
+    {
+      completions.insert (call_id (id), completion (id));
+    }
+
+    completions.take (call_id (0)) (error);
+    completions.error (error);
+
+    ASSERT_EQ (completed.size(), number_of_calls);
+
+    std::ranges::sort (completed);
+
+    for (auto id {std::size_t {0}}; id != number_of_calls; ++id)
+    {
+      ASSERT_EQ (completed[id], id);
+    }
+
+    ASSERT_THROW
+      (std::ignore = completions.take (call_id (1)), std::logic_error);
+  }
+
+  TEST_F (MCSRPCCompletionTableR, concurrent_takes_find_their_completions)
+  {
+    auto completions
+      {CompletionTable {CompletionTable::InitialCapacity {4}}};
+
+    auto const number_of_threads
+      {RandomSize {RandomSize::Min {2}, RandomSize::Max {8}}()};
+    auto const calls_per_thread {std::size_t {1000}};
+
+    auto taken
+      {std::vector<std::atomic<std::size_t>> (number_of_threads)};
+    auto takers {std::vector<std::future<void>>{}};
+    auto inserted
+      {std::vector<std::promise<void>> (number_of_threads * calls_per_thread)};
+
+    for (auto t {std::size_t {0}}; t != number_of_threads; ++t)
+    {
+      takers.emplace_back
+        ( std::async
+          ( std::launch::async
+          , [&, t]
+            {
+              for (auto i {std::size_t {0}}; i != calls_per_thread; ++i)
+              {
+                auto const id {i * number_of_threads + t};
+
+                inserted[id].get_future().wait();
+
+                std::ignore = completions.take (call_id (id));
+                ++taken[t];
+              }
+            }
+          )
+        );
+    }
+
+    for (auto id {std::size_t {0}}; id != inserted.size(); ++id)
+    {
+      completions.insert
+        ( call_id (id)
+        , completion (id)
+        );
+      inserted[id].set_value();
+    }
+
+    for (auto& taker : takers)
+    {
+      taker.get();
+    }
+
+    for (auto const& t : taken)
+    {
+      ASSERT_EQ (t.load(), calls_per_thread);
+    }
+  }
+}
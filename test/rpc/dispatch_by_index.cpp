@@ -0,0 +1,98 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <asio/ip/tcp.hpp>
+#include <asio/local/stream_protocol.hpp>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <mcs/rpc/Client.hpp>
+#include <mcs/rpc/Dispatcher.hpp>
+#include <mcs/rpc/Provider.hpp>
+#include <mcs/rpc/ScopedRunningIOContext.hpp>
+#include <mcs/rpc/detail/CommandIndex.hpp>
+#include <mcs/testing/random/Test.hpp>
+#include <mcs/testing/random/value/integral.hpp>
+#include <utility>
+
+namespace
+{
+  template<std::size_t I>
+    struct Command
+  {
+    int value;
+    using Response = int;
+  };
+
+  struct Handler
+  {
+    template<std::size_t I>
+      auto operator() (Command<I> command) const noexcept
+        -> typename Command<I>::Response
+    {
+      return static_cast<int> (I) * 1000 + command.value;
+    }
+  };
+
+  using Dispatcher = mcs::rpc::Dispatcher
+    < Handler
+    , Command<0>, Command<1>, Command<2>, Command<3>
+    , Command<4>, Command<5>, Command<6>, Command<7>
+    , Command<8>, Command<9>, Command<10>, Command<11>
+    >;
+
+  static_assert
+    ( mcs::rpc::detail::command_index<Command<0>, Command<0>, Command<1>>()
+      .value() == 0
+    );
+  static_assert
+    ( mcs::rpc::detail::command_index<Command<1>, Command<0>, Command<1>>()
+      .value() == 1
+    );
+
+  using Protocols = ::testing::Types
+    < asio::ip::tcp
+    , asio::local::stream_protocol
+    >;
+  template<class> struct RPCDispatchT : public mcs::testing::random::Test{};
+  TYPED_TEST_SUITE (RPCDispatchT, Protocols);
+}
+
+TYPED_TEST (RPCDispatchT, every_command_reaches_its_own_handler)
+{
+  using Protocol = TypeParam;
+
+  auto io_context_server
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {1u}}
+    };
+  auto io_context_client
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {1u}}
+    };
+
+  auto const provider
+    { mcs::rpc::make_provider<Protocol, Dispatcher> ({}, io_context_server)
+    };
+
+  auto const client
+    { mcs::rpc::make_client<Protocol, Dispatcher, mcs::rpc::access_policy::Exclusive>
+        ( io_context_client
+        , provider.local_endpoint()
+        )
+    };
+
+  auto random_value {mcs::testing::random::value<int> {0, 999}};
+
+  [&]<std::size_t... Is> (std::index_sequence<Is...>)
+  {
+    ( [&]
+      {
+        auto const value {random_value()};
+
+        ASSERT_EQ
+          (client (Command<Is> {value}), static_cast<int> (Is) * 1000 + value);
+      }()
+    , ...
+    );
+  } (std::make_index_sequence<12>{});
+}
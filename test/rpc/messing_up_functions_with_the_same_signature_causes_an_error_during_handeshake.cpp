@@ -68,7 +68,7 @@ TYPED_TEST ( RPCClientT
     , mcs::testing::assert_type_and_what<std::runtime_error>
         ( fmt::format
            ( "Not a prefix. Server: {}, Client: {}"
-           , mcs::rpc::detail::make_handshake_data<Handler::A, Handler::B>()
+           , DispatcherAB::handshake_data()
            , mcs::rpc::detail::make_handshake_data<Handler::B, Handler::A>()
            )
         )
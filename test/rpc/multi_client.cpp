@@ -728,6 +728,21 @@ namespace mcs::rpc
       {this->template make_clients<access_policy::Sequential> (servers)};
     auto clients {util::make_unordered_tagged_range (0u, clients_storage)};
     auto const parallel_calls_limit {RandomUInt {1u, 10u}()};
+    auto const limit
+      { [&]() -> multi_client::ParallelCallsLimit
+        {
+          if (RandomUInt {0u, 1u}() == 0u)
+          {
+            return multi_client::ParallelCalls::AtMost {parallel_calls_limit};
+          }
+
+          // the adaptive limit never exceeds its maximum
+          return multi_client::ParallelCalls::Adaptive
+            { RandomUInt {1u, parallel_calls_limit}()
+            , parallel_calls_limit
+            };
+        }()
+      };
 
     auto guard {std::mutex{}};
     auto max_number_of_parallel_calls {0u};
@@ -805,7 +820,7 @@ namespace mcs::rpc
       , [&] (auto tag) { return clients.at (tag); }
       , collect
       , clients.tags()
-      , multi_client::ParallelCalls::AtMost {parallel_calls_limit}
+      , limit
       );
 
     auto const N {servers.size()};
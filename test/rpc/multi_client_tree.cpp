@@ -0,0 +1,280 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <algorithm>
+#include <asio/ip/tcp.hpp>
+#include <asio/local/stream_protocol.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <fmt/format.h>
+#include <functional>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <list>
+#include <mcs/rpc/Client.hpp>
+#include <mcs/rpc/Concepts.hpp>
+#include <mcs/rpc/Provider.hpp>
+#include <mcs/rpc/ScopedRunningIOContext.hpp>
+#include <mcs/rpc/access_policy/Sequential.hpp>
+#include <mcs/rpc/multi_client/tree/Collective.hpp>
+#include <mcs/rpc/multi_client/tree/Node.hpp>
+#include <mcs/rpc/multi_client/tree/call.hpp>
+#include <mcs/rpc/multi_client/tree/detail/split.hpp>
+#include <mcs/testing/random/Test.hpp>
+#include <mcs/testing/random/value/integral.hpp>
+#include <mcs/util/ASIO/Connectable.hpp>
+#include <mcs/util/not_null.hpp>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+namespace mcs::rpc::multi_client::tree
+{
+  namespace
+  {
+    using RandomUInt = testing::random::value<unsigned int>;
+
+    struct Size
+    {
+      unsigned int factor;
+
+      using Response = std::uint64_t;
+    };
+
+    struct Handler
+    {
+      static constexpr auto Fails {std::uint64_t {42}};
+
+      explicit Handler (std::uint64_t value) noexcept
+        : _value {value}
+      {}
+
+      auto operator() (Size size) const -> Size::Response
+      {
+        if (_value == Fails)
+        {
+          throw std::runtime_error {"Fails"};
+        }
+
+        return size.factor * _value;
+      }
+
+    private:
+      std::uint64_t _value;
+    };
+
+    using SizeDispatcher = tree::Dispatcher<Handler, std::plus<>, Size>;
+    using Connections = SizeDispatcher::HandlerType::Connections;
+
+    template<is_protocol Protocol>
+      struct Server
+    {
+      Server
+        ( ScopedRunningIOContext& io_context
+        , Connections& connections
+        , std::uint64_t value
+        )
+          : _provider
+            { make_provider<Protocol, SizeDispatcher>
+                ( {}
+                , io_context
+                , util::not_null {std::addressof (connections)}
+                , value
+                )
+            }
+      {}
+
+      [[nodiscard]] auto connectable() const -> util::ASIO::AnyConnectable
+      {
+        return util::ASIO::make_connectable (_provider.local_endpoint());
+      }
+
+      [[nodiscard]] auto local_endpoint() const
+      {
+        return _provider.local_endpoint();
+      }
+
+    private:
+      Provider< Protocol
+              , SizeDispatcher
+              , util::not_null<Connections>
+              , std::uint64_t
+              > _provider;
+    };
+
+    struct RPCMultiClientTreeR : public testing::random::Test
+    {
+      // distinct but otherwise meaningless providers
+      auto providers
+        ( std::size_t n
+        ) -> std::vector<util::ASIO::AnyConnectable>
+      {
+        auto connectables {std::vector<util::ASIO::AnyConnectable>{}};
+
+        for (auto i {std::size_t {0}}; i < n; ++i)
+        {
+          connectables.emplace_back
+            ( util::ASIO::make_connectable
+                ( asio::local::stream_protocol::endpoint
+                    {fmt::format ("/provider/{}", i)}
+                )
+            );
+        }
+
+        return connectables;
+      }
+    };
+
+    using Protocols = ::testing::Types
+      < asio::ip::tcp
+      , asio::local::stream_protocol
+      >;
+    template<class> struct RPCMultiClientTreeT : public testing::random::Test
+    {
+      ScopedRunningIOContext io_context_providers
+        {ScopedRunningIOContext::NumberOfThreads {2u}};
+      ScopedRunningIOContext io_context_clients
+        {ScopedRunningIOContext::NumberOfThreads {2u}};
+      Connections connections {io_context_clients};
+    };
+    TYPED_TEST_SUITE (RPCMultiClientTreeT, Protocols);
+  }
+
+  TEST_F (RPCMultiClientTreeR, split_with_zero_arity_is_rejected)
+  {
+    ASSERT_THROW
+      ( std::ignore = detail::split (providers (RandomUInt {0u, 10u}()), 0)
+      , Arity::Error::MustBePositive
+      );
+  }
+
+  TEST_F (RPCMultiClientTreeR, split_makes_parts_of_about_the_same_size)
+  {
+    auto const n {RandomUInt {0u, 1000u}()};
+    auto const arity {RandomUInt {1u, 20u}()};
+    auto const subtree {providers (n)};
+
+    auto const children {detail::split (subtree, arity)};
+
+    ASSERT_EQ
+      ( children.size()
+      , std::min (std::size_t {arity}, subtree.size())
+      );
+
+    auto collected {std::vector<util::ASIO::AnyConnectable>{}};
+
+    for (auto const& child : children)
+    {
+      ASSERT_LE
+        ( std::max (child.subtree.size(), children.front().subtree.size())
+        - std::min (child.subtree.size(), children.front().subtree.size())
+        , 1u
+        );
+
+      collected.emplace_back (child.provider);
+      collected.insert
+        ( std::end (collected)
+        , std::begin (child.subtree)
+        , std::end (child.subtree)
+        );
+    }
+
+    // every provider appears exactly once and in order
+    ASSERT_EQ (collected, subtree);
+  }
+
+  TYPED_TEST
+    ( RPCMultiClientTreeT
+    , collective_reduces_the_responses_of_all_providers
+    )
+  {
+    using Protocol = TypeParam;
+
+    auto const number_of_providers {RandomUInt {1u, 30u}()};
+    auto servers {std::list<Server<Protocol>>{}};
+    auto expected {std::uint64_t {0}};
+    auto const factor {RandomUInt {1u, 10u}()};
+
+    for (auto i {0u}; i < number_of_providers; ++i)
+    {
+      auto const value {std::uint64_t {100u + i}};
+
+      servers.emplace_back
+        (this->io_context_providers, this->connections, value);
+      expected += factor * value;
+    }
+
+    auto subtree {std::vector<util::ASIO::AnyConnectable>{}};
+    std::transform
+      ( std::next (std::begin (servers)), std::end (servers)
+      , std::back_inserter (subtree)
+      , [] (auto const& server) { return server.connectable(); }
+      );
+
+    auto const root
+      { make_client<Protocol, SizeDispatcher, access_policy::Sequential>
+          (this->io_context_clients, servers.front().local_endpoint())
+      };
+
+    ASSERT_EQ
+      ( tree::call<Size>
+          (root, Size {factor}, subtree, Arity {RandomUInt {1u, 4u}()})
+      , expected
+      );
+  }
+
+  TYPED_TEST
+    ( RPCMultiClientTreeT
+    , an_error_in_the_subtree_fails_the_collective
+    )
+  {
+    using Protocol = TypeParam;
+
+    auto const number_of_providers {RandomUInt {2u, 30u}()};
+    auto const failing {RandomUInt {1u, number_of_providers - 1u}()};
+    auto servers {std::list<Server<Protocol>>{}};
+
+    for (auto i {0u}; i < number_of_providers; ++i)
+    {
+      servers.emplace_back
+        ( this->io_context_providers
+        , this->connections
+        , i == failing ? Handler::Fails : std::uint64_t {i}
+        );
+    }
+
+    auto subtree {std::vector<util::ASIO::AnyConnectable>{}};
+    std::transform
+      ( std::next (std::begin (servers)), std::end (servers)
+      , std::back_inserter (subtree)
+      , [] (auto const& server) { return server.connectable(); }
+      );
+
+    auto const root
+      { make_client<Protocol, SizeDispatcher, access_policy::Sequential>
+          (this->io_context_clients, servers.front().local_endpoint())
+      };
+
+    ASSERT_ANY_THROW
+      ( std::ignore = tree::call<Size>
+          (root, Size {1u}, subtree, Arity {RandomUInt {1u, 4u}()})
+      );
+  }
+
+  TYPED_TEST (RPCMultiClientTreeT, zero_arity_is_rejected)
+  {
+    using Protocol = TypeParam;
+
+    auto const server
+      {Server<Protocol> {this->io_context_providers, this->connections, 1u}};
+    auto const root
+      { make_client<Protocol, SizeDispatcher, access_policy::Sequential>
+          (this->io_context_clients, server.local_endpoint())
+      };
+
+    ASSERT_THROW
+      ( std::ignore = tree::call<Size> (root, Size {1u}, {}, Arity {0u})
+      , Arity::Error::MustBePositive
+      );
+  }
+}
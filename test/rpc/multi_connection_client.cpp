@@ -0,0 +1,325 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <asio/ip/tcp.hpp>
+#include <asio/local/stream_protocol.hpp>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <gtest/gtest.h>
+#include <mcs/rpc/BlockingPool.hpp>
+#include <mcs/rpc/Client.hpp>
+#include <mcs/rpc/Dispatcher.hpp>
+#include <mcs/rpc/MultiConnectionClient.hpp>
+#include <mcs/rpc/Provider.hpp>
+#include <mcs/rpc/ScopedRunningIOContext.hpp>
+#include <mcs/rpc/multi_connection/LeastOutstanding.hpp>
+#include <mcs/rpc/multi_connection/NumberOfConnections.hpp>
+#include <mcs/rpc/multi_connection/RoundRobin.hpp>
+#include <mcs/rpc/provider/Options.hpp>
+#include <mcs/testing/random/Test.hpp>
+#include <mcs/testing/random/value/integral.hpp>
+#include <mcs/util/overloaded.hpp>
+#include <span>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  struct Handler
+  {
+    struct Echo { int value; using Response = int; };
+    struct Wait
+    {
+      static constexpr auto is_blocking {true};
+
+      int value;
+      using Response = int;
+    };
+
+    std::shared_future<void>* release;
+
+    auto operator() (Echo echo) const noexcept -> Echo::Response
+    {
+      return echo.value;
+    }
+    auto operator() (Wait wait) const -> Wait::Response
+    {
+      release->wait();
+
+      return wait.value;
+    }
+  };
+
+  using Dispatcher = mcs::rpc::Dispatcher<Handler, Handler::Echo, Handler::Wait>;
+
+  template<typename Protocol_, typename Distribution_>
+    struct Parameter
+  {
+    using Protocol = Protocol_;
+    using Distribution = Distribution_;
+  };
+
+  using Parameters = ::testing::Types
+    < Parameter<asio::ip::tcp, mcs::rpc::multi_connection::RoundRobin>
+    , Parameter<asio::ip::tcp, mcs::rpc::multi_connection::LeastOutstanding>
+    , Parameter< asio::local::stream_protocol
+               , mcs::rpc::multi_connection::RoundRobin
+               >
+    , Parameter< asio::local::stream_protocol
+               , mcs::rpc::multi_connection::LeastOutstanding
+               >
+    >;
+  template<class> struct RPCMultiConnectionClientT
+    : public mcs::testing::random::Test{};
+  TYPED_TEST_SUITE (RPCMultiConnectionClientT, Parameters);
+
+  struct RPCMultiConnectionClientR : public mcs::testing::random::Test{};
+
+  auto outstanding
+    ( std::vector<std::size_t> const& values
+    ) -> std::vector<std::atomic<std::size_t>>
+  {
+    auto outstanding_calls
+      {std::vector<std::atomic<std::size_t>> (values.size())};
+
+    for (auto i {std::size_t {0}}; i < values.size(); ++i)
+    {
+      outstanding_calls[i] = values[i];
+    }
+
+    return outstanding_calls;
+  }
+}
+
+TEST_F (RPCMultiConnectionClientR, round_robin_ignores_the_outstanding_calls)
+{
+  auto const outstanding_calls {outstanding ({3, 0, 7})};
+  auto round_robin {mcs::rpc::multi_connection::RoundRobin{}};
+
+  for (auto round {0}; round < 3; ++round)
+  {
+    for (auto i {std::size_t {0}}; i < outstanding_calls.size(); ++i)
+    {
+      ASSERT_EQ
+        ( round_robin.select
+            ( std::span<std::atomic<std::size_t> const>
+                {outstanding_calls}
+            )
+        , i
+        );
+    }
+  }
+}
+
+TEST_F (RPCMultiConnectionClientR, least_outstanding_selects_a_minimum)
+{
+  auto const outstanding_calls {outstanding ({3, 1, 7, 1, 2})};
+  auto least_outstanding {mcs::rpc::multi_connection::LeastOutstanding{}};
+
+  for (auto i {0}; i < 10; ++i)
+  {
+    auto const selected
+      { least_outstanding.select
+          ( std::span<std::atomic<std::size_t> const>
+              {outstanding_calls}
+          )
+      };
+
+    ASSERT_TRUE (selected == 1 || selected == 3);
+  }
+}
+
+TYPED_TEST ( RPCMultiConnectionClientT
+           , zero_connections_are_rejected
+           )
+{
+  using Protocol = typename TypeParam::Protocol;
+  using Distribution = typename TypeParam::Distribution;
+
+  auto io_context
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {1u}}
+    };
+
+  auto release {std::shared_future<void>{}};
+  auto const provider
+    { mcs::rpc::make_provider<Protocol, Dispatcher>
+        ({}, io_context, &release)
+    };
+
+  ASSERT_THROW
+    ( ( std::ignore = mcs::rpc::make_multi_connection_client
+          < Protocol
+          , Dispatcher
+          , mcs::rpc::access_policy::Concurrent
+          , Distribution
+          >
+          ( io_context
+          , provider.local_endpoint()
+          , mcs::rpc::multi_connection::NumberOfConnections {0}
+          )
+      )
+    , mcs::rpc::multi_connection::NumberOfConnections::Error::MustBePositive
+    );
+}
+
+TYPED_TEST ( RPCMultiConnectionClientT
+           , all_calls_are_answered
+           )
+{
+  using Protocol = typename TypeParam::Protocol;
+  using Distribution = typename TypeParam::Distribution;
+
+  auto io_context_server
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {2u}}
+    };
+  auto io_context_client
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {2u}}
+    };
+
+  auto release {std::shared_future<void>{}};
+  auto const provider
+    { mcs::rpc::make_provider<Protocol, Dispatcher>
+        ({}, io_context_server, &release)
+    };
+
+  auto const number_of_connections
+    {mcs::testing::random::value<std::size_t> {1, 8}()};
+
+  auto const client
+    { mcs::rpc::make_multi_connection_client
+        < Protocol
+        , Dispatcher
+        , mcs::rpc::access_policy::Concurrent
+        , Distribution
+        >
+        ( io_context_client
+        , provider.local_endpoint()
+        , mcs::rpc::multi_connection::NumberOfConnections
+            {number_of_connections}
+        )
+    };
+
+  ASSERT_EQ (client.number_of_connections(), number_of_connections);
+
+  auto responses {std::vector<std::future<int>>{}};
+
+  for (auto i {0}; i < 1000; ++i)
+  {
+    responses.emplace_back (client.get_future (Handler::Echo {i}));
+  }
+
+  auto const echo {Handler::Echo {-1}};
+  ASSERT_EQ (client (std::cref (echo)), -1);
+  ASSERT_EQ (client.get_future (std::cref (echo)).get(), -1);
+  ASSERT_EQ (client (Handler::Echo {-2}), -2);
+  ASSERT_EQ (client.template call<Handler::Echo> (-3), -3);
+  ASSERT_EQ (client.template async_call<Handler::Echo> (-4).get(), -4);
+
+  auto handled {std::promise<int>{}};
+  client
+    ( Handler::Echo {-5}
+    , mcs::util::overloaded
+      ( [&] (int result)
+        {
+          handled.set_value (result);
+        }
+      , [&] (std::exception_ptr error)
+        {
+          handled.set_exception (error);
+        }
+      )
+    );
+  ASSERT_EQ (handled.get_future().get(), -5);
+
+  for (auto i {0}; auto& response : responses)
+  {
+    ASSERT_EQ (response.get(), i++);
+  }
+
+  // \note a call stops to be outstanding after its handler returned
+  while (  client.outstanding_calls()
+        != std::vector<std::size_t> (number_of_connections, 0)
+        )
+  {
+    std::this_thread::yield();
+  }
+}
+
+TYPED_TEST ( RPCMultiConnectionClientT
+           , concurrent_calls_are_spread_over_the_connections
+           )
+{
+  using Protocol = typename TypeParam::Protocol;
+  using Distribution = typename TypeParam::Distribution;
+
+  auto io_context_server
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {1u}}
+    };
+  auto io_context_client
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {1u}}
+    };
+
+  auto const number_of_connections
+    {mcs::testing::random::value<std::size_t> {1, 4}()};
+
+  auto release_promise {std::promise<void>{}};
+  auto release {release_promise.get_future().share()};
+  auto const provider
+    { mcs::rpc::make_provider<Protocol, Dispatcher>
+        ( {}
+        , mcs::rpc::provider::Options
+          { .blocking_pool = mcs::rpc::BlockingPool
+              { mcs::rpc::BlockingPool::NumberOfThreads
+                  {number_of_connections}
+              }
+          }
+        , io_context_server
+        , &release
+        )
+    };
+
+  auto const client
+    { mcs::rpc::make_multi_connection_client
+        < Protocol
+        , Dispatcher
+        , mcs::rpc::access_policy::Concurrent
+        , Distribution
+        >
+        ( io_context_client
+        , provider.local_endpoint()
+        , mcs::rpc::multi_connection::NumberOfConnections
+            {number_of_connections}
+        )
+    };
+
+  // \note one wait per connection: a connection reads one response
+  // at a time
+  auto waits {std::vector<std::future<int>>{}};
+
+  for (auto i {0}; std::cmp_less (i, number_of_connections); ++i)
+  {
+    waits.emplace_back (client.get_future (Handler::Wait {i}));
+  }
+
+  ASSERT_EQ
+    ( client.outstanding_calls()
+    , std::vector<std::size_t> (number_of_connections, 1)
+    );
+
+  release_promise.set_value();
+
+  for (auto i {0}; auto& wait : waits)
+  {
+    ASSERT_EQ (wait.get(), i++);
+  }
+}
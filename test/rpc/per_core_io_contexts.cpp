@@ -0,0 +1,187 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <asio/ip/tcp.hpp>
+#include <asio/local/stream_protocol.hpp>
+#include <cstddef>
+#include <functional>
+#include <gtest/gtest.h>
+#include <mcs/rpc/Client.hpp>
+#include <mcs/rpc/Dispatcher.hpp>
+#include <mcs/rpc/PerCoreIOContexts.hpp>
+#include <mcs/rpc/Provider.hpp>
+#include <mcs/rpc/ScopedRunningIOContext.hpp>
+#include <mcs/rpc/provider/Options.hpp>
+#include <mcs/testing/random/Test.hpp>
+#include <mcs/testing/random/value/integral.hpp>
+#include <mcs/util/syscall/sched_getaffinity.hpp>
+#include <memory>
+#include <sched.h>
+#include <set>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+  struct Handler
+  {
+    struct Thread { using Response = std::size_t; };
+    struct NumberOfCores { using Response = int; };
+
+    auto operator() (Thread) const noexcept -> Thread::Response
+    {
+      return std::hash<std::thread::id>{} (std::this_thread::get_id());
+    }
+    auto operator() (NumberOfCores) const -> NumberOfCores::Response
+    {
+      auto const allowed {mcs::util::syscall::sched_getaffinity (0)};
+
+      return CPU_COUNT (&allowed);
+    }
+  };
+
+  using Dispatcher = mcs::rpc::Dispatcher
+    < Handler
+    , Handler::Thread
+    , Handler::NumberOfCores
+    >;
+
+  struct RPCPerCoreIOContextsR : public mcs::testing::random::Test{};
+
+  using Protocols = ::testing::Types
+    < asio::ip::tcp
+    , asio::local::stream_protocol
+    >;
+  template<class> struct RPCPerCoreIOContextsT
+    : public mcs::testing::random::Test{};
+  TYPED_TEST_SUITE (RPCPerCoreIOContextsT, Protocols);
+}
+
+TEST_F (RPCPerCoreIOContextsR, zero_contexts_are_rejected)
+{
+  ASSERT_THROW
+    ( std::ignore = mcs::rpc::PerCoreIOContexts
+        ( mcs::rpc::PerCoreIOContexts::NumberOfContexts {0}
+        , mcs::rpc::PerCoreIOContexts::Pinning::None
+        )
+    , mcs::rpc::PerCoreIOContexts::Error::NumberOfContextsMustBePositive
+    );
+}
+
+TEST_F (RPCPerCoreIOContextsR, next_is_round_robin)
+{
+  auto const number_of_contexts
+    {mcs::testing::random::value<std::size_t> {1, 8}()};
+
+  auto io_contexts
+    { mcs::rpc::PerCoreIOContexts
+        { mcs::rpc::PerCoreIOContexts::NumberOfContexts {number_of_contexts}
+        , mcs::rpc::PerCoreIOContexts::Pinning::None
+        }
+    };
+
+  ASSERT_EQ (io_contexts.size(), number_of_contexts);
+
+  for (auto round {0}; round < 3; ++round)
+  {
+    for (auto i {std::size_t {0}}; i < number_of_contexts; ++i)
+    {
+      ASSERT_EQ (&io_contexts.next(), &io_contexts[i]);
+    }
+  }
+}
+
+TYPED_TEST ( RPCPerCoreIOContextsT
+           , each_connection_stays_on_one_thread_and_the_connections_are_distributed
+           )
+{
+  using Protocol = TypeParam;
+
+  auto const number_of_contexts
+    {mcs::testing::random::value<std::size_t> {1, 4}()};
+
+  auto io_contexts
+    { mcs::rpc::PerCoreIOContexts
+        { mcs::rpc::PerCoreIOContexts::NumberOfContexts {number_of_contexts}
+        , mcs::rpc::PerCoreIOContexts::Pinning::None
+        }
+    };
+  auto io_context_client
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {1u}}
+    };
+
+  auto const provider
+    { mcs::rpc::make_provider<Protocol, Dispatcher>
+        ( {}
+        , mcs::rpc::provider::Options
+            {.per_core_io_contexts = std::addressof (io_contexts)}
+        , io_contexts[0]
+        )
+    };
+
+  auto threads {std::set<std::size_t>{}};
+
+  for (auto c {std::size_t {0}}; c < 2 * number_of_contexts; ++c)
+  {
+    auto const client
+      { mcs::rpc::make_client
+          <Protocol, Dispatcher, mcs::rpc::access_policy::Exclusive>
+          ( io_context_client
+          , provider.local_endpoint()
+          )
+      };
+
+    auto const thread {client (Handler::Thread{})};
+
+    for (auto i {0}; i < 10; ++i)
+    {
+      ASSERT_EQ (client (Handler::Thread{}), thread);
+    }
+
+    threads.emplace (thread);
+  }
+
+  ASSERT_EQ (threads.size(), number_of_contexts);
+}
+
+TYPED_TEST ( RPCPerCoreIOContextsT
+           , pinned_connections_run_on_a_single_core
+           )
+{
+  using Protocol = TypeParam;
+
+  auto io_contexts
+    { mcs::rpc::PerCoreIOContexts
+        { mcs::rpc::PerCoreIOContexts::NumberOfContexts {2}
+        , mcs::rpc::PerCoreIOContexts::Pinning::ToCores
+        }
+    };
+  auto io_context_client
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {1u}}
+    };
+
+  auto const provider
+    { mcs::rpc::make_provider<Protocol, Dispatcher>
+        ( {}
+        , mcs::rpc::provider::Options
+            {.per_core_io_contexts = std::addressof (io_contexts)}
+        , io_contexts[0]
+        )
+    };
+
+  for (auto c {0}; c < 2; ++c)
+  {
+    auto const client
+      { mcs::rpc::make_client
+          <Protocol, Dispatcher, mcs::rpc::access_policy::Exclusive>
+          ( io_context_client
+          , provider.local_endpoint()
+          )
+      };
+
+    ASSERT_EQ (client (Handler::NumberOfCores{}), 1);
+  }
+}
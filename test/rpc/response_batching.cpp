@@ -0,0 +1,254 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <asio/ip/tcp.hpp>
+#include <asio/local/stream_protocol.hpp>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <gtest/gtest.h>
+#include <mcs/rpc/Client.hpp>
+#include <mcs/rpc/Dispatcher.hpp>
+#include <mcs/rpc/Provider.hpp>
+#include <mcs/rpc/ResponseBatching.hpp>
+#include <mcs/rpc/ScopedRunningIOContext.hpp>
+#include <mcs/rpc/provider/Options.hpp>
+#include <mcs/testing/random/Test.hpp>
+#include <mcs/testing/random/value/integral.hpp>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+  struct Handler
+  {
+    struct Echo { int value; using Response = int; };
+
+    auto operator() (Echo echo) const noexcept -> Echo::Response
+    {
+      return echo.value;
+    }
+  };
+
+  using Dispatcher = mcs::rpc::Dispatcher<Handler, Handler::Echo>;
+
+  auto make_batching
+    ( std::size_t max_responses
+    , std::chrono::microseconds max_latency
+    ) -> mcs::rpc::ResponseBatching
+  {
+    return mcs::rpc::ResponseBatching
+      { mcs::rpc::ResponseBatching::MaxResponses {max_responses}
+      , mcs::rpc::ResponseBatching::MaxLatency {max_latency}
+      };
+  }
+
+  struct RPCResponseBatchingR : public mcs::testing::random::Test{};
+
+  using Protocols = ::testing::Types
+    < asio::ip::tcp
+    , asio::local::stream_protocol
+    >;
+  template<class> struct RPCResponseBatchingT
+    : public mcs::testing::random::Test{};
+  TYPED_TEST_SUITE (RPCResponseBatchingT, Protocols);
+}
+
+TEST_F (RPCResponseBatchingR, zero_max_responses_is_rejected)
+{
+  ASSERT_THROW
+    ( std::ignore = make_batching (0, std::chrono::microseconds {0})
+    , mcs::rpc::ResponseBatching::Error::MaxResponsesMustBePositive
+    );
+}
+
+TEST_F (RPCResponseBatchingR, default_does_not_wait)
+{
+  auto const batching {mcs::rpc::ResponseBatching{}};
+
+  ASSERT_GT (batching.max_responses(), 0);
+  ASSERT_EQ (batching.max_latency(), std::chrono::microseconds {0});
+}
+
+TYPED_TEST ( RPCResponseBatchingT
+           , many_concurrent_requests_are_answered_with_batched_responses
+           )
+{
+  using Protocol = TypeParam;
+
+  auto io_context_server
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {2u}}
+    };
+  auto io_context_client
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {1u}}
+    };
+
+  auto const provider
+    { mcs::rpc::make_provider<Protocol, Dispatcher>
+        ( {}
+        , mcs::rpc::provider::Options
+          { .response_batching = make_batching
+              ( mcs::testing::random::value<std::size_t> {1, 100}()
+              , std::chrono::microseconds
+                  {mcs::testing::random::value<int> {0, 100}()}
+              )
+          }
+        , io_context_server
+        )
+    };
+
+  auto const client
+    { mcs::rpc::make_client<Protocol, Dispatcher, mcs::rpc::access_policy::Concurrent>
+        ( io_context_client
+        , provider.local_endpoint()
+        )
+    };
+
+  auto responses {std::vector<std::future<int>>{}};
+
+  for (auto i {0}; i < 10000; ++i)
+  {
+    responses.emplace_back (client.get_future (Handler::Echo {i}));
+  }
+
+  for (auto i {0}; auto& response : responses)
+  {
+    ASSERT_EQ (response.get(), i++);
+  }
+}
+
+TYPED_TEST ( RPCResponseBatchingT
+           , a_response_waits_at_most_max_latency_for_a_batch
+           )
+{
+  using Protocol = TypeParam;
+
+  auto io_context_server
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {1u}}
+    };
+  auto io_context_client
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {1u}}
+    };
+
+  auto const max_latency {std::chrono::milliseconds {50}};
+
+  auto const provider
+    { mcs::rpc::make_provider<Protocol, Dispatcher>
+        ( {}
+        , mcs::rpc::provider::Options
+          { .response_batching = make_batching (2, max_latency)
+          }
+        , io_context_server
+        )
+    };
+
+  auto const client
+    { mcs::rpc::make_client<Protocol, Dispatcher, mcs::rpc::access_policy::Sequential>
+        ( io_context_client
+        , provider.local_endpoint()
+        )
+    };
+
+  auto const start {std::chrono::steady_clock::now()};
+
+  ASSERT_EQ (client (Handler::Echo {42}), 42);
+
+  ASSERT_GE (std::chrono::steady_clock::now() - start, max_latency);
+}
+
+TYPED_TEST ( RPCResponseBatchingT
+           , a_full_batch_does_not_wait
+           )
+{
+  using Protocol = TypeParam;
+
+  auto io_context_server
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {1u}}
+    };
+  auto io_context_client
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {1u}}
+    };
+
+  auto const max_latency {std::chrono::seconds {60}};
+
+  auto const provider
+    { mcs::rpc::make_provider<Protocol, Dispatcher>
+        ( {}
+        , mcs::rpc::provider::Options
+          { .response_batching = make_batching (1, max_latency)
+          }
+        , io_context_server
+        )
+    };
+
+  auto const client
+    { mcs::rpc::make_client<Protocol, Dispatcher, mcs::rpc::access_policy::Sequential>
+        ( io_context_client
+        , provider.local_endpoint()
+        )
+    };
+
+  auto const start {std::chrono::steady_clock::now()};
+
+  ASSERT_EQ (client (Handler::Echo {42}), 42);
+
+  ASSERT_LT (std::chrono::steady_clock::now() - start, max_latency);
+}
+
+TYPED_TEST ( RPCResponseBatchingT
+           , the_connection_may_end_while_a_batch_waits
+           )
+{
+  using Protocol = TypeParam;
+
+  auto io_context_server
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {1u}}
+    };
+  auto io_context_client
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {1u}}
+    };
+
+  auto const max_latency {std::chrono::milliseconds {50}};
+
+  auto const provider
+    { mcs::rpc::make_provider<Protocol, Dispatcher>
+        ( {}
+        , mcs::rpc::provider::Options
+          { .response_batching = make_batching (2, max_latency)
+          }
+        , io_context_server
+        )
+    };
+
+  {
+    auto const client
+      { mcs::rpc::make_client<Protocol, Dispatcher, mcs::rpc::access_policy::Concurrent>
+          ( io_context_client
+          , provider.local_endpoint()
+          )
+      };
+
+    // the response waits for a batch after the client has gone
+    std::ignore = client.get_future (Handler::Echo {42});
+  }
+
+  std::this_thread::sleep_for (2 * max_latency);
+
+  auto const client
+    { mcs::rpc::make_client<Protocol, Dispatcher, mcs::rpc::access_policy::Sequential>
+        ( io_context_client
+        , provider.local_endpoint()
+        )
+    };
+
+  ASSERT_EQ (client (Handler::Echo {42}), 42);
+}
@@ -0,0 +1,338 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <algorithm>
+#include <asio/buffer.hpp>
+#include <asio/ip/tcp.hpp>
+#include <asio/local/stream_protocol.hpp>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <gtest/gtest.h>
+#include <mcs/rpc/Client.hpp>
+#include <mcs/rpc/Dispatcher.hpp>
+#include <mcs/rpc/Provider.hpp>
+#include <mcs/rpc/ScopedRunningIOContext.hpp>
+#include <mcs/rpc/detail/SendQueue.hpp>
+#include <mcs/serialization/OArchive.hpp>
+#include <mcs/testing/random/Test.hpp>
+#include <mcs/testing/random/value/integral.hpp>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+  // Records the bytes and the number of writes. The first write
+  // blocks until the test releases it.
+  //
+  struct Socket
+  {
+    std::vector<std::byte> bytes;
+    std::size_t writes {0};
+    bool fail {false};
+    std::promise<void> entered;
+    std::shared_future<void> release;
+
+    template<typename ConstBufferSequence, typename ErrorCode>
+      auto write_some (ConstBufferSequence const& buffers, ErrorCode&)
+        -> std::size_t
+    {
+      if (writes++ == 0 && release.valid())
+      {
+        entered.set_value();
+        release.wait();
+      }
+
+      if (fail)
+      {
+        throw std::runtime_error {"Socket: write failed"};
+      }
+
+      auto size {std::size_t {0}};
+
+      for ( auto buffer {asio::buffer_sequence_begin (buffers)}
+          ; buffer != asio::buffer_sequence_end (buffers)
+          ; ++buffer
+          )
+      {
+        auto const data {static_cast<std::byte const*> (buffer->data())};
+
+        bytes.insert (bytes.end(), data, data + buffer->size());
+        size += buffer->size();
+      }
+
+      return size;
+    }
+  };
+
+  struct Call final : public mcs::rpc::detail::SendQueue::Call
+  {
+    explicit Call (int value_) : value {value_} {}
+
+    [[nodiscard]] auto buffers
+      (
+      ) const noexcept -> mcs::serialization::OArchive::Buffers const& override
+    {
+      return _archive.buffers();
+    }
+    [[nodiscard]] auto is_streaming() const noexcept -> bool override
+    {
+      return false;
+    }
+    auto stream() -> void override {}
+
+    int value;
+
+  private:
+    mcs::serialization::OArchive _archive {value};
+  };
+
+  auto bytes_of (std::vector<int> values) -> std::vector<std::byte>
+  {
+    auto bytes {std::vector<std::byte>{}};
+
+    for (auto value : values)
+    {
+      auto const call {Call {value}};
+
+      for (auto const& buffer : call.buffers())
+      {
+        bytes.insert (bytes.end(), buffer.begin(), buffer.end());
+      }
+    }
+
+    return bytes;
+  }
+
+  auto no_error = [] (std::exception_ptr error)
+  {
+    if (error)
+    {
+      std::rethrow_exception (error);
+    }
+  };
+
+  struct RPCSendQueueR : public mcs::testing::random::Test{};
+}
+
+TEST_F (RPCSendQueueR, calls_are_sent_in_the_order_they_are_pushed)
+{
+  auto const values
+    { std::vector<int>
+      ( mcs::testing::random::value<std::size_t> {0, 100}()
+      , mcs::testing::random::value<int>{}()
+      )
+    };
+
+  auto send_queue {mcs::rpc::detail::SendQueue{}};
+  auto socket {Socket{}};
+
+  for (auto value : values)
+  {
+    send_queue.push (std::make_unique<Call> (value));
+  }
+
+  send_queue.send (socket, no_error);
+
+  ASSERT_EQ (socket.bytes, bytes_of (values));
+  ASSERT_LT (socket.writes, std::max (values.size(), std::size_t {2}));
+}
+
+TEST_F (RPCSendQueueR, calls_queued_during_a_write_are_gathered)
+{
+  auto send_queue {mcs::rpc::detail::SendQueue{}};
+  auto socket {Socket{}};
+  auto release {std::promise<void>{}};
+  socket.release = release.get_future().share();
+
+  send_queue.push (std::make_unique<Call> (0));
+
+  auto writer
+    { std::async
+        ( std::launch::async
+        , [&] { send_queue.send (socket, no_error); }
+        )
+    };
+
+  socket.entered.get_future().wait();
+
+  auto const number_of_calls
+    {mcs::testing::random::value<int> {2, 100}()};
+  auto values {std::vector<int> {0}};
+
+  // the writer is busy, the calls are left in the queue
+  for (auto i {1}; i <= number_of_calls; ++i)
+  {
+    send_queue.push (std::make_unique<Call> (i));
+    values.emplace_back (i);
+  }
+
+  release.set_value();
+  writer.get();
+
+  // \note the socket may split a gathered write into several writes
+  // of a bounded number of buffers
+  ASSERT_EQ (socket.bytes, bytes_of (values));
+  ASSERT_LT (socket.writes, 1 + number_of_calls);
+}
+
+TEST_F (RPCSendQueueR, send_waits_until_the_call_has_been_written)
+{
+  auto send_queue {mcs::rpc::detail::SendQueue{}};
+  auto socket {Socket{}};
+  auto release {std::promise<void>{}};
+  socket.release = release.get_future().share();
+
+  send_queue.push (std::make_unique<Call> (0));
+
+  auto writer
+    { std::async
+        ( std::launch::async
+        , [&] { send_queue.send (socket, no_error); }
+        )
+    };
+
+  socket.entered.get_future().wait();
+
+  send_queue.push (std::make_unique<Call> (1));
+
+  auto waiting
+    { std::async
+        ( std::launch::async
+        , [&] { send_queue.send (socket, no_error); }
+        )
+    };
+
+  // the writer is busy, the call has not been written
+  ASSERT_EQ
+    ( waiting.wait_for (std::chrono::milliseconds {10})
+    , std::future_status::timeout
+    );
+
+  release.set_value();
+  waiting.get();
+
+  ASSERT_EQ (socket.bytes, bytes_of ({0, 1}));
+
+  writer.get();
+}
+
+TEST_F (RPCSendQueueR, failed_write_reports_the_error_and_drops_the_queue)
+{
+  auto send_queue {mcs::rpc::detail::SendQueue{}};
+  auto socket {Socket{}};
+  socket.fail = true;
+
+  send_queue.push (std::make_unique<Call> (0));
+  send_queue.push (std::make_unique<Call> (1));
+
+  auto errors {std::size_t {0}};
+
+  send_queue.send
+    ( socket
+    , [&] (std::exception_ptr error)
+      {
+        ASSERT_TRUE (error);
+        ++errors;
+      }
+    );
+
+  ASSERT_EQ (errors, 1);
+
+  socket.fail = false;
+  socket.bytes.clear();
+
+  send_queue.push (std::make_unique<Call> (2));
+  send_queue.send (socket, no_error);
+
+  ASSERT_EQ (socket.bytes, bytes_of ({2}));
+}
+
+namespace
+{
+  struct Handler
+  {
+    struct Echo { int value; using Response = int; };
+
+    auto operator() (Echo echo) const noexcept -> Echo::Response
+    {
+      return echo.value;
+    }
+  };
+
+  using Protocols = ::testing::Types
+    < asio::ip::tcp
+    , asio::local::stream_protocol
+    >;
+  template<class> struct RPCSendQueueT : public mcs::testing::random::Test{};
+  TYPED_TEST_SUITE (RPCSendQueueT, Protocols);
+}
+
+TYPED_TEST ( RPCSendQueueT
+           , concurrent_calls_from_many_threads_are_all_answered
+           )
+{
+  using Protocol = TypeParam;
+  using Dispatcher = mcs::rpc::Dispatcher<Handler, Handler::Echo>;
+
+  auto io_context_server
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {2u}}
+    };
+  auto io_context_client
+    { mcs::rpc::ScopedRunningIOContext
+        {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {2u}}
+    };
+
+  auto const provider
+    { mcs::rpc::make_provider<Protocol, Dispatcher> ({}, io_context_server)
+    };
+
+  auto const client
+    { mcs::rpc::make_client<Protocol, Dispatcher, mcs::rpc::access_policy::Concurrent>
+        ( io_context_client
+        , provider.local_endpoint()
+        )
+    };
+
+  auto const number_of_threads
+    {mcs::testing::random::value<int> {2, 16}()};
+  auto const calls_per_thread {1000};
+
+  auto threads {std::vector<std::future<void>>{}};
+
+  for (auto t {0}; t < number_of_threads; ++t)
+  {
+    threads.emplace_back
+      ( std::async
+          ( std::launch::async
+          , [&, t]
+            {
+              auto responses {std::vector<std::future<int>>{}};
+
+              for (auto i {0}; i < calls_per_thread; ++i)
+              {
+                responses.emplace_back
+                  ( client.get_future
+                      (Handler::Echo {t * calls_per_thread + i})
+                  );
+              }
+
+              auto expected {t * calls_per_thread};
+
+              for (auto& response : responses)
+              {
+                ASSERT_EQ (response.get(), expected++);
+              }
+            }
+          )
+      );
+  }
+
+  for (auto& thread : threads)
+  {
+    thread.get();
+  }
+}
@@ -0,0 +1,251 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <asio/ip/tcp.hpp>
+#include <asio/local/stream_protocol.hpp>
+#include <chrono>
+#include <cstdint>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <mcs/rpc/Client.hpp>
+#include <mcs/rpc/Dispatcher.hpp>
+#include <mcs/rpc/Provider.hpp>
+#include <mcs/rpc/ScopedRunningIOContext.hpp>
+#include <mcs/rpc/Statistics.hpp>
+#include <mcs/rpc/access_policy/Exclusive.hpp>
+#include <mcs/testing/random/Test.hpp>
+#include <mcs/testing/random/value/integral.hpp>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+  struct Echo { int value; using Response = int; };
+  struct Fail { using Response = void; };
+
+  struct Handler
+  {
+    auto operator() (Echo echo) const noexcept -> Echo::Response
+    {
+      return echo.value;
+    }
+    [[noreturn]] auto operator() (Fail) const -> Fail::Response
+    {
+      throw std::runtime_error {"Fail"};
+    }
+  };
+
+  using Dispatcher = mcs::rpc::Dispatcher<Handler, Echo, Fail>;
+
+  using RandomUInt = mcs::testing::random::value<unsigned int>;
+
+  struct RPCStatisticsR : public mcs::testing::random::Test{};
+
+  using Protocols = ::testing::Types
+    < asio::ip::tcp
+    , asio::local::stream_protocol
+    >;
+  template<class> struct RPCStatisticsT : public mcs::testing::random::Test
+  {
+    mcs::rpc::ScopedRunningIOContext io_context_server
+      {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {2u}};
+    mcs::rpc::ScopedRunningIOContext io_context_client
+      {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {1u}};
+  };
+  TYPED_TEST_SUITE (RPCStatisticsT, Protocols);
+}
+
+TEST_F (RPCStatisticsR, bucket_of_sub_microsecond_latencies_is_zero)
+{
+  ASSERT_EQ
+    ( mcs::rpc::LatencyHistogram::bucket
+        (std::chrono::nanoseconds {RandomUInt {0u, 999u}()})
+    , 0u
+    );
+}
+
+TEST_F (RPCStatisticsR, bucket_is_the_power_of_two_above_the_latency)
+{
+  auto const microseconds {RandomUInt {1u, 1u << 29u}()};
+
+  auto const bucket
+    { mcs::rpc::LatencyHistogram::bucket
+        (std::chrono::microseconds {microseconds})
+    };
+
+  ASSERT_GT (bucket, 0u);
+  ASSERT_LE (std::uint64_t {1} << (bucket - 1), microseconds);
+  ASSERT_LT (microseconds, std::uint64_t {1} << bucket);
+}
+
+TEST_F (RPCStatisticsR, last_bucket_counts_all_long_latencies)
+{
+  ASSERT_EQ
+    ( mcs::rpc::LatencyHistogram::bucket (std::chrono::hours {24 * 365})
+    , mcs::rpc::LatencyHistogram::NumberOfBuckets - 1
+    );
+}
+
+TYPED_TEST (RPCStatisticsT, commands_are_counted)
+{
+  using Protocol = TypeParam;
+
+  auto const provider
+    { mcs::rpc::make_provider<Protocol, Dispatcher>
+        ({}, this->io_context_server)
+    };
+  auto const client
+    { mcs::rpc::make_client
+        <Protocol, Dispatcher, mcs::rpc::access_policy::Exclusive>
+          (this->io_context_client, provider.local_endpoint())
+    };
+
+  auto const echos {RandomUInt {0u, 100u}()};
+  auto const fails {RandomUInt {0u, 100u}()};
+
+  for (auto i {0u}; i < echos; ++i)
+  {
+    ASSERT_EQ (client (Echo {static_cast<int> (i)}), static_cast<int> (i));
+  }
+  for (auto i {0u}; i < fails; ++i)
+  {
+    ASSERT_ANY_THROW (client (Fail{}));
+  }
+
+  auto const statistics {provider.statistics()};
+
+  ASSERT_EQ (statistics.commands.size(), 3u);
+
+  auto const& echo {statistics.commands.at (0)};
+  ASSERT_EQ (echo.calls, echos);
+  ASSERT_EQ (echo.errors, 0u);
+  ASSERT_EQ (echo.queueing.count(), echos);
+  ASSERT_EQ (echo.handling.count(), echos);
+  ASSERT_EQ (echo.bytes_in > 0u, echos > 0u);
+  ASSERT_EQ (echo.bytes_out > 0u, echos > 0u);
+
+  auto const& fail {statistics.commands.at (1)};
+  ASSERT_EQ (fail.calls, fails);
+  ASSERT_EQ (fail.errors, fails);
+  ASSERT_EQ (fail.handling.count(), fails);
+  ASSERT_EQ (fail.bytes_out > 0u, fails > 0u);
+
+  auto const& get_statistics {statistics.commands.at (2)};
+  ASSERT_EQ (get_statistics.command, "mcs::rpc::GetStatistics");
+  ASSERT_EQ (get_statistics.calls, 0u);
+
+  ASSERT_EQ (statistics.connections.size(), 1u);
+  ASSERT_EQ (statistics.connections.front().requests, echos + fails);
+  ASSERT_EQ
+    ( statistics.connections.front().bytes_in
+    , echo.bytes_in + fail.bytes_in
+    );
+  ASSERT_EQ
+    ( statistics.connections.front().bytes_out
+    , echo.bytes_out + fail.bytes_out
+    );
+}
+
+TYPED_TEST (RPCStatisticsT, statistics_can_be_retrieved_remotely)
+{
+  using Protocol = TypeParam;
+  using Client = Dispatcher::StatisticsClientType
+    < Protocol
+    , mcs::rpc::access_policy::Exclusive
+    >;
+
+  auto const provider
+    { mcs::rpc::make_provider<Protocol, Dispatcher>
+        ({}, this->io_context_server)
+    };
+  auto const client
+    { Client
+      { this->io_context_client
+      , provider.local_endpoint()
+      , std::make_shared<mcs::rpc::access_policy::Exclusive>()
+      }
+    };
+
+  auto const echos {RandomUInt {0u, 100u}()};
+
+  for (auto i {0u}; i < echos; ++i)
+  {
+    ASSERT_EQ (client (Echo {static_cast<int> (i)}), static_cast<int> (i));
+  }
+
+  auto const statistics {client (mcs::rpc::GetStatistics{})};
+
+  ASSERT_EQ (statistics.commands.size(), 3u);
+  ASSERT_EQ (statistics.commands.at (0).calls, echos);
+  ASSERT_EQ (statistics.commands.at (1).calls, 0u);
+  // the running call has been received but not yet answered
+  ASSERT_EQ (statistics.commands.at (2).calls, 1u);
+  ASSERT_EQ (statistics.commands.at (2).handling.count(), 0u);
+  ASSERT_EQ (statistics.connections.size(), 1u);
+  ASSERT_EQ (statistics.connections.front().requests, echos + 1u);
+
+  ASSERT_EQ (provider.statistics().commands.at (2).calls, 1u);
+}
+
+TYPED_TEST (RPCStatisticsT, every_open_connection_is_listed)
+{
+  using Protocol = TypeParam;
+
+  auto const provider
+    { mcs::rpc::make_provider<Protocol, Dispatcher>
+        ({}, this->io_context_server)
+    };
+
+  auto const number_of_clients {RandomUInt {1u, 10u}()};
+  auto clients
+    { std::vector
+      < Dispatcher::ClientType<Protocol, mcs::rpc::access_policy::Exclusive>
+      >{}
+    };
+
+  for (auto i {0u}; i < number_of_clients; ++i)
+  {
+    clients.emplace_back
+      ( mcs::rpc::make_client
+          <Protocol, Dispatcher, mcs::rpc::access_policy::Exclusive>
+            (this->io_context_client, provider.local_endpoint())
+      );
+
+    // the connection is known to the provider once it has answered
+    ASSERT_EQ (clients.back() (Echo {1}), 1);
+  }
+
+  auto const statistics {provider.statistics()};
+
+  ASSERT_EQ (statistics.connections.size(), number_of_clients);
+
+  for (auto const& connection : statistics.connections)
+  {
+    ASSERT_EQ (connection.requests, 1u);
+  }
+}
+
+TYPED_TEST (RPCStatisticsT, statistics_can_be_printed)
+{
+  using Protocol = TypeParam;
+
+  auto const provider
+    { mcs::rpc::make_provider<Protocol, Dispatcher>
+        ({}, this->io_context_server)
+    };
+  auto const client
+    { mcs::rpc::make_client
+        <Protocol, Dispatcher, mcs::rpc::access_policy::Exclusive>
+          (this->io_context_client, provider.local_endpoint())
+    };
+
+  ASSERT_EQ (client (Echo {1}), 1);
+
+  auto const printed {fmt::format ("{}", provider.statistics())};
+
+  ASSERT_NE (printed.find ("Echo: calls 1, errors 0"), std::string::npos);
+  ASSERT_NE (printed.find ("Fail: calls 0, errors 0"), std::string::npos);
+  ASSERT_NE (printed.find ("connections:\n"), std::string::npos);
+}
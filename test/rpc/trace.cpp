@@ -0,0 +1,210 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <algorithm>
+#include <asio/ip/tcp.hpp>
+#include <asio/local/stream_protocol.hpp>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <mcs/rpc/Client.hpp>
+#include <mcs/rpc/Dispatcher.hpp>
+#include <mcs/rpc/Provider.hpp>
+#include <mcs/rpc/ScopedRunningIOContext.hpp>
+#include <mcs/rpc/access_policy/Exclusive.hpp>
+#include <mcs/testing/random/Test.hpp>
+#include <mcs/testing/random/value/integral.hpp>
+#include <mcs/util/trace/Context.hpp>
+#include <mcs/util/trace/Recorder.hpp>
+#include <memory>
+#include <tuple>
+
+namespace
+{
+  // Responds with the trace context the handler has been called with.
+  //
+  struct Current { using Response = mcs::util::trace::Context; };
+
+  struct Handler
+  {
+    auto operator() (Current) const noexcept -> Current::Response
+    {
+      return mcs::util::trace::current();
+    }
+  };
+
+  using Dispatcher = mcs::rpc::Dispatcher<Handler, Current>;
+
+  using Protocols = ::testing::Types
+    < asio::ip::tcp
+    , asio::local::stream_protocol
+    >;
+  template<class> struct RPCTraceT : public mcs::testing::random::Test
+  {
+    RPCTraceT() = default;
+    ~RPCTraceT() override
+    {
+      mcs::util::trace::install (nullptr);
+    }
+    RPCTraceT (RPCTraceT const&) = delete;
+    RPCTraceT (RPCTraceT&&) = delete;
+    auto operator= (RPCTraceT const&) -> RPCTraceT& = delete;
+    auto operator= (RPCTraceT&&) -> RPCTraceT& = delete;
+
+    mcs::rpc::ScopedRunningIOContext io_context_server
+      {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {1u}};
+    mcs::rpc::ScopedRunningIOContext io_context_client
+      {mcs::rpc::ScopedRunningIOContext::NumberOfThreads {1u}};
+
+    using RandomID = mcs::testing::random::value<std::uint64_t>;
+
+    auto random_context() -> mcs::util::trace::Context
+    {
+      return mcs::util::trace::Context
+        {RandomID {RandomID::Min {1u}}(), RandomID {RandomID::Min {1u}}()};
+    }
+  };
+  TYPED_TEST_SUITE (RPCTraceT, Protocols);
+}
+
+TYPED_TEST (RPCTraceT, calls_are_not_traced_by_default)
+{
+  using Protocol = TypeParam;
+
+  auto const provider
+    { mcs::rpc::make_provider<Protocol, Dispatcher>
+        ({}, this->io_context_server)
+    };
+  auto const client
+    { mcs::rpc::make_client
+        <Protocol, Dispatcher, mcs::rpc::access_policy::Exclusive>
+          (this->io_context_client, provider.local_endpoint())
+    };
+
+  ASSERT_FALSE (client (Current{}).is_traced());
+}
+
+TYPED_TEST
+  ( RPCTraceT
+  , the_context_of_the_caller_is_propagated_without_a_recorder
+  )
+{
+  using Protocol = TypeParam;
+
+  auto const provider
+    { mcs::rpc::make_provider<Protocol, Dispatcher>
+        ({}, this->io_context_server)
+    };
+  auto const client
+    { mcs::rpc::make_client
+        <Protocol, Dispatcher, mcs::rpc::access_policy::Exclusive>
+          (this->io_context_client, provider.local_endpoint())
+    };
+
+  auto const context {this->random_context()};
+  auto const scoped_context {mcs::util::trace::ScopedContext {context}};
+
+  auto const handler_context {client (Current{})};
+
+  ASSERT_EQ (handler_context.trace_id, context.trace_id);
+  ASSERT_EQ (handler_context.parent_span, context.parent_span);
+}
+
+TYPED_TEST
+  ( RPCTraceT
+  , the_provider_span_is_a_child_of_the_client_span
+  )
+{
+  using Protocol = TypeParam;
+
+  auto const recorder {std::make_shared<mcs::util::trace::Recorder>()};
+  mcs::util::trace::install (recorder);
+
+  auto const provider
+    { mcs::rpc::make_provider<Protocol, Dispatcher>
+        ({}, this->io_context_server)
+    };
+  auto const client
+    { mcs::rpc::make_client
+        <Protocol, Dispatcher, mcs::rpc::access_policy::Exclusive>
+          (this->io_context_client, provider.local_endpoint())
+    };
+
+  auto const handler_context {client (Current{})};
+
+  // the client span ends when the response has been received
+  auto const spans {recorder->spans()};
+
+  ASSERT_EQ (spans.size(), 2u);
+
+  using mcs::util::trace::Kind;
+  using mcs::util::trace::Recorded;
+
+  auto const server
+    {std::ranges::find (spans, Kind::Server, &Recorded::kind)};
+  auto const client_span
+    {std::ranges::find (spans, Kind::Client, &Recorded::kind)};
+
+  ASSERT_NE (server, std::end (spans));
+  ASSERT_NE (client_span, std::end (spans));
+
+  ASSERT_EQ (server->name, "(anonymous namespace)::Current");
+  ASSERT_EQ (server->category, "rpc.provider");
+  ASSERT_EQ (client_span->name, "(anonymous namespace)::Current");
+  ASSERT_EQ (client_span->category, "rpc.client");
+
+  ASSERT_EQ (server->trace_id, client_span->trace_id);
+  ASSERT_EQ (server->parent_span, client_span->span_id);
+  ASSERT_LE (client_span->begin, server->begin);
+
+  // the handler runs as a child of the provider span
+  ASSERT_EQ (handler_context.trace_id, server->trace_id);
+  ASSERT_EQ (handler_context.parent_span, server->span_id);
+}
+
+TYPED_TEST
+  ( RPCTraceT
+  , a_traced_caller_is_the_parent_of_the_client_span
+  )
+{
+  using Protocol = TypeParam;
+
+  auto const recorder {std::make_shared<mcs::util::trace::Recorder>()};
+  mcs::util::trace::install (recorder);
+
+  auto const provider
+    { mcs::rpc::make_provider<Protocol, Dispatcher>
+        ({}, this->io_context_server)
+    };
+  auto const client
+    { mcs::rpc::make_client
+        <Protocol, Dispatcher, mcs::rpc::access_policy::Exclusive>
+          (this->io_context_client, provider.local_endpoint())
+    };
+
+  auto const context {this->random_context()};
+  auto const scoped_context {mcs::util::trace::ScopedContext {context}};
+
+  std::ignore = client (Current{});
+
+  auto const spans {recorder->spans()};
+
+  ASSERT_EQ (spans.size(), 2u);
+
+  for (auto const& span : spans)
+  {
+    ASSERT_EQ (span.trace_id, context.trace_id);
+  }
+
+  ASSERT_TRUE
+    ( std::ranges::any_of
+      ( spans
+      , [&] (auto const& span) noexcept
+        {
+          return span.kind == mcs::util::trace::Kind::Client
+            && span.parent_span == context.parent_span
+            ;
+        }
+      )
+    );
+}
@@ -0,0 +1,124 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <mcs/serialization/OArchive.hpp>
+#include <mcs/serialization/load_from.hpp>
+#include <mcs/testing/random/Test.hpp>
+#include <mcs/testing/random/value/integral.hpp>
+#include <mcs/util/ASIO/Connectable.hpp>
+#include <mcs/util/read/read.hpp>
+#include <mcs/util/read/uint.hpp>
+#include <mcs/util/string.hpp>
+#include <mcs/util/syscall/hostname.hpp>
+#include <type_traits>
+#include <variant>
+
+namespace
+{
+  using TCP = mcs::util::ASIO::Connectable<asio::ip::tcp>;
+  using Local = mcs::util::ASIO::Connectable<asio::local::stream_protocol>;
+
+  struct util_ASIO_ConnectableR : public mcs::testing::random::Test
+  {
+    asio::ip::port_type port
+      {mcs::testing::random::value<asio::ip::port_type>{}()};
+    Local local {mcs::util::string {"/tmp/same-host"}};
+
+    [[nodiscard]] auto with_hostname (char const* hostname) const -> TCP
+    {
+      return TCP
+        { TCP::Hostname {mcs::util::string {hostname}}
+        , port
+        , local
+        };
+    }
+    [[nodiscard]] auto with_address (char const* address) const -> TCP
+    {
+      return TCP
+        { TCP::Address {mcs::util::string {address}}
+        , port
+        , local
+        };
+    }
+  };
+}
+
+TEST_F (util_ASIO_ConnectableR, read_is_inverse_of_fmt_with_same_host)
+{
+  auto const connectable {with_hostname (mcs::util::syscall::hostname())};
+
+  ASSERT_EQ
+    ( connectable
+    , mcs::util::read::read<TCP> (fmt::format ("{}", connectable))
+    );
+
+  auto const without_same_host
+    {TCP {TCP::Address {mcs::util::string {"::1"}}, port}};
+
+  ASSERT_EQ
+    ( without_same_host
+    , mcs::util::read::read<TCP> (fmt::format ("{}", without_same_host))
+    );
+}
+
+TEST_F (util_ASIO_ConnectableR, serialization_keeps_same_host)
+{
+  auto const connectable {with_address ("127.0.0.1")};
+
+  auto const bytes {mcs::serialization::OArchive {connectable}.bytes()};
+
+  ASSERT_EQ
+    ( connectable
+    , mcs::serialization::load_from<TCP> (bytes.data(), bytes.size())
+    );
+}
+
+TEST_F (util_ASIO_ConnectableR, same_host_is_preferred_on_the_local_host)
+{
+  for ( auto const& connectable
+      : { with_hostname (mcs::util::syscall::hostname())
+        , with_address ("127.0.0.1")
+        , with_address ("::1")
+        }
+      )
+  {
+    ASSERT_EQ
+      ( mcs::util::ASIO::AnyConnectable {local}
+      , mcs::util::ASIO::prefer_same_host (connectable)
+      );
+  }
+}
+
+TEST_F (util_ASIO_ConnectableR, same_host_is_not_used_on_other_hosts)
+{
+  for ( auto const& connectable
+      : { with_hostname ("not-the-local-host.invalid")
+        , with_address ("192.0.2.1")
+        , with_address ("not an address")
+        }
+      )
+  {
+    ASSERT_EQ
+      ( mcs::util::ASIO::AnyConnectable {connectable}
+      , mcs::util::ASIO::prefer_same_host (connectable)
+      );
+  }
+}
+
+TEST_F (util_ASIO_ConnectableR, run_uses_the_same_host_alternative)
+{
+  auto const used_local
+    { mcs::util::ASIO::run
+      ( with_hostname (mcs::util::syscall::hostname())
+      , []<mcs::util::ASIO::is_protocol Protocol>
+          (mcs::util::ASIO::Connectable<Protocol>)
+        {
+          return std::is_same_v<Protocol, asio::local::stream_protocol>;
+        }
+      )
+    };
+
+  ASSERT_TRUE (used_local);
+}
@@ -0,0 +1,38 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <asio/io_context.hpp>
+#include <asio/local/stream_protocol.hpp>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <mcs/testing/UniqTemporaryDirectory.hpp>
+#include <mcs/util/ASIO/ListeningAcceptor.hpp>
+#include <optional>
+
+namespace mcs::util::ASIO
+{
+  TEST (ListeningAcceptor, local_socket_file_is_removed_on_destruction)
+  {
+    using Protocol = asio::local::stream_protocol;
+
+    auto const temporary_directory
+      {testing::UniqTemporaryDirectory {"UTIL-ASIO-LISTENING-ACCEPTOR"}};
+    auto const endpoint
+      {Protocol::endpoint {(temporary_directory.path() / "SOCK").native()}};
+    auto io_context {asio::io_context{}};
+
+    auto acceptor {std::optional<ListeningAcceptor<Protocol>>{}};
+    acceptor.emplace (io_context, endpoint);
+
+    ASSERT_TRUE (std::filesystem::exists (endpoint.path()));
+
+    acceptor.reset();
+
+    ASSERT_FALSE (std::filesystem::exists (endpoint.path()));
+
+    // the path can be bound again
+    acceptor.emplace (io_context, endpoint);
+
+    ASSERT_EQ (acceptor->local_endpoint(), endpoint);
+  }
+}
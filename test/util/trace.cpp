@@ -0,0 +1,216 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <chrono>
+#include <cstdint>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <mcs/testing/random/Test.hpp>
+#include <mcs/testing/random/value/integral.hpp>
+#include <mcs/util/trace/ChromeJSON.hpp>
+#include <mcs/util/trace/Context.hpp>
+#include <mcs/util/trace/Recorder.hpp>
+#include <mcs/util/trace/Span.hpp>
+#include <memory>
+
+namespace mcs::util::trace
+{
+  namespace
+  {
+    struct UtilTraceR : public testing::random::Test
+    {
+      UtilTraceR()
+      {
+        install (recorder);
+      }
+      ~UtilTraceR() override
+      {
+        install (nullptr);
+      }
+      UtilTraceR (UtilTraceR const&) = delete;
+      UtilTraceR (UtilTraceR&&) = delete;
+      auto operator= (UtilTraceR const&) -> UtilTraceR& = delete;
+      auto operator= (UtilTraceR&&) -> UtilTraceR& = delete;
+
+      std::shared_ptr<Recorder> recorder {std::make_shared<Recorder>()};
+
+      using RandomID = testing::random::value<std::uint64_t>;
+
+      auto random_context() -> Context
+      {
+        return Context
+          {RandomID {RandomID::Min {1u}}(), RandomID {RandomID::Min {1u}}()};
+      }
+    };
+  }
+
+  TEST (UtilTrace, the_context_is_not_traced_by_default)
+  {
+    ASSERT_FALSE (current().is_traced());
+  }
+
+  TEST_F (UtilTraceR, scoped_context_sets_and_restores_the_context)
+  {
+    auto const outer {random_context()};
+    auto const inner {random_context()};
+
+    {
+      auto const scoped_outer {ScopedContext {outer}};
+
+      ASSERT_EQ (current().trace_id, outer.trace_id);
+      ASSERT_EQ (current().parent_span, outer.parent_span);
+
+      {
+        auto const scoped_inner {ScopedContext {inner}};
+
+        ASSERT_EQ (current().trace_id, inner.trace_id);
+        ASSERT_EQ (current().parent_span, inner.parent_span);
+      }
+
+      ASSERT_EQ (current().trace_id, outer.trace_id);
+      ASSERT_EQ (current().parent_span, outer.parent_span);
+    }
+
+    ASSERT_FALSE (current().is_traced());
+  }
+
+  TEST_F (UtilTraceR, nothing_is_recorded_without_a_recorder)
+  {
+    install (nullptr);
+
+    ASSERT_FALSE
+      (Span::start ("name", "category", Kind::Client, Context{}));
+    ASSERT_FALSE
+      (Span::start ("name", "category", Kind::Server, random_context()));
+  }
+
+  TEST_F (UtilTraceR, only_client_spans_start_a_new_trace)
+  {
+    ASSERT_FALSE
+      (Span::start ("name", "category", Kind::Internal, Context{}));
+    ASSERT_FALSE
+      (Span::start ("name", "category", Kind::Server, Context{}));
+
+    auto span {Span::start ("name", "category", Kind::Client, Context{})};
+
+    ASSERT_TRUE (span);
+    ASSERT_TRUE (span->context().is_traced());
+    ASSERT_NE (span->context().parent_span, 0u);
+  }
+
+  TEST_F (UtilTraceR, a_span_is_recorded_as_child_of_its_parent_when_it_ends)
+  {
+    auto const parent {random_context()};
+
+    {
+      auto span {Span::start ("name", "category", Kind::Server, parent)};
+
+      ASSERT_TRUE (span);
+      ASSERT_EQ (span->context().trace_id, parent.trace_id);
+      ASSERT_TRUE (recorder->spans().empty());
+    }
+
+    auto const spans {recorder->spans()};
+
+    ASSERT_EQ (spans.size(), 1u);
+    ASSERT_EQ (spans.front().name, "name");
+    ASSERT_EQ (spans.front().category, "category");
+    ASSERT_EQ (spans.front().kind, Kind::Server);
+    ASSERT_EQ (spans.front().trace_id, parent.trace_id);
+    ASSERT_EQ (spans.front().parent_span, parent.parent_span);
+    ASSERT_NE (spans.front().span_id, 0u);
+    ASSERT_LE (spans.front().begin, spans.front().end);
+  }
+
+  TEST_F (UtilTraceR, a_span_is_recorded_once)
+  {
+    auto span {Span::start ("name", "category", Kind::Client, Context{})};
+
+    ASSERT_TRUE (span);
+
+    span->end();
+    span->end();
+    span.reset();
+
+    ASSERT_EQ (recorder->spans().size(), 1u);
+  }
+
+  TEST_F (UtilTraceR, children_share_the_trace_and_refer_to_their_parent)
+  {
+    auto client {Span::start ("client", "rpc", Kind::Client, Context{})};
+    ASSERT_TRUE (client);
+    auto server
+      {Span::start ("server", "rpc", Kind::Server, client->context())};
+    ASSERT_TRUE (server);
+    auto internal
+      {Span::start ("internal", "rpc", Kind::Internal, server->context())};
+    ASSERT_TRUE (internal);
+
+    ASSERT_EQ (internal->context().trace_id, client->context().trace_id);
+    ASSERT_EQ (server->context().trace_id, client->context().trace_id);
+
+    internal->end();
+    server->end();
+    client->end();
+
+    auto const spans {recorder->spans()};
+
+    ASSERT_EQ (spans.size(), 3u);
+    ASSERT_EQ (spans.at (0).parent_span, spans.at (1).span_id);
+    ASSERT_EQ (spans.at (1).parent_span, spans.at (2).span_id);
+  }
+
+  TEST (UtilTrace, chrome_json_of_no_spans_is_an_empty_trace)
+  {
+    ASSERT_EQ
+      ( fmt::format ("{}", ChromeJSON{})
+      , R"({"traceEvents":[],"displayTimeUnit":"ns"})"
+      );
+  }
+
+  TEST (UtilTrace, chrome_json_contains_complete_and_flow_events)
+  {
+    auto const begin
+      { std::chrono::system_clock::time_point
+          {std::chrono::microseconds {1000}}
+      };
+    auto const end {begin + std::chrono::nanoseconds {2500}};
+
+    auto const json
+      { fmt::format
+        ( "{}"
+        , ChromeJSON
+          { { Recorded
+              { "\"call\"", "rpc", Kind::Client
+              , 0x1, 0x2, 0x0, begin, end, 10, 1
+              }
+            , Recorded
+              { "handle", "rpc", Kind::Server
+              , 0x1, 0x3, 0x2, begin, end, 20, 2
+              }
+            }
+          }
+        )
+      };
+
+    ASSERT_EQ
+      ( json
+      , R"({"traceEvents":[)"
+        R"({"name":"\"call\"","cat":"rpc","ph":"X")"
+        R"(,"ts":1000.000,"dur":2.500,"pid":10,"tid":1)"
+        R"(,"args":{"trace_id":"0000000000000001")"
+        R"(,"span_id":"0000000000000002")"
+        R"(,"parent_span":"0000000000000000"}})"
+        R"(,{"name":"request","cat":"flow","ph":"s")"
+        R"(,"id":"0000000000000002","ts":1000.000,"pid":10,"tid":1})"
+        R"(,{"name":"handle","cat":"rpc","ph":"X")"
+        R"(,"ts":1000.000,"dur":2.500,"pid":20,"tid":2)"
+        R"(,"args":{"trace_id":"0000000000000001")"
+        R"(,"span_id":"0000000000000003")"
+        R"(,"parent_span":"0000000000000002"}})"
+        R"(,{"name":"request","cat":"flow","ph":"f","bp":"e")"
+        R"(,"id":"0000000000000002","ts":1000.000,"pid":20,"tid":2})"
+        R"(],"displayTimeUnit":"ns"})"
+      );
+  }
+}
@@ -6,6 +6,7 @@
 #include <asio/ip/tcp.hpp>
 #include <asio/local/stream_protocol.hpp>
 #include <compare>
+#include <mcs/serialization/STD/optional.hpp>
 #include <mcs/serialization/STD/variant.hpp>
 #include <mcs/serialization/declare.hpp>
 #include <mcs/util/ASIO/is_protocol.hpp>
@@ -13,6 +14,7 @@
 #include <mcs/util/hash/declare.hpp>
 #include <mcs/util/read/declare.hpp>
 #include <mcs/util/string.hpp>
+#include <optional>
 #include <type_traits>
 #include <variant>
 
@@ -32,6 +34,20 @@ namespace mcs::util::ASIO
     ;
 }
 
+namespace mcs::util::ASIO
+{
+  template<> struct Connectable<asio::local::stream_protocol>
+  {
+    explicit Connectable (asio::local::stream_protocol::endpoint const&);
+
+    util::string path;
+
+    explicit Connectable (decltype (path));
+
+    auto operator<=> (Connectable const&) const noexcept = default;
+  };
+}
+
 namespace mcs::util::ASIO
 {
   template<> struct Connectable<asio::ip::tcp>
@@ -54,23 +70,19 @@ namespace mcs::util::ASIO
     std::variant<Address, Hostname> address_or_hostname;
     asio::ip::port_type port;
 
-    Connectable (decltype (address_or_hostname), decltype (port));
-
-    auto operator<=> (Connectable const&) const = default;
-  };
-}
+    // Optional: The same provider listens on a local::stream_protocol
+    // endpoint, too. Clients on the same host prefer it, see
+    // prefer_same_host.
+    //
+    std::optional<Connectable<asio::local::stream_protocol>> same_host;
 
-namespace mcs::util::ASIO
-{
-  template<> struct Connectable<asio::local::stream_protocol>
-  {
-    explicit Connectable (asio::local::stream_protocol::endpoint const&);
-
-    util::string path;
-
-    explicit Connectable (decltype (path));
+    Connectable
+      ( decltype (address_or_hostname)
+      , decltype (port)
+      , decltype (same_host) = {}
+      );
 
-    auto operator<=> (Connectable const&) const noexcept = default;
+    auto operator<=> (Connectable const&) const = default;
   };
 }
 
@@ -81,6 +93,18 @@ namespace mcs::util::ASIO
     , Connectable<asio::local::stream_protocol>
     >;
 
+  // Returns the same host alternative of an ip::tcp connectable if
+  // it has one and if it refers to the local host, that is if its
+  // hostname is the hostname of the local host or if its address is
+  // a loopback address. Returns the connectable unchanged otherwise.
+  //
+  // \note the hostname is not resolved, a provider that was started
+  // with an unspecified address publishes the hostname of its host
+  //
+  [[nodiscard]] auto prefer_same_host (AnyConnectable) -> AnyConnectable;
+
+  // Calls runner with prefer_same_host (connectable).
+  //
   template<typename Runner, typename... Args>
     auto run (AnyConnectable, Runner&&, Args&&...);
 }
@@ -21,12 +21,24 @@ namespace mcs::util::ASIO
     auto accept() -> typename Protocol::socket;
     auto async_accept() -> asio::awaitable<typename Protocol::socket>;
 
+    // The accepted socket uses the executor of the given execution
+    // context instead of the executor of the acceptor.
+    //
+    template<typename ExecutionContext>
+      auto async_accept
+        ( ExecutionContext&
+        ) -> asio::awaitable<typename Protocol::socket>;
+
     // \note Protocol::acceptor _is_ moveable but to move it leads to crashes
     ListeningAcceptor (ListeningAcceptor const&) = delete;
     ListeningAcceptor (ListeningAcceptor&&) = delete;
     auto operator= (ListeningAcceptor&&) -> ListeningAcceptor& = delete;
     auto operator= (ListeningAcceptor const&) -> ListeningAcceptor& = delete;
-    ~ListeningAcceptor() = default;
+
+    // Removes the socket file of a local::stream_protocol endpoint,
+    // the file is not removed when the acceptor is closed.
+    //
+    ~ListeningAcceptor() noexcept;
 
   private:
     typename Protocol::acceptor _acceptor;
@@ -10,6 +10,7 @@
 #include <mcs/util/read/STD/tuple.hpp>
 #include <mcs/util/read/STD/variant.hpp>
 #include <mcs/util/read/define.hpp>
+#include <mcs/util/read/prefix.hpp>
 #include <mcs/util/read/read.hpp>
 #include <utility>
 
@@ -25,11 +26,20 @@ namespace fmt
     , mcs::util::ASIO::Connectable<asio::ip::tcp>
     )
   {
-    return fmt::format_to
-      ( ctx.out()
-      , "ip::tcp {}"
-      , std::make_tuple (connectable.address_or_hostname, connectable.port)
-      );
+    auto out
+      { fmt::format_to
+        ( ctx.out()
+        , "ip::tcp {}"
+        , std::make_tuple (connectable.address_or_hostname, connectable.port)
+        )
+      };
+
+    if (connectable.same_host)
+    {
+      out = fmt::format_to (out, " same_host {}", *connectable.same_host);
+    }
+
+    return out;
   }
 
   MCS_UTIL_FMT_DEFINE_PARSE
@@ -73,13 +83,23 @@ namespace mcs::util::read
       return Connectable {asio::ip::tcp::endpoint{}};
     }
 
-    return std::make_from_tuple<Connectable>
-      ( parse< std::tuple
-               < decltype (std::declval<Connectable>().address_or_hostname)
-               , decltype (std::declval<Connectable>().port)
-               >
-             > (state)
-      );
+    auto connectable
+      { std::make_from_tuple<Connectable>
+        ( parse< std::tuple
+                 < decltype (std::declval<Connectable>().address_or_hostname)
+                 , decltype (std::declval<Connectable>().port)
+                 >
+               > (state)
+        )
+      };
+
+    if (maybe_prefix (state, "same_host"))
+    {
+      connectable.same_host = parse
+        <util::ASIO::Connectable<asio::local::stream_protocol>> (state);
+    }
+
+    return connectable;
   }
 
   MCS_UTIL_READ_DEFINE_NONINTRUSIVE_IMPLEMENTATION
@@ -171,7 +191,7 @@ namespace mcs::util::ASIO
                   );
           }
         )
-      , connectable
+      , prefer_same_host (connectable)
       );
   }
 }
@@ -2,7 +2,9 @@
 // License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
 
 #include <asio/ip/tcp.hpp>
+#include <asio/local/stream_protocol.hpp>
 #include <asio/use_awaitable.hpp>
+#include <filesystem>
 #include <type_traits>
 
 namespace mcs::util::ASIO
@@ -25,6 +27,31 @@ namespace mcs::util::ASIO
     _acceptor.listen();
   }
 
+  template<is_protocol Protocol>
+    ListeningAcceptor<Protocol>::~ListeningAcceptor() noexcept
+  {
+    if constexpr (std::is_same_v<Protocol, asio::local::stream_protocol>)
+    {
+      try
+      {
+        auto const path {_acceptor.local_endpoint().path()};
+
+        // \note abstract socket names start with '\0' and have no file
+        if (path.empty() || path.front() == '\0')
+        {
+          return;
+        }
+
+        _acceptor.close();
+        std::filesystem::remove (path);
+      }
+      catch (...) // NOLINT (bugprone-empty-catch)
+      {
+        // the file stays, e.g. if it has been removed by someone else
+      }
+    }
+  }
+
   template<is_protocol Protocol>
     auto ListeningAcceptor<Protocol>::local_endpoint
       (
@@ -46,4 +73,17 @@ namespace mcs::util::ASIO
   {
     return _acceptor.async_accept (asio::use_awaitable);
   }
+
+  template<is_protocol Protocol>
+    template<typename ExecutionContext>
+      auto ListeningAcceptor<Protocol>::async_accept
+        ( ExecutionContext& execution_context
+        ) -> asio::awaitable<typename Protocol::socket>
+  {
+    return _acceptor.async_accept
+      ( typename Protocol::socket::executor_type
+          {execution_context.get_executor()}
+      , asio::use_awaitable
+      );
+  }
 }
@@ -1,12 +1,16 @@
 // Copyright (C) 2023-2025 Fraunhofer ITWM
 // License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
 
+#include <asio/ip/address.hpp>
+#include <mcs/serialization/STD/optional.hpp>
 #include <mcs/serialization/STD/variant.hpp>
 #include <mcs/serialization/define.hpp>
 #include <mcs/util/ASIO/Connectable.hpp>
 #include <mcs/util/hash/define.hpp>
 #include <mcs/util/syscall/hostname.hpp>
+#include <string>
 #include <utility>
+#include <variant>
 
 namespace mcs::util::ASIO
 {
@@ -21,14 +25,17 @@ namespace mcs::util::ASIO
             {Address {util::string {endpoint.address().to_string()}}}
         }
       , port {endpoint.port()}
+      , same_host {}
   {}
 
   Connectable<asio::ip::tcp>::Connectable
     ( decltype (address_or_hostname) address_or_hostname_
     , decltype (port) port_
+    , decltype (same_host) same_host_
     )
       : address_or_hostname {address_or_hostname_}
       , port {port_}
+      , same_host {same_host_}
   {}
 }
 
@@ -47,6 +54,55 @@ namespace mcs::util::ASIO
   {}
 }
 
+namespace mcs::util::ASIO
+{
+  namespace
+  {
+    auto is_local_host
+      ( Connectable<asio::ip::tcp>::Address const& address
+      ) -> bool
+    {
+      try
+      {
+        return asio::ip::make_address
+          (std::string {address.address_string}).is_loopback();
+      }
+      catch (...)
+      {
+        return false;
+      }
+    }
+
+    auto is_local_host
+      ( Connectable<asio::ip::tcp>::Hostname const& hostname
+      ) -> bool
+    {
+      return std::string {hostname.hostname} == util::syscall::hostname();
+    }
+  }
+
+  auto prefer_same_host (AnyConnectable connectable) -> AnyConnectable
+  {
+    if (auto const* tcp {std::get_if<Connectable<asio::ip::tcp>> (&connectable)})
+    {
+      if (  tcp->same_host
+         && std::visit
+            ( [] (auto const& address_or_hostname)
+              {
+                return is_local_host (address_or_hostname);
+              }
+            , tcp->address_or_hostname
+            )
+         )
+      {
+        return *tcp->same_host;
+      }
+    }
+
+    return connectable;
+  }
+}
+
 namespace std
 {
   MCS_UTIL_HASH_DEFINE_VIA_HASH_OF_MEMBER
@@ -100,6 +156,7 @@ namespace mcs::serialization
   {
     MCS_SERIALIZATION_SAVE_FIELD (oa, connectable, address_or_hostname);
     MCS_SERIALIZATION_SAVE_FIELD (oa, connectable, port);
+    MCS_SERIALIZATION_SAVE_FIELD (oa, connectable, same_host);
 
     return oa;
   }
@@ -110,10 +167,12 @@ namespace mcs::serialization
 
     MCS_SERIALIZATION_LOAD_FIELD (ia, address_or_hostname, Connectable);
     MCS_SERIALIZATION_LOAD_FIELD (ia, port, Connectable);
+    MCS_SERIALIZATION_LOAD_FIELD (ia, same_host, Connectable);
 
     return Connectable
       { std::move (address_or_hostname)
       , port
+      , std::move (same_host)
       };
   }
 }
@@ -27,6 +27,27 @@ namespace mcs::util::copy
   {
     FileWriteLocation (std::filesystem::path, off_t);
   };
+
+  // Does not own the socket. The socket might be in non-blocking
+  // mode, e.g. when it is used by asio, so the copy waits for the
+  // socket to become ready before each transfer.
+  //
+  struct SocketLocation
+  {
+    explicit SocketLocation (int);
+
+    int _fd;
+  };
+
+  struct SocketReadLocation : public SocketLocation
+  {
+    using SocketLocation::SocketLocation;
+  };
+
+  struct SocketWriteLocation : public SocketLocation
+  {
+    using SocketLocation::SocketLocation;
+  };
 }
 
 namespace mcs::util
@@ -53,5 +74,30 @@ namespace mcs::util
       , std::size_t
       ) const -> std::size_t
       ;
+
+    // Uses sendfile, the bytes do not pass through user space.
+    //
+    // Returns: The number of bytes copied. Less than requested if
+    // the file ends early.
+    //
+    auto operator()
+      ( copy::FileReadLocation const&
+      , copy::SocketWriteLocation const&
+      , std::size_t
+      ) const -> std::size_t
+      ;
+
+    // Uses splice through a pipe, the bytes do not pass through user
+    // space.
+    //
+    // Returns: The number of bytes copied. Less than requested if
+    // the peer closes the connection early.
+    //
+    auto operator()
+      ( copy::SocketReadLocation const&
+      , copy::FileWriteLocation const&
+      , std::size_t
+      ) const -> std::size_t
+      ;
   };
 }
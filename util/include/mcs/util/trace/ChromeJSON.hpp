@@ -0,0 +1,36 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <mcs/util/FMT/declare.hpp>
+#include <mcs/util/trace/Recorder.hpp>
+#include <vector>
+
+namespace mcs::util::trace
+{
+  // Formats spans in the Chrome trace event format that is read by
+  // chrome://tracing and by Perfetto. Every span is a complete event,
+  // a client span is connected to the server span of its request by
+  // a flow event, in particular across processes.
+  //
+  // The traces of several processes are combined by concatenating
+  // their "traceEvents".
+  //
+  // EXAMPLE:
+  //
+  //   util::FMT::write_file
+  //     (path, "{}", trace::ChromeJSON {recorder->spans()});
+  //
+  struct ChromeJSON
+  {
+    std::vector<Recorded> spans;
+  };
+}
+
+namespace fmt
+{
+  template<> MCS_UTIL_FMT_DECLARE (mcs::util::trace::ChromeJSON);
+}
+
+#include "detail/ChromeJSON.ipp"
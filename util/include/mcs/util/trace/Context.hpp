@@ -0,0 +1,50 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <cstdint>
+
+namespace mcs::util::trace
+{
+  // The part of a trace that travels with a request: The trace the
+  // request belongs to and the span that caused the request. A
+  // context with trace_id zero is not traced.
+  //
+  // Trivially copyable, e.g. to be sent as part of a message header.
+  //
+  struct Context
+  {
+    std::uint64_t trace_id {0};
+    std::uint64_t parent_span {0};
+
+    [[nodiscard]] constexpr auto is_traced() const noexcept -> bool;
+  };
+
+  // Returns: The context of the calling thread, not traced unless set
+  // by a ScopedContext.
+  //
+  [[nodiscard]] auto current() noexcept -> Context;
+
+  // Sets the context of the calling thread for its lifetime and
+  // restores the previous context afterwards.
+  //
+  // \note the context belongs to the thread: it must not be held
+  // across a suspension of a coroutine
+  //
+  struct [[nodiscard]] ScopedContext
+  {
+    explicit ScopedContext (Context) noexcept;
+    ~ScopedContext() noexcept;
+
+    ScopedContext (ScopedContext const&) = delete;
+    ScopedContext (ScopedContext&&) = delete;
+    auto operator= (ScopedContext const&) -> ScopedContext& = delete;
+    auto operator= (ScopedContext&&) -> ScopedContext& = delete;
+
+  private:
+    Context _previous;
+  };
+}
+
+#include "detail/Context.ipp"
@@ -0,0 +1,65 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace mcs::util::trace
+{
+  // Client spans cause requests to other processes, server spans
+  // handle such requests. All other spans are internal.
+  //
+  enum class Kind
+  {
+    Internal,
+    Client,
+    Server,
+  };
+
+  // A finished span. The times are taken from the system clock to
+  // make the spans of processes on the same host comparable.
+  //
+  struct Recorded
+  {
+    std::string name;
+    std::string category;
+    Kind kind {Kind::Internal};
+    std::uint64_t trace_id {0};
+    std::uint64_t span_id {0};
+    std::uint64_t parent_span {0};
+    std::chrono::system_clock::time_point begin;
+    std::chrono::system_clock::time_point end;
+    std::uint64_t process {0};
+    std::uint64_t thread {0};
+  };
+
+  // Collects the finished spans of a process.
+  //
+  // \note can be called from any thread
+  //
+  struct Recorder
+  {
+    auto record (Recorded) -> void;
+
+    [[nodiscard]] auto spans() const -> std::vector<Recorded>;
+
+  private:
+    mutable std::mutex _guard;
+    std::vector<Recorded> _spans;
+  };
+
+  // Spans are recorded only while a recorder is installed. Installs
+  // the recorder of the process, replaces the recorder that has been
+  // installed before, if any. Installing nullptr disables the
+  // recording.
+  //
+  auto install (std::shared_ptr<Recorder>) noexcept -> void;
+
+  [[nodiscard]] auto installed() noexcept -> std::shared_ptr<Recorder>;
+}
@@ -0,0 +1,49 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <mcs/util/trace/Context.hpp>
+#include <mcs/util/trace/Recorder.hpp>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+namespace mcs::util::trace
+{
+  // A running span. It starts at construction and is recorded when
+  // it ends, at the latest when it is destructed.
+  //
+  struct [[nodiscard]] Span
+  {
+    // Returns: A span that is a child of the parent, if a recorder is
+    // installed and the parent is traced. A client span with a parent
+    // that is not traced starts a new trace.
+    //
+    [[nodiscard]] static auto start
+      ( std::string_view name
+      , std::string_view category
+      , Kind
+      , Context parent
+      ) -> std::optional<Span>
+      ;
+
+    // Returns: The context for the children of the span.
+    //
+    [[nodiscard]] auto context() const noexcept -> Context;
+
+    auto end() -> void;
+
+    ~Span() noexcept;
+    Span (Span const&) = delete;
+    Span (Span&&) noexcept = default;
+    auto operator= (Span const&) -> Span& = delete;
+    auto operator= (Span&&) noexcept -> Span& = default;
+
+  private:
+    Span (std::shared_ptr<Recorder>, Recorded) noexcept;
+
+    std::shared_ptr<Recorder> _recorder;
+    Recorded _recorded;
+  };
+}
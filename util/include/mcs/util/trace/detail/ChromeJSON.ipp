@@ -0,0 +1,121 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <chrono>
+#include <cstdint>
+#include <fmt/format.h>
+#include <mcs/util/FMT/define.hpp>
+#include <string_view>
+
+namespace mcs::util::trace::detail
+{
+  template<typename Out>
+    auto format_json_string (Out out, std::string_view string) -> Out
+  {
+    *out++ = '"';
+
+    for (auto const c : string)
+    {
+      if (c == '"' || c == '\\')
+      {
+        *out++ = '\\';
+        *out++ = c;
+      }
+      else if (static_cast<unsigned char> (c) < 0x20)
+      {
+        out = fmt::format_to
+          (out, "\\u{:04x}", static_cast<unsigned int> (c));
+      }
+      else
+      {
+        *out++ = c;
+      }
+    }
+
+    *out++ = '"';
+
+    return out;
+  }
+
+  // microseconds since the epoch with nanosecond precision
+  //
+  template<typename Out>
+    auto format_timestamp
+      ( Out out
+      , std::chrono::system_clock::duration duration
+      ) -> Out
+  {
+    auto const nanoseconds
+      { std::chrono::duration_cast<std::chrono::nanoseconds>
+          (duration).count()
+      };
+
+    return fmt::format_to
+      (out, "{}.{:03}", nanoseconds / 1000, nanoseconds % 1000);
+  }
+}
+
+namespace fmt
+{
+  MCS_UTIL_FMT_DEFINE_PARSE (ctx, mcs::util::trace::ChromeJSON)
+  {
+    return ctx.begin();
+  }
+  MCS_UTIL_FMT_DEFINE_FORMAT (chrome_json, ctx, mcs::util::trace::ChromeJSON)
+  {
+    using mcs::util::trace::Kind;
+    using mcs::util::trace::detail::format_json_string;
+    using mcs::util::trace::detail::format_timestamp;
+
+    auto out {fmt::format_to (ctx.out(), "{{\"traceEvents\":[")};
+    auto separator {""};
+
+    for (auto const& span : chrome_json.spans)
+    {
+      out = fmt::format_to (out, "{}{{\"name\":", separator);
+      out = format_json_string (out, span.name);
+      out = fmt::format_to (out, ",\"cat\":");
+      out = format_json_string (out, span.category);
+      out = fmt::format_to (out, ",\"ph\":\"X\",\"ts\":");
+      out = format_timestamp (out, span.begin.time_since_epoch());
+      out = fmt::format_to (out, ",\"dur\":");
+      out = format_timestamp (out, span.end - span.begin);
+      out = fmt::format_to
+        ( out
+        , ",\"pid\":{},\"tid\":{}"
+          ",\"args\":{{\"trace_id\":\"{:016x}\""
+          ",\"span_id\":\"{:016x}\""
+          ",\"parent_span\":\"{:016x}\"}}}}"
+        , span.process
+        , span.thread
+        , span.trace_id
+        , span.span_id
+        , span.parent_span
+        );
+      separator = ",";
+
+      // the flow from the client span to the server span that has
+      // the client span as parent
+      if (span.kind == Kind::Client || span.kind == Kind::Server)
+      {
+        out = fmt::format_to
+          ( out
+          , ",{{\"name\":\"request\",\"cat\":\"flow\",\"ph\":\"{}\""
+            "{},\"id\":\"{:016x}\",\"ts\":"
+          , span.kind == Kind::Client ? "s" : "f"
+          , span.kind == Kind::Client ? "" : ",\"bp\":\"e\""
+          , span.kind == Kind::Client ? span.span_id : span.parent_span
+          );
+        out = format_timestamp (out, span.begin.time_since_epoch());
+        out = fmt::format_to
+          ( out
+          , ",\"pid\":{},\"tid\":{}}}"
+          , span.process
+          , span.thread
+          );
+      }
+    }
+
+    return fmt::format_to (out, "],\"displayTimeUnit\":\"ns\"}}");
+  }
+}
@@ -0,0 +1,10 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+namespace mcs::util::trace
+{
+  constexpr auto Context::is_traced() const noexcept -> bool
+  {
+    return trace_id != 0;
+  }
+}
@@ -1,14 +1,22 @@
 // Copyright (C) 2024-2025 Fraunhofer ITWM
 // License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
 
+#include <array>
 #include <mcs/util/Copy.hpp>
 #include <mcs/util/cast.hpp>
+#include <mcs/util/execute_and_die_on_exception.hpp>
 #include <mcs/util/fopen.hpp>
+#include <mcs/util/syscall/close.hpp>
 #include <mcs/util/syscall/copy_file_range_with_fallback_to_sendfile.hpp>
 #include <mcs/util/syscall/fileno.hpp>
 #include <mcs/util/syscall/lseek.hpp>
+#include <mcs/util/syscall/pipe2.hpp>
+#include <mcs/util/syscall/poll.hpp>
 #include <mcs/util/syscall/read.hpp>
+#include <mcs/util/syscall/sendfile.hpp>
+#include <mcs/util/syscall/splice.hpp>
 #include <mcs/util/syscall/write.hpp>
+#include <tuple>
 
 namespace mcs::util::copy
 {
@@ -36,6 +44,55 @@ namespace mcs::util::copy
     )
       : FileLocation {path, "r+b", offset}
   {}
+
+  SocketLocation::SocketLocation (int fd)
+    : _fd {fd}
+  {}
+}
+
+namespace
+{
+  auto wait_for (int fd, short events) -> void
+  {
+    auto pfd {pollfd {fd, events, 0}};
+
+    std::ignore = mcs::util::syscall::poll (&pfd, 1, -1);
+  }
+
+  struct Pipe
+  {
+    Pipe()
+    {
+      mcs::util::syscall::pipe2 (_fds.data(), O_CLOEXEC);
+    }
+    ~Pipe()
+    {
+      mcs::util::execute_and_die_on_exception
+        ( "Copy::Pipe::~Pipe"
+        , [&]
+          {
+            mcs::util::syscall::close (_fds[0]);
+            mcs::util::syscall::close (_fds[1]);
+          }
+        );
+    }
+    Pipe (Pipe const&) = delete;
+    Pipe (Pipe&&) = delete;
+    auto operator= (Pipe const&) -> Pipe& = delete;
+    auto operator= (Pipe&&) -> Pipe& = delete;
+
+    [[nodiscard]] auto read_end() const noexcept -> int
+    {
+      return _fds[0];
+    }
+    [[nodiscard]] auto write_end() const noexcept -> int
+    {
+      return _fds[1];
+    }
+
+  private:
+    std::array<int, 2> _fds;
+  };
 }
 
 namespace mcs::util
@@ -116,3 +173,90 @@ namespace mcs::util
     return bytes_copied;
   }
 }
+
+namespace mcs::util
+{
+  auto Copy::operator()
+    ( copy::FileReadLocation const& from
+    , copy::SocketWriteLocation const& to
+    , std::size_t size
+    ) const -> std::size_t
+  {
+    auto bytes_copied {std::size_t {0}};
+    auto bytes_left {size};
+
+    while (bytes_copied < size)
+    {
+      wait_for (to._fd, POLLOUT);
+
+      auto const bytes_transferred
+        { util::syscall::sendfile (to._fd, from._fd, nullptr, bytes_left)
+        };
+
+      if (bytes_transferred == 0)
+      {
+        break;
+      }
+
+      bytes_copied += util::cast<std::size_t> (bytes_transferred);
+      bytes_left -= util::cast<std::size_t> (bytes_transferred);
+    }
+
+    return bytes_copied;
+  }
+}
+
+namespace mcs::util
+{
+  auto Copy::operator()
+    ( copy::SocketReadLocation const& from
+    , copy::FileWriteLocation const& to
+    , std::size_t size
+    ) const -> std::size_t
+  {
+    auto const pipe {Pipe{}};
+    auto bytes_copied {std::size_t {0}};
+    auto bytes_left {size};
+
+    while (bytes_copied < size)
+    {
+      wait_for (from._fd, POLLIN);
+
+      auto const bytes_in_pipe
+        { util::cast<std::size_t>
+          ( util::syscall::splice
+            ( from._fd, nullptr
+            , pipe.write_end(), nullptr
+            , bytes_left
+            , SPLICE_F_MOVE
+            )
+          )
+        };
+
+      if (bytes_in_pipe == 0)
+      {
+        break;
+      }
+
+      for ( auto bytes_left_in_pipe {bytes_in_pipe}
+          ; bytes_left_in_pipe > 0
+          ;
+          )
+      {
+        bytes_left_in_pipe -= util::cast<std::size_t>
+          ( util::syscall::splice
+            ( pipe.read_end(), nullptr
+            , to._fd, nullptr
+            , bytes_left_in_pipe
+            , SPLICE_F_MOVE
+            )
+          );
+      }
+
+      bytes_copied += bytes_in_pipe;
+      bytes_left -= bytes_in_pipe;
+    }
+
+    return bytes_copied;
+  }
+}
@@ -0,0 +1,27 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <mcs/util/trace/Context.hpp>
+#include <utility>
+
+namespace mcs::util::trace
+{
+  namespace
+  {
+    thread_local auto current_context {Context{}};
+  }
+
+  auto current() noexcept -> Context
+  {
+    return current_context;
+  }
+
+  ScopedContext::ScopedContext (Context context) noexcept
+    : _previous {std::exchange (current_context, context)}
+  {}
+
+  ScopedContext::~ScopedContext() noexcept
+  {
+    current_context = _previous;
+  }
+}
@@ -0,0 +1,44 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <atomic>
+#include <mcs/util/trace/Recorder.hpp>
+#include <utility>
+
+namespace mcs::util::trace
+{
+  namespace
+  {
+    auto installed_recorder() noexcept
+      -> std::atomic<std::shared_ptr<Recorder>>&
+    {
+      static auto recorder {std::atomic<std::shared_ptr<Recorder>>{}};
+
+      return recorder;
+    }
+  }
+
+  auto Recorder::record (Recorded recorded) -> void
+  {
+    auto const lock {std::lock_guard {_guard}};
+
+    _spans.emplace_back (std::move (recorded));
+  }
+
+  auto Recorder::spans() const -> std::vector<Recorded>
+  {
+    auto const lock {std::lock_guard {_guard}};
+
+    return _spans;
+  }
+
+  auto install (std::shared_ptr<Recorder> recorder) noexcept -> void
+  {
+    installed_recorder().store (std::move (recorder));
+  }
+
+  auto installed() noexcept -> std::shared_ptr<Recorder>
+  {
+    return installed_recorder().load();
+  }
+}
@@ -0,0 +1,113 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#include <atomic>
+#include <cstdint>
+#include <mcs/util/syscall/getpid.hpp>
+#include <mcs/util/trace/Span.hpp>
+#include <random>
+#include <string>
+#include <utility>
+
+namespace mcs::util::trace
+{
+  namespace
+  {
+    // non-zero
+    auto random_id() -> std::uint64_t
+    {
+      thread_local auto engine {std::mt19937_64 {std::random_device{}()}};
+
+      auto id {std::uint64_t {0}};
+
+      while (id == 0)
+      {
+        id = engine();
+      }
+
+      return id;
+    }
+
+    // small numbers that are stable for the lifetime of a thread
+    auto thread_number() noexcept -> std::uint64_t
+    {
+      static auto next {std::atomic<std::uint64_t> {1}};
+      thread_local auto const number {next.fetch_add (1)};
+
+      return number;
+    }
+  }
+
+  auto Span::start
+    ( std::string_view name
+    , std::string_view category
+    , Kind kind
+    , Context parent
+    ) -> std::optional<Span>
+  {
+    if (!parent.is_traced() && kind != Kind::Client)
+    {
+      return {};
+    }
+
+    auto recorder {installed()};
+
+    if (!recorder)
+    {
+      return {};
+    }
+
+    return Span
+      { std::move (recorder)
+      , Recorded
+        { std::string {name}
+        , std::string {category}
+        , kind
+        , parent.is_traced() ? parent.trace_id : random_id()
+        , random_id()
+        , parent.parent_span
+        , std::chrono::system_clock::now()
+        , std::chrono::system_clock::time_point{}
+        , static_cast<std::uint64_t> (syscall::getpid())
+        , thread_number()
+        }
+      };
+  }
+
+  Span::Span
+    ( std::shared_ptr<Recorder> recorder
+    , Recorded recorded
+    ) noexcept
+      : _recorder {std::move (recorder)}
+      , _recorded {std::move (recorded)}
+  {}
+
+  auto Span::context() const noexcept -> Context
+  {
+    return Context {_recorded.trace_id, _recorded.span_id};
+  }
+
+  auto Span::end() -> void
+  {
+    if (!_recorder)
+    {
+      return;
+    }
+
+    _recorded.end = std::chrono::system_clock::now();
+
+    std::exchange (_recorder, nullptr)->record (std::move (_recorded));
+  }
+
+  Span::~Span() noexcept
+  {
+    try
+    {
+      end();
+    }
+    catch (...) // NOLINT (bugprone-empty-catch)
+    {
+      // the span is lost
+    }
+  }
+}
@@ -0,0 +1,12 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace mcs::util::syscall
+{
+  auto pipe2 (int pipefd[2], int flags) -> void;
+}
@@ -0,0 +1,11 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <poll.h>
+
+namespace mcs::util::syscall
+{
+  auto poll (pollfd* fds, nfds_t nfds, int timeout) -> int;
+}
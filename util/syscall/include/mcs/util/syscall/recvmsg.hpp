@@ -0,0 +1,11 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <sys/socket.h>
+
+namespace mcs::util::syscall
+{
+  auto recvmsg (int sockfd, msghdr* msg, int flags) -> ssize_t;
+}
@@ -0,0 +1,12 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <sched.h>
+#include <sys/types.h>
+
+namespace mcs::util::syscall
+{
+  auto sched_setaffinity (pid_t, cpu_set_t const&) -> void;
+}
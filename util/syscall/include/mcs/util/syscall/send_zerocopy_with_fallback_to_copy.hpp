@@ -0,0 +1,29 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <sys/socket.h>
+
+namespace mcs::util::syscall
+{
+  struct SentZeroCopy
+  {
+    ssize_t bytes;
+    bool is_zerocopy;
+  };
+
+  // Tries to send with MSG_ZEROCOPY and if that returns an ENOBUFS
+  // (the kernel can not pin more pages for the socket), then falls
+  // back to send without MSG_ZEROCOPY. Only sends with is_zerocopy
+  // produce a completion notification in the error queue of the
+  // socket.
+  //
+  auto send_zerocopy_with_fallback_to_copy
+    ( int sockfd
+    , void const* buf
+    , size_t len
+    , int flags
+    ) -> SentZeroCopy
+    ;
+}
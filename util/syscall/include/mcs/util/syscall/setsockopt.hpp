@@ -0,0 +1,18 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <sys/socket.h>
+
+namespace mcs::util::syscall
+{
+  auto setsockopt
+    ( int sockfd
+    , int level
+    , int optname
+    , void const* optval
+    , socklen_t optlen
+    ) -> void
+    ;
+}
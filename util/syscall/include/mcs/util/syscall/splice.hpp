@@ -0,0 +1,19 @@
+// Copyright (C) 2025 Fraunhofer ITWM
+// License: https://raw.githubusercontent.com/cc-hpc-itwm/mcs/main/LICENSE
+
+#pragma once
+
+#include <fcntl.h>
+
+namespace mcs::util::syscall
+{
+  auto splice
+    ( int fd_in
+    , loff_t* off_in
+    , int fd_out
+    , loff_t* off_out
+    , size_t len
+    , unsigned int flags
+    ) -> ssize_t
+    ;
+}
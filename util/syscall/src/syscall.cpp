@@ -28,13 +28,21 @@
 #include <mcs/util/syscall/mmap.hpp>
 #include <mcs/util/syscall/munlock.hpp>
 #include <mcs/util/syscall/munmap.hpp>
+#include <mcs/util/syscall/pipe2.hpp>
+#include <mcs/util/syscall/poll.hpp>
 #include <mcs/util/syscall/pread.hpp>
 #include <mcs/util/syscall/pwrite.hpp>
 #include <mcs/util/syscall/read.hpp>
 #include <mcs/util/syscall/realloc.hpp>
+#include <mcs/util/syscall/recvmsg.hpp>
+#include <mcs/util/syscall/sched_getaffinity.hpp>
+#include <mcs/util/syscall/sched_setaffinity.hpp>
+#include <mcs/util/syscall/send_zerocopy_with_fallback_to_copy.hpp>
 #include <mcs/util/syscall/sendfile.hpp>
+#include <mcs/util/syscall/setsockopt.hpp>
 #include <mcs/util/syscall/shm_open.hpp>
 #include <mcs/util/syscall/shm_unlink.hpp>
+#include <mcs/util/syscall/splice.hpp>
 #include <mcs/util/syscall/statfs.hpp>
 #include <mcs/util/syscall/sysconf.hpp>
 #include <mcs/util/syscall/write.hpp>
@@ -580,6 +588,41 @@ namespace mcs::util::syscall
       );
   }
 
+  auto pipe2 (int pipefd[2], int flags) -> void
+  try
+  {
+    return negative_one_fails_with_errno<void> (::pipe2 (pipefd, flags));
+  }
+  catch (...)
+  {
+    std::throw_with_nested
+      ( Error
+        { fmt::format ( "syscall::pipe2 (pipefd = {}, flags = {})"
+                      , cast<void*> (pipefd)
+                      , flags
+                      )
+        }
+      );
+  }
+
+  auto poll (pollfd* fds, nfds_t nfds, int timeout) -> int
+  try
+  {
+    return negative_one_fails_with_errno<int> (::poll (fds, nfds, timeout));
+  }
+  catch (...)
+  {
+    std::throw_with_nested
+      ( Error
+        { fmt::format ( "syscall::poll (fds = {}, nfds = {}, timeout = {})"
+                      , cast<void*> (fds)
+                      , nfds
+                      , timeout
+                      )
+        }
+      );
+  }
+
   auto pread (int fd, void* buf, size_t nbyte, off_t offset) -> ssize_t
   try
   {
@@ -657,6 +700,98 @@ namespace mcs::util::syscall
       );
   }
 
+  auto recvmsg (int sockfd, msghdr* msg, int flags) -> ssize_t
+  try
+  {
+    return negative_one_fails_with_errno<ssize_t>
+      (::recvmsg (sockfd, msg, flags));
+  }
+  catch (...)
+  {
+    std::throw_with_nested
+      ( Error
+        { fmt::format ( "syscall::recvmsg (sockfd = {}, msg = {}, flags = {})"
+                      , sockfd
+                      , cast<void*> (msg)
+                      , flags
+                      )
+        }
+      );
+  }
+
+  auto sched_getaffinity (pid_t pid) -> cpu_set_t
+  try
+  {
+    auto mask {cpu_set_t{}};
+    negative_one_fails_with_errno<void>
+      (::sched_getaffinity (pid, sizeof (mask), std::addressof (mask)));
+    return mask;
+  }
+  catch (...)
+  {
+    std::throw_with_nested
+      ( Error
+        { fmt::format ("syscall::sched_getaffinity (pid = {})", pid)
+        }
+      );
+  }
+
+  auto sched_setaffinity (pid_t pid, cpu_set_t const& mask) -> void
+  try
+  {
+    negative_one_fails_with_errno<void>
+      (::sched_setaffinity (pid, sizeof (mask), std::addressof (mask)));
+  }
+  catch (...)
+  {
+    std::throw_with_nested
+      ( Error
+        { fmt::format ("syscall::sched_setaffinity (pid = {})", pid)
+        }
+      );
+  }
+
+  auto send_zerocopy_with_fallback_to_copy
+    ( int sockfd
+    , void const* buf
+    , size_t len
+    , int flags
+    ) -> SentZeroCopy
+  try
+  {
+    auto const r {::send (sockfd, buf, len, flags | MSG_ZEROCOPY)};
+
+    if (r == -1 && errno == ENOBUFS)
+    {
+      return SentZeroCopy
+        { negative_one_fails_with_errno<ssize_t>
+            (::send (sockfd, buf, len, flags))
+        , false
+        };
+    }
+
+    return SentZeroCopy {negative_one_fails_with_errno<ssize_t> (r), true};
+  }
+  catch (...)
+  {
+    std::throw_with_nested
+      ( Error
+        { fmt::format
+          ( "syscall::send_zerocopy_with_fallback_to_copy"
+            " (sockfd = {}"
+            ", buf = {}"
+            ", len = {}"
+            ", flags = {}"
+            ")"
+          , sockfd
+          , buf
+          , len
+          , flags
+          )
+        }
+      );
+  }
+
   auto sendfile
     ( int out_fd
     , int in_fd
@@ -690,6 +825,40 @@ namespace mcs::util::syscall
       );
   }
 
+  auto setsockopt
+    ( int sockfd
+    , int level
+    , int optname
+    , void const* optval
+    , socklen_t optlen
+    ) -> void
+  try
+  {
+    return negative_one_fails_with_errno<void>
+      (::setsockopt (sockfd, level, optname, optval, optlen));
+  }
+  catch (...)
+  {
+    std::throw_with_nested
+      ( Error
+        { fmt::format
+          ( "syscall::setsockopt"
+            " (sockfd = {}"
+            ", level = {}"
+            ", optname = {}"
+            ", optval = {}"
+            ", optlen = {}"
+            ")"
+          , sockfd
+          , level
+          , optname
+          , optval
+          , optlen
+          )
+        }
+      );
+  }
+
   auto shm_open (const char* name, int oflag, mode_t mode) -> int
   try
   {
@@ -722,6 +891,45 @@ namespace mcs::util::syscall
       );
   }
 
+  auto splice
+    ( int fd_in
+    , loff_t* off_in
+    , int fd_out
+    , loff_t* off_out
+    , size_t len
+    , unsigned int flags
+    ) -> ssize_t
+  try
+  {
+    return negative_one_fails_with_errno<ssize_t>
+      (::splice (fd_in, off_in, fd_out, off_out, len, flags));
+  }
+  catch (...)
+  {
+    std::throw_with_nested
+      ( Error
+        { fmt::format
+          ( "syscall::splice"
+            " (fd_in = {}"
+            ", off_in = {}@{}"
+            ", fd_out = {}"
+            ", off_out = {}@{}"
+            ", len = {}"
+            ", flags = {}"
+            ")"
+          , fd_in
+          , off_in ? *off_in : loff_t {-1}
+          , cast<void*> (off_in)
+          , fd_out
+          , off_out ? *off_out : loff_t {-1}
+          , cast<void*> (off_out)
+          , len
+          , flags
+          )
+        }
+      );
+  }
+
   auto statfs (char const* path) -> struct statfs
   try
   {